@@ -15,6 +15,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/StaticMesh.h"
+#include "Subsystems/GroundHeightCacheSubsystem.h"
 
 AEnergyWall::AEnergyWall()
 {
@@ -61,6 +62,12 @@ void AEnergyWall::BeginPlay()
 	Super::BeginPlay();
 }
 
+void AEnergyWall::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGroundHeightCacheSubsystem::InvalidateActorBounds(this);
+	Super::EndPlay(EndPlayReason);
+}
+
 void AEnergyWall::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -267,6 +274,7 @@ void AEnergyWall::InitializeWallInternal()
 	if (NavModifier) NavModifier->SetActive(false);
 
 	UpdateWallTransformAndDimensions();
+	UGroundHeightCacheSubsystem::InvalidateActorBounds(this);
 
 	// Setup instances for the rods and the shield
 	TopRodISM->ClearInstances();
@@ -10,6 +10,220 @@
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 
+namespace FogRaster
+{
+	// Edge length (pixels) of the blocks the mask is diffed, redrawn and uploaded in.
+	constexpr int32 FogBlockSize = 16;
+
+	struct FCircle
+	{
+		int32 CenterX = 0;
+		int32 CenterY = 0;
+		int32 HardRadius = 0;
+		int32 FalloffPixels = 1;
+
+		int32 GetOuterRadius() const { return HardRadius + FalloffPixels; }
+	};
+
+	// 20 bits per component, sorts row-major. FogTexSize is far below 2^20.
+	uint64 PackCircle(int32 CenterX, int32 CenterY, int32 HardRadius)
+	{
+		return (uint64(CenterY) << 40) | (uint64(CenterX) << 20) | uint64(HardRadius);
+	}
+
+	FCircle UnpackCircle(uint64 Key)
+	{
+		FCircle Circle;
+		Circle.CenterY = int32((Key >> 40) & 0xFFFFF);
+		Circle.CenterX = int32((Key >> 20) & 0xFFFFF);
+		Circle.HardRadius = int32(Key & 0xFFFFF);
+		Circle.FalloffPixels = FMath::Max(1, Circle.HardRadius / 10);
+		return Circle;
+	}
+
+	// Inclusive block range covered by the circle's outer (falloff) square.
+	FIntRect GetCircleBlocks(const FCircle& Circle, int32 TexSize)
+	{
+		const int32 Outer = Circle.GetOuterRadius();
+		const int32 LastBlock = (TexSize - 1) / FogBlockSize;
+		return FIntRect(
+			FMath::Clamp(Circle.CenterX - Outer, 0, TexSize - 1) / FogBlockSize,
+			FMath::Clamp(Circle.CenterY - Outer, 0, TexSize - 1) / FogBlockSize,
+			FMath::Min(FMath::Clamp(Circle.CenterX + Outer, 0, TexSize - 1) / FogBlockSize, LastBlock),
+			FMath::Min(FMath::Clamp(Circle.CenterY + Outer, 0, TexSize - 1) / FogBlockSize, LastBlock));
+	}
+
+	FORCEINLINE void ClearPixel(FColor& Pixel) { Pixel = FColor::Black; }
+	FORCEINLINE void ClearPixel(uint8& Pixel) { Pixel = 0; }
+
+	FORCEINLINE void WriteGray(FColor& Pixel, uint8 Gray)
+	{
+		if (Gray > Pixel.R)  // since R=G=B
+		{
+			Pixel = FColor(Gray, Gray, Gray, 255);
+		}
+	}
+
+	FORCEINLINE void WriteGray(uint8& Pixel, uint8 Gray)
+	{
+		Pixel = FMath::Max(Pixel, Gray);
+	}
+
+	// Draws the soft circle, restricted to the inclusive pixel rect [MinX..MaxX] x [MinY..MaxY].
+	template<typename PixelType>
+	void DrawCircleClipped(PixelType* Pixels, int32 TexSize, const FCircle& Circle, int32 MinX, int32 MinY, int32 MaxX, int32 MaxY)
+	{
+		const int32 HardRadius = Circle.HardRadius;
+		const int32 FalloffPixels = Circle.FalloffPixels;
+		const int32 Outer = Circle.GetOuterRadius();
+		const float HardRadiusSq  = float(HardRadius * HardRadius);
+		const float OuterRadiusSq = float(Outer * Outer);
+
+		const int32 Y0 = FMath::Max(MinY, Circle.CenterY - Outer);
+		const int32 Y1 = FMath::Min(MaxY, Circle.CenterY + Outer);
+		const int32 X0 = FMath::Max(MinX, Circle.CenterX - Outer);
+		const int32 X1 = FMath::Min(MaxX, Circle.CenterX + Outer);
+
+		for (int32 Y = Y0; Y <= Y1; ++Y)
+		{
+			const int32 dY = Y - Circle.CenterY;
+			PixelType* Row = Pixels + Y * TexSize;
+			for (int32 X = X0; X <= X1; ++X)
+			{
+				const int32 dX = X - Circle.CenterX;
+				const float DistSq = float(dX*dX + dY*dY);
+				if (DistSq > OuterRadiusSq)
+				{
+					continue;
+				}
+
+				float Intensity;
+				if (DistSq <= HardRadiusSq)
+				{
+					Intensity = 1.0f;
+				}
+				else
+				{
+					const float Dist   = FMath::Sqrt(DistSq);
+					const float Delta  = (Dist - float(HardRadius)) / float(FalloffPixels); // 0..1
+					Intensity          = FMath::Clamp(1.0f - Delta, 0.0f, 1.0f);
+				}
+
+				WriteGray(Row[X], uint8(FMath::RoundToInt(Intensity * 255.0f)));
+			}
+		}
+	}
+
+	// Clears every dirty block, then redraws the parts of all circles that overlap one.
+	template<typename PixelType>
+	void RedrawDirtyBlocks(TArray<PixelType>& Pixels, int32 TexSize, const TArray<uint64>& Circles, const TBitArray<>& DirtyBlocks)
+	{
+		const int32 BlocksPerSide = FMath::DivideAndRoundUp(TexSize, FogBlockSize);
+
+		for (TConstSetBitIterator<> It(DirtyBlocks); It; ++It)
+		{
+			const int32 BX = It.GetIndex() % BlocksPerSide;
+			const int32 BY = It.GetIndex() / BlocksPerSide;
+			const int32 X0 = BX * FogBlockSize;
+			const int32 X1 = FMath::Min(X0 + FogBlockSize, TexSize);
+			for (int32 Y = BY * FogBlockSize; Y < FMath::Min((BY + 1) * FogBlockSize, TexSize); ++Y)
+			{
+				PixelType* Row = Pixels.GetData() + Y * TexSize;
+				for (int32 X = X0; X < X1; ++X)
+				{
+					ClearPixel(Row[X]);
+				}
+			}
+		}
+
+		for (const uint64 Key : Circles)
+		{
+			const FCircle Circle = UnpackCircle(Key);
+			const FIntRect Blocks = GetCircleBlocks(Circle, TexSize);
+			for (int32 BY = Blocks.Min.Y; BY <= Blocks.Max.Y; ++BY)
+			{
+				for (int32 BX = Blocks.Min.X; BX <= Blocks.Max.X; ++BX)
+				{
+					if (DirtyBlocks[BY * BlocksPerSide + BX])
+					{
+						DrawCircleClipped(Pixels.GetData(), TexSize, Circle,
+							BX * FogBlockSize, BY * FogBlockSize,
+							FMath::Min((BX + 1) * FogBlockSize, TexSize) - 1,
+							FMath::Min((BY + 1) * FogBlockSize, TexSize) - 1);
+					}
+				}
+			}
+		}
+	}
+
+	// Uploads each horizontal run of dirty blocks as one texture region. The rows are copied into a packed
+	// staging buffer owned by the render command, so later updates can't race the upload.
+	template<typename PixelType>
+	void UploadDirtyBlocks(UTexture2D* Texture, const TArray<PixelType>& Pixels, int32 TexSize, const TBitArray<>& DirtyBlocks)
+	{
+		const int32 BlocksPerSide = FMath::DivideAndRoundUp(TexSize, FogBlockSize);
+
+		TArray<FUpdateTextureRegion2D> Runs;
+		int32 MaxWidth = 0;
+		int32 TotalHeight = 0;
+		for (int32 BY = 0; BY < BlocksPerSide; ++BY)
+		{
+			for (int32 BX = 0; BX < BlocksPerSide; ++BX)
+			{
+				if (!DirtyBlocks[BY * BlocksPerSide + BX])
+				{
+					continue;
+				}
+
+				const int32 RunStart = BX;
+				while (BX + 1 < BlocksPerSide && DirtyBlocks[BY * BlocksPerSide + BX + 1])
+				{
+					++BX;
+				}
+
+				const int32 X = RunStart * FogBlockSize;
+				const int32 Y = BY * FogBlockSize;
+				const int32 Width = FMath::Min((BX + 1) * FogBlockSize, TexSize) - X;
+				const int32 Height = FMath::Min(Y + FogBlockSize, TexSize) - Y;
+				Runs.Add(FUpdateTextureRegion2D(X, Y, 0, TotalHeight, Width, Height));
+				MaxWidth = FMath::Max(MaxWidth, Width);
+				TotalHeight += Height;
+			}
+		}
+
+		if (Runs.Num() == 0)
+		{
+			return;
+		}
+
+		PixelType* Staging = static_cast<PixelType*>(FMemory::Malloc(SIZE_T(MaxWidth) * TotalHeight * sizeof(PixelType)));
+		FUpdateTextureRegion2D* Regions = new FUpdateTextureRegion2D[Runs.Num()];
+		for (int32 i = 0; i < Runs.Num(); ++i)
+		{
+			const FUpdateTextureRegion2D& Run = Runs[i];
+			Regions[i] = Run;
+			for (uint32 Row = 0; Row < Run.Height; ++Row)
+			{
+				FMemory::Memcpy(
+					Staging + (Run.SrcY + Row) * MaxWidth,
+					Pixels.GetData() + (Run.DestY + Row) * TexSize + Run.DestX,
+					Run.Width * sizeof(PixelType));
+			}
+		}
+
+		Texture->UpdateTextureRegions(
+			0, Runs.Num(), Regions,
+			MaxWidth * sizeof(PixelType),
+			sizeof(PixelType),
+			reinterpret_cast<uint8*>(Staging),
+			[](uint8* SrcData, const FUpdateTextureRegion2D* InRegions)
+			{
+				FMemory::Free(SrcData);
+				delete[] InRegions;
+			});
+	}
+}
+
 // Sets default values
 AFogActor::AFogActor()
 {
@@ -94,10 +308,10 @@ void AFogActor::InitFogMaskTexture()
 	// Create transient texture if needed
 	if (!FogMaskTexture)
 	{
-		FogMaskTexture = UTexture2D::CreateTransient(FogTexSize, FogTexSize, PF_B8G8R8A8);
+		FogMaskTexture = UTexture2D::CreateTransient(FogTexSize, FogTexSize, bUseSingleChannelFogMask ? PF_G8 : PF_B8G8R8A8);
 		check(FogMaskTexture);
 		FogMaskTexture->SRGB = false;
-		FogMaskTexture->CompressionSettings = TC_VectorDisplacementmap;
+		FogMaskTexture->CompressionSettings = bUseSingleChannelFogMask ? TC_Grayscale : TC_VectorDisplacementmap;
 		
 		// --- ADD THESE LINES TO PREVENT REPETITION ---
 		FogMaskTexture->AddressX = TA_Clamp;
@@ -108,23 +322,36 @@ void AFogActor::InitFogMaskTexture()
 		FogMaskTexture->UpdateResource();
 	}
 
-	// Allocate and clear pixel buffer once
-	FogPixels.SetNum(FogTexSize * FogTexSize);
-	for (FColor& Pixel : FogPixels)
+	// Allocate and clear pixel buffer once; only the buffer matching the texture format is used
+	if (bUseSingleChannelFogMask)
+	{
+		FogPixels.Empty();
+		FogPixelsR8.Init(0, FogTexSize * FogTexSize);
+	}
+	else
 	{
-		Pixel = FColor::Black;
+		FogPixelsR8.Empty();
+		FogPixels.Init(FColor::Black, FogTexSize * FogTexSize);
 	}
 
 	// Upload an initial black mask so the material has valid data immediately
+	// and start the incremental rasterizer from an empty circle set.
+	PreviousFogCircles.Reset();
+	DirtyFogBlocks.Init(true, FMath::Square(FMath::DivideAndRoundUp(FogTexSize, FogRaster::FogBlockSize)));
+	bFogMaskNeedsFullRedraw = false;
+	RasterizedFogMinBounds = FogMinBounds;
+	RasterizedFogMaxBounds = FogMaxBounds;
+
 	if (FogMaskTexture)
 	{
-		FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, FogTexSize, FogTexSize);
-		FogMaskTexture->UpdateTextureRegions(
-			0, 1, Region,
-			FogTexSize * sizeof(FColor),
-			sizeof(FColor),
-			reinterpret_cast<uint8*>(FogPixels.GetData())
-		);
+		if (bUseSingleChannelFogMask)
+		{
+			FogRaster::UploadDirtyBlocks(FogMaskTexture, FogPixelsR8, FogTexSize, DirtyFogBlocks);
+		}
+		else
+		{
+			FogRaster::UploadDirtyBlocks(FogMaskTexture, FogPixels, FogTexSize, DirtyFogBlocks);
+		}
 	}
 }
 
@@ -183,205 +410,144 @@ void AFogActor::SetFogBounds(const FVector2D& Min, const FVector2D& Max)
 }
 
 void AFogActor::UpdateFogMaskWithCircles_Local(
-    const TArray<FVector_NetQuantize>& Positions,
-    const TArray<float>&              WorldRadii,
-    const TArray<uint8>&              UnitTeamIds)
+	const TArray<FVector_NetQuantize>& Positions,
+	const TArray<float>&              WorldRadii,
+	const TArray<uint8>&              UnitTeamIds)
 {
-    if (!FogMaskTexture)
-    {
-        return;
-    }
-
-    // 1) Clear mask to black
-    for (FColor& Pixel : FogPixels)
-    {
-        Pixel = FColor::Black;
-    }
-
-    // 2) Precompute for pixel conversion
-    const float WorldExtentX = FogMaxBounds.X - FogMinBounds.X;
-    const float WorldExtentY = FogMaxBounds.Y - FogMinBounds.Y;
-
-    // 3) Loop over the parallel arrays
-    ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(GetWorld()->GetFirstPlayerController());
-    int64 LocalAllianceMask = CustomPC ? CustomPC->AlliedTeamsMask : (1LL << TeamId);
-
-    const int32 Count = FMath::Min3(Positions.Num(), WorldRadii.Num(), UnitTeamIds.Num());
-    for (int32 i = 0; i < Count; ++i)
-    {
-        // 3a) Team filter
-        if (UnitTeamIds[i] != TeamId)
-        {
-            if (!(LocalAllianceMask & (1LL << UnitTeamIds[i])))
-            {
-                continue;
-            }
-        }
-
-        // 3b) Compute pixel‐space center
-        const FVector WorldPos = Positions[i];
-        const float U = (WorldPos.X - FogMinBounds.X) / WorldExtentX;
-        const float V = (WorldPos.Y - FogMinBounds.Y) / WorldExtentY;
-        const int32 CenterX = FMath::Clamp(FMath::RoundToInt(U * FogTexSize), 0, FogTexSize - 1);
-        const int32 CenterY = FMath::Clamp(FMath::RoundToInt(V * FogTexSize), 0, FogTexSize - 1);
-
-        // 3c) Compute soft circle radii in pixels
-        const float Normalized = WorldRadii[i] / WorldExtentX;  
-        int32 HardRadius = FMath::RoundToInt(Normalized * FogTexSize);
-        HardRadius = FMath::Clamp(HardRadius, 0, FogTexSize - 1);
-        const int32 FalloffPixels = FMath::Max(1, HardRadius / 10);
-
-        const float HardRadiusSq  = float(HardRadius * HardRadius);
-        const float OuterRadiusSq = float((HardRadius + FalloffPixels) * (HardRadius + FalloffPixels));
-
-        // 3d) Draw the circle into FogPixels
-        for (int32 dY = - (HardRadius + FalloffPixels); dY <= (HardRadius + FalloffPixels); ++dY)
-        {
-            const int32 Y = CenterY + dY;
-            if (Y < 0 || Y >= FogTexSize) continue;
-
-            FColor* Row = FogPixels.GetData() + Y * FogTexSize;
-            for (int32 dX = - (HardRadius + FalloffPixels); dX <= (HardRadius + FalloffPixels); ++dX)
-            {
-                const int32 X = CenterX + dX;
-                if (X < 0 || X >= FogTexSize) continue;
-
-                const float DistSq = float(dX*dX + dY*dY);
-                if (DistSq > OuterRadiusSq)
-                {
-                    continue;
-                }
-
-                float Intensity;
-                if (DistSq <= HardRadiusSq)
-                {
-                    Intensity = 1.0f;
-                }
-                else
-                {
-                    const float Dist   = FMath::Sqrt(DistSq);
-                    const float Delta  = (Dist - float(HardRadius)) / float(FalloffPixels); // 0..1
-                    Intensity          = FMath::Clamp(1.0f - Delta, 0.0f, 1.0f);
-                }
-
-                const uint8 Gray = uint8(FMath::RoundToInt(Intensity * 255.0f));
-                FColor& Pixel    = Row[X];
-                if (Gray > Pixel.R)  // since R=G=B
-                {
-                    Pixel = FColor(Gray, Gray, Gray, 255);
-                }
-            }
-        }
-    }
-
-    // 4) Upload updated pixels to the GPU texture
-    FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, FogTexSize, FogTexSize);
-    FogMaskTexture->UpdateTextureRegions(
-        0, 1, Region,
-        FogTexSize * sizeof(FColor),
-        sizeof(FColor),
-        reinterpret_cast<uint8*>(FogPixels.GetData())
-    );
+	RasterizeFogCircles(Positions, WorldRadii, UnitTeamIds);
 }
 
 void AFogActor::Multicast_UpdateFogMaskWithCircles_Implementation(
-    const TArray<FVector_NetQuantize>& Positions,
-    const TArray<float>&              WorldRadii,
-    const TArray<uint8>&              UnitTeamIds)
+	const TArray<FVector_NetQuantize>& Positions,
+	const TArray<float>&              WorldRadii,
+	const TArray<uint8>&              UnitTeamIds)
+{
+	RasterizeFogCircles(Positions, WorldRadii, UnitTeamIds);
+}
+
+void AFogActor::RasterizeFogCircles(
+	const TArray<FVector_NetQuantize>& Positions,
+	const TArray<float>&              WorldRadii,
+	const TArray<uint8>&              UnitTeamIds)
 {
-    if (!FogMaskTexture)
-    {
-        return;
-    }
-
-    // 1) Clear mask to black
-    for (FColor& Pixel : FogPixels)
-    {
-        Pixel = FColor::Black;
-    }
-
-    // 2) Precompute for pixel conversion
-    const float WorldExtentX = FogMaxBounds.X - FogMinBounds.X;
-    const float WorldExtentY = FogMaxBounds.Y - FogMinBounds.Y;
-
-    // 3) Loop over the parallel arrays
-    ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(GetWorld()->GetFirstPlayerController());
-    int64 LocalAllianceMask = CustomPC ? CustomPC->AlliedTeamsMask : (1LL << TeamId);
-
-    const int32 Count = FMath::Min3(Positions.Num(), WorldRadii.Num(), UnitTeamIds.Num());
-    for (int32 i = 0; i < Count; ++i)
-    {
-        // 3a) Team filter
-        if (UnitTeamIds[i] != TeamId)
-        {
-            if (!(LocalAllianceMask & (1LL << UnitTeamIds[i])))
-            {
-                continue;
-            }
-        }
-
-        // 3b) Compute pixel‐space center
-        const FVector WorldPos = Positions[i];
-        const float U = (WorldPos.X - FogMinBounds.X) / WorldExtentX;
-        const float V = (WorldPos.Y - FogMinBounds.Y) / WorldExtentY;
-        const int32 CenterX = FMath::Clamp(FMath::RoundToInt(U * FogTexSize), 0, FogTexSize - 1);
-        const int32 CenterY = FMath::Clamp(FMath::RoundToInt(V * FogTexSize), 0, FogTexSize - 1);
-
-        // 3c) Compute soft circle radii in pixels
-        const float Normalized = WorldRadii[i] / WorldExtentX;  
-        int32 HardRadius = FMath::RoundToInt(Normalized * FogTexSize);
-        HardRadius = FMath::Clamp(HardRadius, 0, FogTexSize - 1);
-        const int32 FalloffPixels = FMath::Max(1, HardRadius / 10);
-
-        const float HardRadiusSq  = float(HardRadius * HardRadius);
-        const float OuterRadiusSq = float((HardRadius + FalloffPixels) * (HardRadius + FalloffPixels));
-
-        // 3d) Draw the circle into FogPixels
-        for (int32 dY = - (HardRadius + FalloffPixels); dY <= (HardRadius + FalloffPixels); ++dY)
-        {
-            const int32 Y = CenterY + dY;
-            if (Y < 0 || Y >= FogTexSize) continue;
-
-            FColor* Row = FogPixels.GetData() + Y * FogTexSize;
-            for (int32 dX = - (HardRadius + FalloffPixels); dX <= (HardRadius + FalloffPixels); ++dX)
-            {
-                const int32 X = CenterX + dX;
-                if (X < 0 || X >= FogTexSize) continue;
-
-                const float DistSq = float(dX*dX + dY*dY);
-                if (DistSq > OuterRadiusSq)
-                {
-                    continue;
-                }
-
-                float Intensity;
-                if (DistSq <= HardRadiusSq)
-                {
-                    Intensity = 1.0f;
-                }
-                else
-                {
-                    const float Dist   = FMath::Sqrt(DistSq);
-                    const float Delta  = (Dist - float(HardRadius)) / float(FalloffPixels); // 0..1
-                    Intensity          = FMath::Clamp(1.0f - Delta, 0.0f, 1.0f);
-                }
-
-                const uint8 Gray = uint8(FMath::RoundToInt(Intensity * 255.0f));
-                FColor& Pixel    = Row[X];
-                if (Gray > Pixel.R)  // since R=G=B
-                {
-                    Pixel = FColor(Gray, Gray, Gray, 255);
-                }
-            }
-        }
-    }
-
-    // 4) Upload updated pixels to the GPU texture
-    FUpdateTextureRegion2D* Region = new FUpdateTextureRegion2D(0, 0, 0, 0, FogTexSize, FogTexSize);
-    FogMaskTexture->UpdateTextureRegions(
-        0, 1, Region,
-        FogTexSize * sizeof(FColor),
-        sizeof(FColor),
-        reinterpret_cast<uint8*>(FogPixels.GetData())
-    );
-}
\ No newline at end of file
+	if (!FogMaskTexture)
+	{
+		return;
+	}
+
+	// The buffer matching the texture format must exist (format/size are fixed at InitFogMaskTexture)
+	const int32 NumPixels = bUseSingleChannelFogMask ? FogPixelsR8.Num() : FogPixels.Num();
+	if (NumPixels != FogTexSize * FogTexSize)
+	{
+		return;
+	}
+
+	// 1) Precompute for pixel conversion
+	const float WorldExtentX = FogMaxBounds.X - FogMinBounds.X;
+	const float WorldExtentY = FogMaxBounds.Y - FogMinBounds.Y;
+
+	// 2) Convert the visible sight circles to pixel space
+	ACustomControllerBase* CustomPC = Cast<ACustomControllerBase>(GetWorld()->GetFirstPlayerController());
+	int64 LocalAllianceMask = CustomPC ? CustomPC->AlliedTeamsMask : (1LL << TeamId);
+
+	CurrentFogCircles.Reset();
+	const int32 Count = FMath::Min3(Positions.Num(), WorldRadii.Num(), UnitTeamIds.Num());
+	for (int32 i = 0; i < Count; ++i)
+	{
+		// 2a) Team filter
+		if (UnitTeamIds[i] != TeamId)
+		{
+			if (!(LocalAllianceMask & (1LL << UnitTeamIds[i])))
+			{
+				continue;
+			}
+		}
+
+		// 2b) Compute pixel-space center
+		const FVector WorldPos = Positions[i];
+		const float U = (WorldPos.X - FogMinBounds.X) / WorldExtentX;
+		const float V = (WorldPos.Y - FogMinBounds.Y) / WorldExtentY;
+		const int32 CenterX = FMath::Clamp(FMath::RoundToInt(U * FogTexSize), 0, FogTexSize - 1);
+		const int32 CenterY = FMath::Clamp(FMath::RoundToInt(V * FogTexSize), 0, FogTexSize - 1);
+
+		// 2c) Compute hard radius in pixels (falloff is derived from it)
+		const float Normalized = WorldRadii[i] / WorldExtentX;
+		int32 HardRadius = FMath::RoundToInt(Normalized * FogTexSize);
+		HardRadius = FMath::Clamp(HardRadius, 0, FogTexSize - 1);
+
+		CurrentFogCircles.Add(FogRaster::PackCircle(CenterX, CenterY, HardRadius));
+	}
+	CurrentFogCircles.Sort();
+
+	// 3) Find the blocks whose content changed since the last update
+	const int32 BlocksPerSide = FMath::DivideAndRoundUp(FogTexSize, FogRaster::FogBlockSize);
+	const int32 NumBlocks = BlocksPerSide * BlocksPerSide;
+
+	if (RasterizedFogMinBounds != FogMinBounds || RasterizedFogMaxBounds != FogMaxBounds || DirtyFogBlocks.Num() != NumBlocks)
+	{
+		RasterizedFogMinBounds = FogMinBounds;
+		RasterizedFogMaxBounds = FogMaxBounds;
+		bFogMaskNeedsFullRedraw = true;
+	}
+
+	bool bAnyDirty = false;
+	if (bFogMaskNeedsFullRedraw)
+	{
+		DirtyFogBlocks.Init(true, NumBlocks);
+		bAnyDirty = true;
+	}
+	else
+	{
+		DirtyFogBlocks.Init(false, NumBlocks);
+
+		// Both lists are sorted: a merge walk yields the circles that appeared or disappeared.
+		int32 PrevIndex = 0;
+		int32 CurIndex = 0;
+		while (PrevIndex < PreviousFogCircles.Num() || CurIndex < CurrentFogCircles.Num())
+		{
+			uint64 Changed;
+			if (CurIndex >= CurrentFogCircles.Num() || (PrevIndex < PreviousFogCircles.Num() && PreviousFogCircles[PrevIndex] < CurrentFogCircles[CurIndex]))
+			{
+				Changed = PreviousFogCircles[PrevIndex++];
+			}
+			else if (PrevIndex >= PreviousFogCircles.Num() || CurrentFogCircles[CurIndex] < PreviousFogCircles[PrevIndex])
+			{
+				Changed = CurrentFogCircles[CurIndex++];
+			}
+			else
+			{
+				++PrevIndex;
+				++CurIndex;
+				continue;
+			}
+
+			const FIntRect Blocks = FogRaster::GetCircleBlocks(FogRaster::UnpackCircle(Changed), FogTexSize);
+			for (int32 BY = Blocks.Min.Y; BY <= Blocks.Max.Y; ++BY)
+			{
+				for (int32 BX = Blocks.Min.X; BX <= Blocks.Max.X; ++BX)
+				{
+					DirtyFogBlocks[BY * BlocksPerSide + BX] = true;
+				}
+			}
+			bAnyDirty = true;
+		}
+	}
+
+	// 4) Redraw and upload the dirty blocks only
+	if (bAnyDirty)
+	{
+		if (bUseSingleChannelFogMask)
+		{
+			FogRaster::RedrawDirtyBlocks(FogPixelsR8, FogTexSize, CurrentFogCircles, DirtyFogBlocks);
+			FogRaster::UploadDirtyBlocks(FogMaskTexture, FogPixelsR8, FogTexSize, DirtyFogBlocks);
+		}
+		else
+		{
+			FogRaster::RedrawDirtyBlocks(FogPixels, FogTexSize, CurrentFogCircles, DirtyFogBlocks);
+			FogRaster::UploadDirtyBlocks(FogMaskTexture, FogPixels, FogTexSize, DirtyFogBlocks);
+		}
+	}
+
+	bFogMaskNeedsFullRedraw = false;
+	Swap(PreviousFogCircles, CurrentFogCircles);
+}
@@ -98,6 +98,7 @@ void APickup::Tick(float DeltaTime)
 					{
 						UnitBase->SelectableAbilities.AddUnique(PickupAbility);
 						UnitBase->GetSelectedAbilitiesArray(PickupAbility);
+						UnitBase->NotifyLevelDataChanged(); // Ability chooser shows the new selectable ability
 					}
 					
 				}
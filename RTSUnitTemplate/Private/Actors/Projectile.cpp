@@ -25,9 +25,27 @@
 #include "Core/CollisionUtils.h"
 #include "Mass/MassActorBindingComponent.h"
 #include "Mass/Projectile/ProjectileVisualManager.h"
+#include "System/ProjectilePoolSubsystem.h"
+#include "GameFramework/GameStateBase.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_ProjectileClientSimulation(
+	TEXT("RTS.Projectile.ClientSimulation"),
+	1,
+	TEXT("Actor projectiles (bUseMass = false): 1 = clients simulate the flight from the launch state, the server only sends retarget/impact events; 0 = multicast the transform every tick. Read at launch."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRTS_ProjectileHomingCorrectionInterval(
+	TEXT("RTS.Projectile.HomingCorrectionInterval"),
+	0.25f,
+	TEXT("Seconds between server corrections of client-simulated homing projectiles. 0 = no correction."),
+	ECVF_Default);
 
 namespace
 {
+	// Upper bound for the launch latency a client fast-forwards on its first simulated step.
+	constexpr float MaxClientCatchUpSeconds = 0.5f;
+
 	FVector ComputeImpactSurfaceXY(const FVector& IncomingLocation, const AActor* Target)
 	{
 		return FCollisionUtils::ComputeImpactSurfaceXY(nullptr, Target, IncomingLocation);
@@ -271,7 +289,7 @@ void AProjectile::InitForLocationPosition(FVector Aim, AActor* ShootingActor)
 	if (FlightDirection.IsNearlyZero())
 	{
 		// The target is the same as the start, destroy the projectile to prevent errors
-		Destroy();
+		DestroyProjectile();
 		return;
 	}
 
@@ -343,6 +361,150 @@ void AProjectile::BeginPlay()
 	// 3) Zur Sicherheit: keine Actor-Transform-Replikation für das Template
 	// (die Mass-Visuals kommen aus dem VisualManager)
 	SetReplicateMovement(false);
+
+	// 4) Actor-Modus: Server entscheidet, ob Clients den Flug selbst simulieren
+	LaunchActorMode();
+}
+
+void AProjectile::LaunchActorMode()
+{
+	if (bUseMass)
+	{
+		return;
+	}
+
+	if (HasAuthority())
+	{
+		bClientSimulated = CVarRTS_ProjectileClientSimulation.GetValueOnGameThread() != 0;
+		if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+		{
+			LaunchServerTime = GameState->GetServerWorldTimeSeconds();
+		}
+	}
+	// Simulating clients fly their own copy, so each side needs a flight instance (the preview was removed).
+	if (bClientSimulated)
+	{
+		InitISMComponent(GetActorTransform());
+	}
+}
+
+void AProjectile::ResetProjectileState()
+{
+	const AProjectile* Defaults = GetClass()->GetDefaultObject<AProjectile>();
+
+	// Launch
+	Target = nullptr;
+	Shooter = nullptr;
+	SetOwner(nullptr);
+	TargetLocation = FVector::ZeroVector;
+	ShooterLocation = FVector::ZeroVector;
+	FlightDirection = FVector::ZeroVector;
+	RotationOffset = Defaults->RotationOffset;
+	bIsInitialized = false;
+	bUseMass = Defaults->bUseMass;
+	TeamId = Defaults->TeamId;
+	Damage = Defaults->Damage;
+	UseAttributeDamage = Defaults->UseAttributeDamage;
+	IsHealing = Defaults->IsHealing;
+	ProjectileEffect = Defaults->ProjectileEffect;
+	ProjectileEffect2 = Defaults->ProjectileEffect2;
+	ProjectileEffect3 = Defaults->ProjectileEffect3;
+
+	// Flight (Init* randomises the homing values and the speed in place)
+	MovementSpeed = Defaults->MovementSpeed;
+	FollowTarget = Defaults->FollowTarget;
+	HomingMissleCount = Defaults->HomingMissleCount;
+	HomingOffset = FVector::ZeroVector;
+	HomingInitialAngle = Defaults->HomingInitialAngle;
+	HomingRotationSpeed = Defaults->HomingRotationSpeed;
+	HomingMaxSpiralRadius = Defaults->HomingMaxSpiralRadius;
+	ArcStartLocation = FVector::ZeroVector;
+	ArcTravelTime = 0.f;
+	LifeTime = 0.f;
+	OverlapCheckTimer = 0.f;
+	HomingCorrectionTimer = 0.f;
+	PreviousLocation = FVector::ZeroVector;
+
+	// Pierce, bounce and impact
+	MaxPiercedTargets = Defaults->MaxPiercedTargets;
+	PiercedTargets = Defaults->PiercedTargets;
+	PiercedActors.Reset();
+	IsBouncingNext = Defaults->IsBouncingNext;
+	IsBouncingBack = Defaults->IsBouncingBack;
+	BouncedBack = false;
+	bImpacted = false;
+	LastWallHitLocation = FVector::ZeroVector;
+}
+
+void AProjectile::EnterPool()
+{
+	bInPool = true;
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	SetActorTickEnabled(false);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	if (ISMComponent)
+	{
+		ISMComponent->ClearInstances();
+		InstanceIndex = INDEX_NONE;
+	}
+	if (Niagara_A) Niagara_A->Deactivate();
+	if (Niagara_B) Niagara_B->Deactivate();
+}
+
+void AProjectile::LeavePool(const FTransform& Transform)
+{
+	bInPool = false;
+	ResetProjectileState();
+	SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+void AProjectile::Relaunch(const FTransform& Transform)
+{
+	SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	// EnterPool removed the flight instance and OnConstruction does not run again for a reused actor;
+	// the server flies every actor projectile on it, client-simulated or not.
+	InitISMComponent(Transform);
+	LaunchActorMode();
+	RestoreLaunchVisuals();
+
+	LaunchTransform = Transform;
+	++LaunchSerial;
+}
+
+void AProjectile::RestoreLaunchVisuals()
+{
+	if (Niagara_A) Niagara_A->Activate(true);
+	if (Niagara_B) Niagara_B->Activate(true);
+	// Not SetVisibility(true): that would force the new flight instance to unit scale and drop the
+	// projectile scale of the launch transform. The instance is fresh and visible already.
+	if (Niagara_A) Niagara_A->SetVisibility(true);
+	if (Niagara_B) Niagara_B->SetVisibility(true);
+}
+
+void AProjectile::OnRep_LaunchSerial()
+{
+	// The first launch of an actor is handled by BeginPlay.
+	if (!HasActorBegunPlay())
+	{
+		return;
+	}
+
+	SetActorTransform(LaunchTransform, false, nullptr, ETeleportType::TeleportPhysics);
+	OverlapCheckTimer = 0.f;
+	HomingCorrectionTimer = 0.f;
+	bClientCaughtUp = false;
+	if (ISMComponent)
+	{
+		ISMComponent->ClearInstances();
+		InstanceIndex = INDEX_NONE;
+	}
+	// Rebuilt whether or not the client simulates: multicast transform updates move this instance too.
+	InitISMComponent(GetActorTransform());
+	RestoreLaunchVisuals();
 }
 
 void AProjectile::InitArc(FVector ArcBeginLocation)
@@ -415,11 +577,20 @@ void AProjectile::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLi
 	DOREPLIFETIME(AProjectile, bImpacted);
 	DOREPLIFETIME(AProjectile, ArcStartLocation);
 	DOREPLIFETIME(AProjectile, ArcTravelTime);
+	DOREPLIFETIME(AProjectile, bClientSimulated);
+	DOREPLIFETIME(AProjectile, LaunchServerTime);
+	DOREPLIFETIME(AProjectile, LaunchSerial);
+	DOREPLIFETIME(AProjectile, LaunchTransform);
 }
 
 // Implement the new multicast function to update clients
 void AProjectile::OnRep_bImpacted()
 {
+	// A pooled relaunch clears the flag again.
+	if (!bImpacted)
+	{
+		return;
+	}
 	SetVisibility(false);
 	SetActorHiddenInGame(true);
 	if (ISMComponent)
@@ -429,6 +600,62 @@ void AProjectile::OnRep_bImpacted()
 }
 
 void AProjectile::Multicast_UpdateISMTransform_Implementation(const FTransform& NewTransform)
+{
+	ApplyISMTransform(NewTransform);
+}
+
+void AProjectile::Multicast_Retarget_Implementation(const FTransform& CurrentTransform, AActor* NewTarget, FVector_NetQuantize NewTargetLocation, FVector_NetQuantizeNormal NewFlightDirection)
+{
+	if (HasAuthority())
+	{
+		return;
+	}
+	Target = NewTarget;
+	TargetLocation = NewTargetLocation;
+	FlightDirection = NewFlightDirection;
+	ApplyISMTransform(CurrentTransform);
+}
+
+void AProjectile::Multicast_CorrectISMTransform_Implementation(const FTransform& NewTransform)
+{
+	if (!HasAuthority())
+	{
+		ApplyISMTransform(NewTransform);
+	}
+}
+
+void AProjectile::MoveISMInstance(const FTransform& NewTransform)
+{
+	// Clients only ever move their own copy; a multicast called there would execute locally anyway.
+	if (bClientSimulated || !HasAuthority())
+	{
+		ApplyISMTransform(NewTransform);
+		return;
+	}
+	Multicast_UpdateISMTransform(NewTransform);
+}
+
+void AProjectile::SendRetarget()
+{
+	if (!bClientSimulated || !HasAuthority() || bImpacted)
+	{
+		return;
+	}
+	Multicast_Retarget(GetFlightTransform(), Target, TargetLocation, FlightDirection);
+}
+
+FTransform AProjectile::GetFlightTransform() const
+{
+	FTransform InstanceXform;
+	if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
+	{
+		ISMComponent->GetInstanceTransform(InstanceIndex, InstanceXform, true);
+		return InstanceXform;
+	}
+	return GetActorTransform();
+}
+
+void AProjectile::ApplyISMTransform(const FTransform& NewTransform)
 {
 	if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
 	{
@@ -497,6 +724,17 @@ void AProjectile::Tick(float DeltaTime)
 	}
 
 	Super::Tick(DeltaTime);
+
+	if (bClientSimulated && !bClientCaughtUp && !HasAuthority())
+	{
+		// The spawn arrives one trip late: fast-forward so the local flight lines up with the server's.
+		bClientCaughtUp = true;
+		if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+		{
+			DeltaTime += FMath::Clamp(GameState->GetServerWorldTimeSeconds() - LaunchServerTime, 0.f, MaxClientCatchUpSeconds);
+		}
+	}
+
 	CheckViewport();
 	LifeTime += DeltaTime;
 	
@@ -515,7 +753,7 @@ void AProjectile::Tick(float DeltaTime)
 			CurrentTransform.ConcatenateRotation(RotationDelta.Quaternion());
 			
 			// 4. Update locally.
-			Multicast_UpdateISMTransform(CurrentTransform);
+			MoveISMInstance(CurrentTransform);
 		}
 	}
 	if(LifeTime > MaxLifeTime && !FollowTarget)
@@ -532,7 +770,7 @@ void AProjectile::Tick(float DeltaTime)
 				return;
 			}
 		}
-		if (HasAuthority()) Destroy(true, false);
+		if (HasAuthority()) DestroyProjectile();
 	}else if(LifeTime > MaxLifeTime && FollowTarget)
 	{
 		if (HasAuthority() && Shooter && Target)
@@ -546,7 +784,7 @@ void AProjectile::Tick(float DeltaTime)
 				return;
 			}
 		}
-		if (HasAuthority()) Destroy(true, false);
+		if (HasAuthority()) DestroyProjectile();
 	}
  else if (bImpacted)
  {
@@ -564,6 +802,18 @@ void AProjectile::Tick(float DeltaTime)
 		FlyToLocationTarget(DeltaTime);
 	}
 
+	if (HasAuthority() && bClientSimulated && FollowTarget && !bImpacted)
+	{
+		// Homing flights depend on where the target is on each side, so clients get pulled back periodically.
+		const float CorrectionInterval = CVarRTS_ProjectileHomingCorrectionInterval.GetValueOnGameThread();
+		HomingCorrectionTimer += DeltaTime;
+		if (CorrectionInterval > 0.f && HomingCorrectionTimer >= CorrectionInterval)
+		{
+			HomingCorrectionTimer = 0.f;
+			Multicast_CorrectISMTransform(GetFlightTransform());
+		}
+	}
+
 	if (HasAuthority() && bCanBeRepelledByEnergyWall && !bImpacted)
 	{
 		FTransform CurrentTransform;
@@ -591,7 +841,7 @@ void AProjectile::Tick(float DeltaTime)
 				if (ISMComponent && ISMComponent->IsValidInstance(InstanceIndex))
 				{
 					CurrentTransform.SetLocation(HitResult.ImpactPoint);
-					Multicast_UpdateISMTransform(CurrentTransform);
+					MoveISMInstance(CurrentTransform);
 				}
 				else
 				{
@@ -721,7 +971,7 @@ void AProjectile::FlyToUnitTarget(float DeltaSeconds)
         NewTransform.SetRotation(FinalQuat);
     }
     
-    Multicast_UpdateISMTransform(NewTransform);
+    MoveISMInstance(NewTransform);
 
 
     // --- 5. Check for impact (Authority Only) ---
@@ -733,7 +983,7 @@ void AProjectile::FlyToUnitTarget(float DeltaSeconds)
         {
            // Snap to target location for precise impact
            NewTransform.SetLocation(TargetLocation);
-           Multicast_UpdateISMTransform(NewTransform);
+           MoveISMInstance(NewTransform);
            Impact(Target);
         }
     }
@@ -817,7 +1067,7 @@ void AProjectile::FlyToLocationTarget(float DeltaSeconds)
         NewTransform.SetRotation(FinalQuat);
     }
     
-    Multicast_UpdateISMTransform(NewTransform);
+    MoveISMInstance(NewTransform);
 
    	if (HasAuthority())
    	{
@@ -1006,7 +1256,7 @@ void AProjectile::FlyInArc(float DeltaTime)
     }
 
     // Update locally
-    Multicast_UpdateISMTransform(NewTransform);
+    MoveISMInstance(NewTransform);
 
     if (HasAuthority())
     {
@@ -1048,7 +1298,7 @@ void AProjectile::FlyInArc(float DeltaTime)
         {
             // Snap to target location for precise impact
             NewTransform.SetLocation(TargetLocation);
-            Multicast_UpdateISMTransform(NewTransform);
+            MoveISMInstance(NewTransform);
 
             if (Target && Distance <= FrameSpeed + CollisionRadius)
             {
@@ -1213,6 +1463,7 @@ void AProjectile::Impact(AActor* ImpactTarget)
 		}
 		
 		DestroyWhenMaxPierced();
+		SendRetarget();
 	}			
 }
 
@@ -1296,6 +1547,7 @@ void AProjectile::ImpactHeal(AActor* ImpactTarget)
 		SetNextBouncing(ShootingUnit, UnitToHit);
 		SetBackBouncing(ShootingUnit);
 		DestroyWhenMaxPierced();
+		SendRetarget();
 	}			
 }
 
@@ -1462,12 +1714,17 @@ void AProjectile::DestroyProjectileWithDelay()
 			ISMComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 		}
 	}
-	FTimerHandle TimerHandle;
-	GetWorld()->GetTimerManager().SetTimer(TimerHandle, this, &AProjectile::DestroyProjectile, DestructionDelayTime, false);
+	GetWorld()->GetTimerManager().SetTimer(DestroyTimerHandle, this, &AProjectile::DestroyProjectile, DestructionDelayTime, false);
 }
 
 void AProjectile::DestroyProjectile()
 {
+	UProjectilePoolSubsystem* Pool = GetWorld() ? GetWorld()->GetSubsystem<UProjectilePoolSubsystem>() : nullptr;
+	if (Pool && HasAuthority())
+	{
+		Pool->ReleaseProjectile(this);
+		return;
+	}
 	Destroy(true, false);
 }
 
@@ -3,6 +3,7 @@
 #include "Net/UnrealNetwork.h"
 #include "EngineUtils.h"
 #include "Engine/Engine.h"
+#include "System/HudEventSubsystem.h"
 
 AWinLoseConfigActor::AWinLoseConfigActor()
 {
@@ -30,16 +31,38 @@ void AWinLoseConfigActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 void AWinLoseConfigActor::BeginPlay()
 {
 	Super::BeginPlay();
+	// Widgets constructed before this config replicated pick it up here.
+	NotifyHud();
 }
 
 void AWinLoseConfigActor::OnRep_CurrentWinConditionIndex()
 {
 	OnWinConditionChanged.Broadcast(this, GetCurrentWinCondition());
+	NotifyHud();
 }
 
 void AWinLoseConfigActor::OnRep_TagProgress()
 {
 	OnTagProgressUpdated.Broadcast(this);
+	NotifyHud();
+}
+
+void AWinLoseConfigActor::SetTagProgress(TArray<FTagProgress>&& NewTagProgress)
+{
+	if (TagProgress == NewTagProgress)
+	{
+		return;
+	}
+	TagProgress = MoveTemp(NewTagProgress);
+	OnRep_TagProgress();
+}
+
+void AWinLoseConfigActor::NotifyHud()
+{
+	if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+	{
+		HudEvents->NotifyWinConditionChanged(this);
+	}
 }
 
 EWinLoseCondition AWinLoseConfigActor::GetCurrentWinCondition() const
@@ -70,6 +93,7 @@ void AWinLoseConfigActor::AdvanceToNextWinCondition()
 {
 	CurrentWinConditionIndex++;
 	OnWinConditionChanged.Broadcast(this, GetCurrentWinCondition());
+	NotifyHud();
 }
 
 AWinLoseConfigActor* AWinLoseConfigActor::GetWinLoseConfigForTeam(const UObject* WorldContextObject, int32 MyTeamId)
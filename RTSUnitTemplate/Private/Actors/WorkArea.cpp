@@ -11,6 +11,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Characters/Unit/WorkingUnitBase.h"
 #include "Engine/Texture.h"
+#include "System/PlacementIndexSubsystem.h"
 
 
 // Sets default values
@@ -78,6 +79,10 @@ void AWorkArea::BeginPlay()
 	{
 		InitWorkerOverflowTimer();
 	}
+	if (UPlacementIndexSubsystem* PlacementIndex = GetWorld()->GetSubsystem<UPlacementIndexSubsystem>())
+	{
+		PlacementIndex->RegisterStructure(this);
+	}
 }
 
 void AWorkArea::InitWorkerOverflowTimer()
@@ -699,6 +704,10 @@ void AWorkArea::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(OverflowWorkersTimerHandle);
+		if (UPlacementIndexSubsystem* PlacementIndex = World->GetSubsystem<UPlacementIndexSubsystem>())
+		{
+			PlacementIndex->UnregisterStructure(this);
+		}
 	}
 }
 
@@ -5,106 +5,228 @@
 #include "HAL/PlatformMemory.h"
 #include "Logging/LogMacros.h"
 
-FSharedMemoryManager::FSharedMemoryManager(const FString& SharedMemoryName, size_t MemorySize)
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+FSharedMemoryManager::FSharedMemoryManager(const FString& SharedMemoryName)
 {
+    const SIZE_T MemorySize = sizeof(FRLSharedLayout);
+    void* MappedPtr = nullptr;
+
+#if PLATFORM_WINDOWS
     // Create a named shared memory mapping
-    FString MappingName = TEXT("Global\\") + SharedMemoryName;
-    MappingHandle = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, MemorySize, *MappingName);
+    MappingName = TEXT("Global\\") + SharedMemoryName;
+    MappingHandle = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)MemorySize, *MappingName);
+    bCreatedSegment = MappingHandle && GetLastError() != ERROR_ALREADY_EXISTS;
     UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Creating shared memory: Name=%s, Size=%zu, Handle=%p"), *MappingName, MemorySize, MappingHandle);
-    if (MappingHandle)
-    {
-       SharedDataPtr = (SharedData*) MapViewOfFile(MappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, MemorySize);
-       UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Mapping view of file: Handle=%p, Ptr=%p"), MappingHandle, SharedDataPtr);
-       if (SharedDataPtr)
-       {
-           // Initialize flags
-           SharedDataPtr->bNewGameStateAvailable = false;
-           SharedDataPtr->bNewActionAvailable = false;
-       }
-       else
-       {
-           UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] Failed to map view of file. Error=%d"), GetLastError());
-           CloseHandle(MappingHandle);
-           MappingHandle = nullptr;
-       }
-    }
-    else
+    if (!MappingHandle)
     {
         UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] Failed to create file mapping. Name=%s, Size=%zu, Error=%d"), *MappingName, MemorySize, GetLastError());
+        return;
+    }
+
+    MappedPtr = MapViewOfFile(MappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, MemorySize);
+    if (!MappedPtr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] Failed to map view of file. Error=%d"), GetLastError());
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+        return;
+    }
+#else
+    // POSIX shared memory object, visible as /dev/shm/<Name> on Linux.
+    // Create it exclusively so we know whether we own the name; otherwise attach to the trainer's segment.
+    MappingName = TEXT("/") + SharedMemoryName;
+    FileDescriptor = shm_open(TCHAR_TO_UTF8(*MappingName), O_CREAT | O_EXCL | O_RDWR, 0666);
+    bCreatedSegment = FileDescriptor >= 0;
+    if (FileDescriptor < 0 && errno == EEXIST)
+    {
+        FileDescriptor = shm_open(TCHAR_TO_UTF8(*MappingName), O_RDWR, 0666);
+    }
+    if (FileDescriptor < 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] shm_open failed. Name=%s, Error=%d"), *MappingName, errno);
+        return;
+    }
+
+    // Only size a segment we created; an attached one must already be large enough for the layout.
+    if (bCreatedSegment && ftruncate(FileDescriptor, (off_t)MemorySize) != 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] ftruncate failed. Name=%s, Size=%zu, Error=%d"), *MappingName, MemorySize, errno);
+        ReleasePosixDescriptor();
+        return;
+    }
+    struct stat SegmentStat;
+    if (!bCreatedSegment && (fstat(FileDescriptor, &SegmentStat) != 0 || SegmentStat.st_size < (off_t)MemorySize))
+    {
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] Existing shared memory is smaller than the layout. Name=%s, Size=%zu"), *MappingName, MemorySize);
+        ReleasePosixDescriptor();
+        return;
+    }
+
+    MappedPtr = mmap(nullptr, MemorySize, PROT_READ | PROT_WRITE, MAP_SHARED, FileDescriptor, 0);
+    if (MappedPtr == MAP_FAILED)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] mmap failed. Name=%s, Error=%d"), *MappingName, errno);
+        ReleasePosixDescriptor();
+        return;
+    }
+    UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] %s shared memory: Name=%s, Size=%zu"), bCreatedSegment ? TEXT("Created") : TEXT("Attached to"), *MappingName, MemorySize);
+#endif
+
+    Layout = static_cast<FRLSharedLayout*>(MappedPtr);
+    if (bCreatedSegment)
+    {
+        InitializeHeader();
+    }
+    else if (!IsHeaderCompatible())
+    {
+        // Never reset a segment someone else owns: its sequence counters belong to the running trainer.
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] Existing shared memory has an incompatible header. Name=%s, Magic=0x%08x, Version=%u (expected 0x%08x, %u)"),
+            *MappingName, Layout->Magic, Layout->Version, RLSharedMemory::Magic, RLSharedMemory::Version);
+        ReleaseMapping();
     }
 }
 
 FSharedMemoryManager::~FSharedMemoryManager()
 {
-    if (SharedDataPtr)
+    ReleaseMapping();
+}
+
+void FSharedMemoryManager::InitializeHeader()
+{
+    // Publish the header last: a trainer polling Magic/Version only attaches to an initialized ring.
+    Layout->Magic = 0;
+    new (&Layout->ObservationRing.WriteSeq) std::atomic<uint64>(0);
+    new (&Layout->ObservationRing.ReadSeq) std::atomic<uint64>(0);
+    new (&Layout->ActionRing.WriteSeq) std::atomic<uint64>(0);
+    new (&Layout->ActionRing.ReadSeq) std::atomic<uint64>(0);
+    Layout->Version = RLSharedMemory::Version;
+    Layout->ObservationSlots = RLSharedMemory::ObservationSlots;
+    Layout->ObservationRecordSize = sizeof(FRLObservationRecord);
+    Layout->ActionSlots = RLSharedMemory::ActionSlots;
+    Layout->ActionRecordSize = sizeof(FRLActionRecord);
+    FMemory::Memzero(Layout->Reserved);
+    std::atomic_thread_fence(std::memory_order_release);
+    Layout->Magic = RLSharedMemory::Magic;
+}
+
+bool FSharedMemoryManager::IsHeaderCompatible() const
+{
+    // Pairs with the release fence in InitializeHeader (or the trainer's equivalent) before Magic is published.
+    const uint32 SegmentMagic = Layout->Magic;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return SegmentMagic == RLSharedMemory::Magic
+        && Layout->Version == RLSharedMemory::Version
+        && Layout->ObservationSlots == RLSharedMemory::ObservationSlots
+        && Layout->ObservationRecordSize == sizeof(FRLObservationRecord)
+        && Layout->ActionSlots == RLSharedMemory::ActionSlots
+        && Layout->ActionRecordSize == sizeof(FRLActionRecord);
+}
+
+void FSharedMemoryManager::ReleaseMapping()
+{
+#if PLATFORM_WINDOWS
+    if (Layout)
     {
-       UnmapViewOfFile(SharedDataPtr);
-       UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Unmapped view of file: Ptr=%p"), SharedDataPtr);
-       SharedDataPtr = nullptr;
+        UnmapViewOfFile(Layout);
+        UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Unmapped view of file: Ptr=%p"), Layout);
+        Layout = nullptr;
     }
     if (MappingHandle)
     {
-       CloseHandle(MappingHandle);
-       UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Closed file mapping handle: Handle=%p"), MappingHandle);
-       MappingHandle = nullptr;
+        CloseHandle(MappingHandle);
+        UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Closed file mapping handle: Handle=%p"), MappingHandle);
+        MappingHandle = nullptr;
+    }
+#else
+    if (Layout)
+    {
+        munmap(Layout, sizeof(FRLSharedLayout));
+        Layout = nullptr;
     }
+    if (FileDescriptor >= 0)
+    {
+        ReleasePosixDescriptor();
+        UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Released shared memory: Name=%s"), *MappingName);
+    }
+#endif
 }
 
-
-
-bool FSharedMemoryManager::WriteGameState(const FString& GameStateJSON)
+#if !PLATFORM_WINDOWS
+void FSharedMemoryManager::ReleasePosixDescriptor()
 {
-    if (!SharedDataPtr)
+    close(FileDescriptor);
+    FileDescriptor = -1;
+    // Only the creator removes the name (so a restarted session starts from a clean ring);
+    // a segment the trainer created stays alive for the trainer.
+    if (bCreatedSegment)
     {
-       UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] SharedDataPtr is null in WriteGameState."));
-       return false;
+        shm_unlink(TCHAR_TO_UTF8(*MappingName));
+        bCreatedSegment = false;
     }
-    if (!SharedDataPtr->GameState)
+}
+#endif
+
+bool FSharedMemoryManager::WriteObservation(const FRLObservationRecord& Observation)
+{
+    if (!Layout)
     {
-        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] SharedDataPtr->GameState is null in WriteGameState. This should not happen if memory is allocated correctly."));
+        UE_LOG(LogTemp, Error, TEXT("[FSharedMemoryManager] Shared memory is not mapped in WriteObservation."));
         return false;
     }
 
-	//UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] WriteGameState called. GameStateJSON Length: %d"), GameStateJSON.Len());
-    //UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Address of SharedDataPtr->GameState: %p"), SharedDataPtr->GameState);
-
-    int32 StringLength = GameStateJSON.Len();
-    int32 BufferSizeInChars = 1024;
-    int32 BytesToCopy = FMath::Min(StringLength, BufferSizeInChars - 1) * sizeof(TCHAR); // Leave space for null terminator
-
-    if (BytesToCopy > 0)
+    FRLRingCursors& Ring = Layout->ObservationRing;
+    const uint64 Write = Ring.WriteSeq.load(std::memory_order_relaxed);
+    const uint64 Read = Ring.ReadSeq.load(std::memory_order_acquire);
+    if (Write - Read >= RLSharedMemory::ObservationSlots)
     {
-        FMemory::Memcpy(SharedDataPtr->GameState, *GameStateJSON, BytesToCopy);
+        ++DroppedObservations;
+        return false;
     }
-    SharedDataPtr->GameState[BytesToCopy / sizeof(TCHAR)] = TEXT('\0'); // Null-terminate
 
+    Layout->Observations[Write % RLSharedMemory::ObservationSlots] = Observation;
+    Ring.WriteSeq.store(Write + 1, std::memory_order_release);
+    return true;
+}
 
-	// Log the content of the GameState buffer
-	FString LogString;
-	for (int32 i = 0; i < BufferSizeInChars; ++i)
-	{
-		LogString += SharedDataPtr->GameState[i];
-		if (SharedDataPtr->GameState[i] == TEXT('\0'))
-		{
-			break; // Stop logging at the null terminator
-		}
-	}
-	//UE_LOG(LogTemp, Log, TEXT("[FSharedMemoryManager] Content of SharedDataPtr->GameState: %s"), *LogString);
+bool FSharedMemoryManager::ReadAction(FRLActionRecord& OutAction)
+{
+    if (!Layout)
+    {
+        return false;
+    }
 
+    FRLRingCursors& Ring = Layout->ActionRing;
+    const uint64 Read = Ring.ReadSeq.load(std::memory_order_relaxed);
+    const uint64 Write = Ring.WriteSeq.load(std::memory_order_acquire);
+    if (Read == Write)
+    {
+        return false;
+    }
 
-    SharedDataPtr->bNewGameStateAvailable = true;
+    const FRLActionRecord& Slot = Layout->Actions[Read % RLSharedMemory::ActionSlots];
+    OutAction.Step = Slot.Step;
+    OutAction.PayloadSize = FMath::Min<uint32>(Slot.PayloadSize, RLSharedMemory::ActionPayloadCapacity);
+    FMemory::Memcpy(OutAction.Payload, Slot.Payload, OutAction.PayloadSize);
+    Ring.ReadSeq.store(Read + 1, std::memory_order_release);
     return true;
 }
 
-FString FSharedMemoryManager::ReadAction()
+FString FSharedMemoryManager::DecodeActionPayload(const FRLActionRecord& Action)
 {
-    if (!SharedDataPtr || !SharedDataPtr->bNewActionAvailable)
+    if (Action.PayloadSize == 0)
     {
-       return FString();
+        return FString();
     }
 
-    FString Action = FString(SharedDataPtr->Action);
-    // Reset flag
-    SharedDataPtr->bNewActionAvailable = false;
-    return Action;
-}
\ No newline at end of file
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Action.Payload), (int32)Action.PayloadSize);
+    return FString(Converted.Length(), Converted.Get());
+}
@@ -0,0 +1,204 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "Characters/Camera/RL/InferenceBatchSubsystem.h"
+#include "NNE.h"
+#include "NNEModelData.h"
+#include "NNERuntimeCPU.h"
+#include "NNETypes.h"
+#include "NNERuntimeRunSync.h"
+
+using namespace UE::NNE;
+
+namespace
+{
+	int32 ArgMax(const float* Values, int32 Num)
+	{
+		int32 Best = 0;
+		for (int32 i = 1; i < Num; ++i)
+		{
+			if (Values[i] > Values[Best])
+			{
+				Best = i;
+			}
+		}
+		return Best;
+	}
+}
+
+void UInferenceBatchSubsystem::Deinitialize()
+{
+	Batches.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UInferenceBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInferenceBatchSubsystem, STATGROUP_Tickables);
+}
+
+bool UInferenceBatchSubsystem::RegisterModel(UNNEModelData* ModelData, int32 NumFeatures, int32 NumActions)
+{
+	if (!ModelData || NumFeatures <= 0 || NumActions <= 0)
+	{
+		return false;
+	}
+
+	if (const TUniquePtr<FModelBatch>* Existing = Batches.Find(ModelData))
+	{
+		return (*Existing)->Instance.IsValid();
+	}
+
+	TUniquePtr<FModelBatch>& Batch = Batches.Add(ModelData, MakeUnique<FModelBatch>());
+	Batch->NumFeatures = NumFeatures;
+	Batch->NumActions = NumActions;
+
+	TWeakInterfacePtr<INNERuntimeCPU> Runtime = GetRuntime<INNERuntimeCPU>(TEXT("NNERuntimeORTCpu"));
+	if (!Runtime.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("InferenceBatchSubsystem: NNERuntimeORTCpu could not be found!"));
+		return false;
+	}
+
+	Batch->Model = Runtime->CreateModelCPU(ModelData);
+	if (!Batch->Model.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("InferenceBatchSubsystem: Failed to create a CPU Model from %s."), *GetNameSafe(ModelData));
+		return false;
+	}
+
+	Batch->Instance = Batch->Model->CreateModelInstanceCPU();
+	if (!Batch->Instance.IsValid() || !SetBatchShape(*Batch, 1))
+	{
+		UE_LOG(LogTemp, Error, TEXT("InferenceBatchSubsystem: Failed to create a CPU Model Instance for %s."), *GetNameSafe(ModelData));
+		Batch->Instance.Reset();
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("InferenceBatchSubsystem: Shared model instance created for %s."), *GetNameSafe(ModelData));
+	return true;
+}
+
+bool UInferenceBatchSubsystem::SetBatchShape(FModelBatch& Batch, int32 BatchSize)
+{
+	const FTensorShape InputShape = FTensorShape::Make({ (uint32)BatchSize, (uint32)Batch.NumFeatures });
+	if (Batch.Instance->SetInputTensorShapes({ InputShape }) != EResultStatus::Ok)
+	{
+		return false;
+	}
+	Batch.ShapedBatchSize = BatchSize;
+	return true;
+}
+
+bool UInferenceBatchSubsystem::EnqueueDecision(UNNEModelData* ModelData, TConstArrayView<float> Features, FOnActionChosen&& OnChosen)
+{
+	TUniquePtr<FModelBatch>* BatchPtr = Batches.Find(ModelData);
+	if (!BatchPtr || !(*BatchPtr)->Instance.IsValid() || Features.Num() != (*BatchPtr)->NumFeatures)
+	{
+		return false;
+	}
+
+	FModelBatch& Batch = **BatchPtr;
+	Batch.Inputs.Append(Features.GetData(), Features.Num());
+	Batch.Pending.Add(MoveTemp(OnChosen));
+	return true;
+}
+
+int32 UInferenceBatchSubsystem::RunImmediate(UNNEModelData* ModelData, TConstArrayView<float> Features)
+{
+	int32 Result = 0;
+	if (!EnqueueDecision(ModelData, Features, [&Result](int32 ActionIndex) { Result = ActionIndex; }))
+	{
+		return 0;
+	}
+
+	// Everyone queued so far for this model rides along with the synchronous caller.
+	Flush(*Batches.FindChecked(ModelData));
+	return Result;
+}
+
+void UInferenceBatchSubsystem::Tick(float DeltaTime)
+{
+	for (TPair<TObjectKey<UNNEModelData>, TUniquePtr<FModelBatch>>& Pair : Batches)
+	{
+		if (Pair.Value->Pending.Num() > 0)
+		{
+			Flush(*Pair.Value);
+		}
+	}
+}
+
+void UInferenceBatchSubsystem::Flush(FModelBatch& Batch)
+{
+	// Callbacks may request inference and flush again, so the results and callbacks are taken out of the
+	// members for the dispatch and handed back afterwards. A nested flush just allocates its own buffers.
+	TArray<int32> Actions = MoveTemp(ScratchActions);
+	const bool bOk = RunBatch(Batch, Actions);
+
+	// Hand the callbacks a clean batch for their next decision. The swap gives Pending the scratch array's
+	// allocation instead of leaving it empty, and Reset keeps the allocations.
+	TArray<FOnActionChosen> Callbacks = MoveTemp(ScratchCallbacks);
+	Swap(Callbacks, Batch.Pending);
+	Batch.Pending.Reset();
+	Batch.Inputs.Reset();
+
+	for (int32 Row = 0; Row < Callbacks.Num(); ++Row)
+	{
+		Callbacks[Row](bOk ? Actions[Row] : 0);
+	}
+	Callbacks.Reset();
+	ScratchCallbacks = MoveTemp(Callbacks);
+	ScratchActions = MoveTemp(Actions);
+}
+
+bool UInferenceBatchSubsystem::RunBatch(FModelBatch& Batch, TArray<int32>& OutActions)
+{
+	const int32 NumRows = Batch.Pending.Num();
+	OutActions.Reset(NumRows);
+	if (NumRows == 0 || !Batch.Instance.IsValid())
+	{
+		return false;
+	}
+
+	if (Batch.bSupportsBatching && Batch.ShapedBatchSize < NumRows)
+	{
+		if (!SetBatchShape(Batch, FMath::RoundUpToPowerOfTwo(NumRows)))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("InferenceBatchSubsystem: Model does not accept a batch of %d, running rows one by one."), NumRows);
+			Batch.bSupportsBatching = false;
+		}
+	}
+	if (!Batch.bSupportsBatching && Batch.ShapedBatchSize != 1 && !SetBatchShape(Batch, 1))
+	{
+		return false;
+	}
+
+	// One run covers ShapedBatchSize rows; the tail of the last run is zero padding.
+	const int32 RowsPerRun = Batch.ShapedBatchSize;
+	const int32 NumRuns = FMath::DivideAndRoundUp(NumRows, RowsPerRun);
+	Batch.Inputs.AddZeroed(NumRuns * RowsPerRun * Batch.NumFeatures - Batch.Inputs.Num());
+	Batch.Outputs.Reset();
+	Batch.Outputs.AddUninitialized(NumRuns * RowsPerRun * Batch.NumActions);
+
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		FTensorBindingCPU Input;
+		Input.Data = Batch.Inputs.GetData() + Run * RowsPerRun * Batch.NumFeatures;
+		Input.SizeInBytes = RowsPerRun * Batch.NumFeatures * sizeof(float);
+
+		FTensorBindingCPU Output;
+		Output.Data = Batch.Outputs.GetData() + Run * RowsPerRun * Batch.NumActions;
+		Output.SizeInBytes = RowsPerRun * Batch.NumActions * sizeof(float);
+
+		if (Batch.Instance->RunSync({ Input }, { Output }) != EResultStatus::Ok)
+		{
+			UE_LOG(LogTemp, Error, TEXT("InferenceBatchSubsystem: Model execution failed!"));
+			return false;
+		}
+	}
+
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		OutActions.Add(ArgMax(Batch.Outputs.GetData() + Row * Batch.NumActions, Batch.NumActions));
+	}
+	return true;
+}
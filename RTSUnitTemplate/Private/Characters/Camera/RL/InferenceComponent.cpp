@@ -10,6 +10,7 @@
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "AIController.h"
 #include "Characters/Camera/RLAgent.h"
+#include "Characters/Camera/RL/InferenceBatchSubsystem.h"
 
 // Bring the NNE namespace into scope to simplify type names
 using namespace UE::NNE;
@@ -23,7 +24,7 @@ UInferenceComponent::UInferenceComponent()
 
 UInferenceComponent::~UInferenceComponent()
 {
-    // Smart pointers (TSharedPtr) will automatically clean up the model and instance
+    // The shared model instance is owned by UInferenceBatchSubsystem
 }
 
 void UInferenceComponent::BeginPlay()
@@ -43,80 +44,60 @@ void UInferenceComponent::BeginPlay()
         return;
     }
 
-    // Get the specific CPU runtime for ONNX
-    TWeakInterfacePtr<INNERuntimeCPU> Runtime = GetRuntime<INNERuntimeCPU>(TEXT("NNERuntimeORTCpu"));
-    if (!Runtime.IsValid())
+    // The runtime model and instance are shared by all components using this asset and live in the batch subsystem.
+    UInferenceBatchSubsystem* BatchSubsystem = GetBatchSubsystem();
+    bModelRegistered = BatchSubsystem && BatchSubsystem->RegisterModel(QNetworkModelData, NumStateFeatures, ActionSpace.Num());
+    if (!bModelRegistered)
     {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: NNERuntimeORTCpu could not be found!"));
+        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Failed to register the RL model with the inference batch subsystem."));
         return;
     }
 
-    // Create a model compatible with the CPU
-    RuntimeModel = Runtime->CreateModelCPU(QNetworkModelData);
-    if (!RuntimeModel.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Failed to create a CPU Model from the provided asset."));
-        return;
-    }
-
-    // From the model, create an instance that can be run
-    ModelInstance = RuntimeModel->CreateModelInstanceCPU();
-    if (!ModelInstance.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Failed to create a CPU Model Instance."));
-        return;
-    }
-
-    // Define the shape of the input tensor: [batch_size, num_features]
-    const FTensorShape InputShape = FTensorShape::Make({1, 21});
-    TArray<FTensorShape> InputShapes;
-    InputShapes.Add(InputShape);
-
-    // Set the input shapes for the model instance. This is a required one-time setup.
-    if (ModelInstance->SetInputTensorShapes(InputShapes) != EResultStatus::Ok)
-    {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Failed to set the input tensor shapes."));
-        ModelInstance.Reset(); // Invalidate the instance if setup fails
-        return;
-    }
+    UE_LOG(LogTemp, Log, TEXT("InferenceComponent: Runtime model registered for batched inference."));
+}
 
-    UE_LOG(LogTemp, Log, TEXT("InferenceComponent: Runtime model and instance created successfully."));
+UInferenceBatchSubsystem* UInferenceComponent::GetBatchSubsystem() const
+{
+    UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<UInferenceBatchSubsystem>() : nullptr;
 }
 
 TArray<float> UInferenceComponent::ConvertStateToArray(const FGameStateData& GameStateData) const
 {
     TArray<float> StateArray;
-    // Pre-size the array for performance. The state size is 21 floats.
-    StateArray.Reserve(21); 
+    StateArray.SetNumUninitialized(NumStateFeatures);
+    WriteStateFeatures(GameStateData, StateArray.GetData());
+    return StateArray;
+}
 
+void UInferenceComponent::WriteStateFeatures(const FGameStateData& GameStateData, float* Out)
+{
     // The order here MUST EXACTLY match the order used to train the model.
-    StateArray.Add(static_cast<float>(GameStateData.MyUnitCount));
-    StateArray.Add(static_cast<float>(GameStateData.EnemyUnitCount));
-    StateArray.Add(GameStateData.MyTotalHealth);
-    StateArray.Add(GameStateData.EnemyTotalHealth);
-    StateArray.Add(GameStateData.MyTotalAttackDamage);
-    StateArray.Add(GameStateData.EnemyTotalAttackDamage);
-    
+    *Out++ = static_cast<float>(GameStateData.MyUnitCount);
+    *Out++ = static_cast<float>(GameStateData.EnemyUnitCount);
+    *Out++ = GameStateData.MyTotalHealth;
+    *Out++ = GameStateData.EnemyTotalHealth;
+    *Out++ = GameStateData.MyTotalAttackDamage;
+    *Out++ = GameStateData.EnemyTotalAttackDamage;
+
     // Add FVector components
-    StateArray.Add(GameStateData.AgentPosition.X);
-    StateArray.Add(GameStateData.AgentPosition.Y);
-    StateArray.Add(GameStateData.AgentPosition.Z);
-    StateArray.Add(GameStateData.AverageFriendlyPosition.X);
-    StateArray.Add(GameStateData.AverageFriendlyPosition.Y);
-    StateArray.Add(GameStateData.AverageFriendlyPosition.Z);
-    StateArray.Add(GameStateData.AverageEnemyPosition.X);
-    StateArray.Add(GameStateData.AverageEnemyPosition.Y);
-    StateArray.Add(GameStateData.AverageEnemyPosition.Z);
+    *Out++ = GameStateData.AgentPosition.X;
+    *Out++ = GameStateData.AgentPosition.Y;
+    *Out++ = GameStateData.AgentPosition.Z;
+    *Out++ = GameStateData.AverageFriendlyPosition.X;
+    *Out++ = GameStateData.AverageFriendlyPosition.Y;
+    *Out++ = GameStateData.AverageFriendlyPosition.Z;
+    *Out++ = GameStateData.AverageEnemyPosition.X;
+    *Out++ = GameStateData.AverageEnemyPosition.Y;
+    *Out++ = GameStateData.AverageEnemyPosition.Z;
 
     // Add resource counts
-    StateArray.Add(GameStateData.PrimaryResource);
-    StateArray.Add(GameStateData.SecondaryResource);
-    StateArray.Add(GameStateData.TertiaryResource);
-    StateArray.Add(GameStateData.RareResource);
-    StateArray.Add(GameStateData.EpicResource);
-    StateArray.Add(GameStateData.LegendaryResource);
-
-    return StateArray;
+    *Out++ = GameStateData.PrimaryResource;
+    *Out++ = GameStateData.SecondaryResource;
+    *Out++ = GameStateData.TertiaryResource;
+    *Out++ = GameStateData.RareResource;
+    *Out++ = GameStateData.EpicResource;
+    *Out++ = GameStateData.LegendaryResource;
 }
 
 FString UInferenceComponent::GetActionAsJSON(int32 ActionIndex)
@@ -327,124 +308,62 @@ void UInferenceComponent::InitializeActionSpace()
 int32 UInferenceComponent::ChooseAction(const TArray<float>& GameState)
 {
     // --- Basic Checks ---
-    if (!ModelInstance.IsValid())
+    UInferenceBatchSubsystem* BatchSubsystem = GetBatchSubsystem();
+    if (!bModelRegistered || !BatchSubsystem)
     {
         UE_LOG(LogTemp, Warning, TEXT("InferenceComponent: ChooseAction called but the model instance is not valid."));
         return 0;
     }
 
-    if (GameState.Num() != 21)
+    if (GameState.Num() != NumStateFeatures)
     {
-        UE_LOG(LogTemp, Warning, TEXT("InferenceComponent: Invalid GameState size. Expected 21, got %d."), GameState.Num());
+        UE_LOG(LogTemp, Warning, TEXT("InferenceComponent: Invalid GameState size. Expected %d, got %d."), NumStateFeatures, GameState.Num());
         return 0;
     }
 
-    // --- Prepare Input Tensor ---
-    // The input tensor shape is [1, 21] (batch_size=1, num_features=21)
-    FTensorShape InputShape = FTensorShape::Make({1, 21});
-    
-    TArray<FTensorBindingCPU> InputBindings;
-    InputBindings.Emplace();
-    InputBindings[0].Data = const_cast<float*>(GameState.GetData());
-    InputBindings[0].SizeInBytes = GameState.Num() * sizeof(float); // Provide pointer and size in bytes
-
-    // --- Prepare Output Tensor ---
-    TArray<float> QValues;
-    QValues.SetNumZeroed(ActionSpace.Num()); // The size of your ACTION_SPACE
-
-    TArray<FTensorBindingCPU> OutputBindings;
-    OutputBindings.Emplace();
-    OutputBindings[0].Data = QValues.GetData();
-    OutputBindings[0].SizeInBytes = QValues.Num() * sizeof(float); // Provide pointer and size in bytes
-
-    
-    // --- Run Inference ---
-    if (ModelInstance->RunSync(InputBindings, OutputBindings) != EResultStatus::Ok)
-    {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Model execution failed!"));
-        return 0;
-    }
-    
-    // --- Process Output (Argmax) ---
-    // The QValues array has now been filled by the model
-    int32 BestActionIndex = 0;
-    float MaxQValue = -FLT_MAX; // Use the smallest possible float for correct comparison
-
-    if (QValues.Num() > 0)
-    {
-        MaxQValue = QValues[0];
-        for (int32 i = 1; i < QValues.Num(); ++i)
-        {
-            if (QValues[i] > MaxQValue)
-            {
-                MaxQValue = QValues[i];
-                BestActionIndex = i;
-            }
-        }
-    }
-   
-    
-    return BestActionIndex;
+    // Synchronous caller: runs together with whatever other agents have queued this frame.
+    return BatchSubsystem->RunImmediate(QNetworkModelData, GameState);
 }
 
 FString UInferenceComponent::GetActionFromRLModel(const FGameStateData& GameState)
 {
-    // Convert the input struct to the flat TArray<float> the model needs
-    const TArray<float> GameStateArray = ConvertStateToArray(GameState);
-
-    // --- Basic Checks ---
-    if (!ModelInstance.IsValid())
+    UInferenceBatchSubsystem* BatchSubsystem = GetBatchSubsystem();
+    if (!bModelRegistered || !BatchSubsystem)
     {
         UE_LOG(LogTemp, Warning, TEXT("InferenceComponent: ChooseAction called but the model instance is not valid."));
         return TEXT("{}");
     }
 
-    // This check is still useful to ensure the conversion function is correct
-    if (GameStateArray.Num() != 21)
+    float Features[NumStateFeatures];
+    WriteStateFeatures(GameState, Features);
+    return GetActionAsJSON(BatchSubsystem->RunImmediate(QNetworkModelData, MakeArrayView(Features, NumStateFeatures)));
+}
+
+void UInferenceComponent::RequestJsonAction(const FGameStateData& GameState, TFunction<void(const FString&)>&& OnChosen)
+{
+    UInferenceBatchSubsystem* BatchSubsystem = GetBatchSubsystem();
+    if (BrainMode != EBrainMode::RL_Model || !bModelRegistered || !BatchSubsystem)
     {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Converted GameState size is incorrect. Expected 21, got %d."), GameStateArray.Num());
-        return TEXT("{}");
+        OnChosen(ChooseJsonAction(GameState));
+        return;
     }
 
-    // --- Prepare Input & Output Tensors ---
-    TArray<UE::NNE::FTensorBindingCPU> InputBindings;
-    InputBindings.Emplace();
-    // Use the converted GameStateArray here
-    InputBindings[0].Data = const_cast<float*>(GameStateArray.GetData()); 
-    InputBindings[0].SizeInBytes = GameStateArray.Num() * sizeof(float);
-
-    TArray<float> QValues;
-    QValues.SetNumZeroed(ActionSpace.Num());
+    float Features[NumStateFeatures];
+    WriteStateFeatures(GameState, Features);
 
-    TArray<UE::NNE::FTensorBindingCPU> OutputBindings;
-    OutputBindings.Emplace();
-    OutputBindings[0].Data = QValues.GetData();
-    OutputBindings[0].SizeInBytes = QValues.Num() * sizeof(float);
-
-    // --- Run Inference ---
-    if (ModelInstance->RunSync(InputBindings, OutputBindings) != UE::NNE::EResultStatus::Ok)
-    {
-        UE_LOG(LogTemp, Error, TEXT("InferenceComponent: Model execution failed!"));
-        return TEXT("{}");
-    }
-    
-    // --- Process Output (Argmax) ---
-    int32 BestActionIndex = 0;
-    if (QValues.Num() > 0)
-    {
-        float MaxQValue = QValues[0];
-        for (int32 i = 1; i < QValues.Num(); ++i)
+    TWeakObjectPtr<UInferenceComponent> WeakThis(this);
+    const bool bQueued = BatchSubsystem->EnqueueDecision(QNetworkModelData, MakeArrayView(Features, NumStateFeatures),
+        [WeakThis, OnChosen = MoveTemp(OnChosen)](int32 ActionIndex)
         {
-            if (QValues[i] > MaxQValue)
+            if (UInferenceComponent* Self = WeakThis.Get())
             {
-                MaxQValue = QValues[i];
-                BestActionIndex = i;
+                OnChosen(Self->GetActionAsJSON(ActionIndex));
             }
-        }
+        });
+    if (!bQueued)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("InferenceComponent: RequestJsonAction could not queue the observation."));
     }
-    
-    // --- Return the chosen action as a JSON string ---
-    return GetActionAsJSON(BestActionIndex);
 }
 
 FString UInferenceComponent::ChooseJsonAction(const FGameStateData& GameState)
@@ -31,6 +31,15 @@ void ARLAgent::BeginPlay()
     if (bDebug) UE_LOG(LogTemp, Log, TEXT("[RLAgent] BeginPlay on %s Controller=%s HasAuthority=%s"), *GetNameSafe(this), *GetNameSafe(GetController()), HasAuthority() ? TEXT("true") : TEXT("false"));
 }
 
+void ARLAgent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorldTimerManager().ClearTimer(RLUpdateTimerHandle);
+    // Unmaps the rings (and on POSIX removes the shm name) so the next session starts clean
+    delete SharedMemoryManager;
+    SharedMemoryManager = nullptr;
+    Super::EndPlay(EndPlayReason);
+}
+
 
 void ARLAgent::AgentInitialization()
 {
@@ -53,7 +62,14 @@ void ARLAgent::AgentInitialization()
             if (bEnableSharedMemoryIO)
             {
                 if (bDebug) UE_LOG(LogTemp, Log, TEXT("[ARLAgent] Creating SharedMemoryManager (bEnableSharedMemoryIO=true)."));
-                SharedMemoryManager = new FSharedMemoryManager(*MemoryName, sizeof(SharedData));
+                delete SharedMemoryManager;
+                SharedMemoryManager = new FSharedMemoryManager(MemoryName);
+                ObservationStep = 0;
+                if (!SharedMemoryManager->IsValid())
+                {
+                    delete SharedMemoryManager;
+                    SharedMemoryManager = nullptr;
+                }
             }
             else
             {
@@ -77,7 +93,7 @@ void ARLAgent::AgentInitialization()
         }
     }
     
-    SIZE_T MemorySizeNeeded = sizeof(SharedData);
+    SIZE_T MemorySizeNeeded = sizeof(FRLSharedLayout);
     
     if (GetWorld() && GetWorld()->IsNetMode(ENetMode::NM_Client))
     {
@@ -107,31 +123,34 @@ void ARLAgent::AgentInitialization()
     }
 }
 
-FString ARLAgent::CreateGameStateJSON(const FGameStateData& GameState)
+FRLObservationRecord ARLAgent::CreateObservationRecord(const FGameStateData& GameState)
 {
-    return FString::Printf(TEXT("{\"MyUnits\": %d, \"EnemyUnits\": %d, \"MyHealth\": %.2f, \"EnemyHealth\": %.2f, \"MyAttack\": %.2f, \"EnemyAttack\": %.2f, \"AgentPosition\": [%.2f, %.2f, %.2f], \"AvgFriendlyPos\": [%.2f, %.2f, %.2f], \"AvgEnemyPos\": [%.2f, %.2f, %.2f], \"PrimaryResource\": %.2f, \"SecondaryResource\": %.2f, \"TertiaryResource\": %.2f, \"RareResource\": %.2f, \"EpicResource\": %.2f, \"LegendaryResource\": %.2f}"),
-        GameState.MyUnitCount,
-        GameState.EnemyUnitCount,
-        GameState.MyTotalHealth,
-        GameState.EnemyTotalHealth,
-        GameState.MyTotalAttackDamage,
-        GameState.EnemyTotalAttackDamage,
-        GameState.AgentPosition.X,
-        GameState.AgentPosition.Y,
-        GameState.AgentPosition.Z,
-        GameState.AverageFriendlyPosition.X,
-        GameState.AverageFriendlyPosition.Y,
-        GameState.AverageFriendlyPosition.Z,
-        GameState.AverageEnemyPosition.X,
-        GameState.AverageEnemyPosition.Y,
-        GameState.AverageEnemyPosition.Z,
-        GameState.PrimaryResource,
-        GameState.SecondaryResource,
-        GameState.TertiaryResource,
-        GameState.RareResource,
-        GameState.EpicResource,
-        GameState.LegendaryResource
-    );
+    FRLObservationRecord Record;
+    Record.Step = ++ObservationStep;
+    Record.MyUnitCount = GameState.MyUnitCount;
+    Record.EnemyUnitCount = GameState.EnemyUnitCount;
+    Record.MyTotalHealth = GameState.MyTotalHealth;
+    Record.EnemyTotalHealth = GameState.EnemyTotalHealth;
+    Record.MyTotalAttackDamage = GameState.MyTotalAttackDamage;
+    Record.EnemyTotalAttackDamage = GameState.EnemyTotalAttackDamage;
+
+    auto CopyVector = [](float (&Out)[3], const FVector& In)
+    {
+        Out[0] = (float)In.X;
+        Out[1] = (float)In.Y;
+        Out[2] = (float)In.Z;
+    };
+    CopyVector(Record.AgentPosition, GameState.AgentPosition);
+    CopyVector(Record.AverageFriendlyPosition, GameState.AverageFriendlyPosition);
+    CopyVector(Record.AverageEnemyPosition, GameState.AverageEnemyPosition);
+
+    Record.Resources[0] = GameState.PrimaryResource;
+    Record.Resources[1] = GameState.SecondaryResource;
+    Record.Resources[2] = GameState.TertiaryResource;
+    Record.Resources[3] = GameState.RareResource;
+    Record.Resources[4] = GameState.EpicResource;
+    Record.Resources[5] = GameState.LegendaryResource;
+    return Record;
 }
 
 void ARLAgent::UpdateGameState()
@@ -150,9 +169,22 @@ void ARLAgent::UpdateGameState()
 
 void ARLAgent::CheckForNewActions()
 {
-    FString ActionJSON = SharedMemoryManager->ReadAction();
+    if (!SharedMemoryManager)
+    {
+        return;
+    }
 
-    ReceiveRLAction(ActionJSON);
+    // Apply every action the trainer queued since the last step, in order.
+    // An empty record is skipped; it must not end the drain and strand the records behind it.
+    FRLActionRecord Action;
+    while (SharedMemoryManager->ReadAction(Action))
+    {
+        if (Action.PayloadSize == 0)
+        {
+            continue;
+        }
+        ReceiveRLAction(FSharedMemoryManager::DecodeActionPayload(Action));
+    }
 }
 
 void ARLAgent::Tick(float DeltaTime)
@@ -681,15 +713,24 @@ void ARLAgent::Server_PlayGame_Implementation(int32 SelectableTeamId)
     FGameStateData GameState = GatherGameState(SelectableTeamId);
     if (bDebug) UE_LOG(LogTemp, Log, TEXT("Step 1/3: Game state gathered."));
 
-    // 2. Get the action JSON from the inference component
-    FString ActionJSON = InferenceComponent->ChooseJsonAction(GameState);
+    // 2. Get the action JSON from the inference component. In RL mode the observation is batched with all
+    //    other agents of this frame and the callback runs once the shared model has been evaluated.
+    TWeakObjectPtr<ARLAgent> WeakThis(this);
+    InferenceComponent->RequestJsonAction(GameState, [WeakThis](const FString& ActionJSON)
+    {
+        ARLAgent* Agent = WeakThis.Get();
+        if (!Agent)
+        {
+            return;
+        }
 
-    // Log the action chosen by the model. This is the most important log.
-    if (bDebug) UE_LOG(LogTemp, Log, TEXT("Step 2/3: Inference component returned ActionJSON: %s"), *ActionJSON);
+        // Log the action chosen by the model. This is the most important log.
+        if (Agent->bDebug) UE_LOG(LogTemp, Log, TEXT("Step 2/3: Inference component returned ActionJSON: %s"), *ActionJSON);
 
-    // 3. Process the action using your existing function
-    if (bDebug) UE_LOG(LogTemp, Log, TEXT("Step 3/3: Passing ActionJSON to ReceiveRLAction for processing."));
-    ReceiveRLAction(ActionJSON);
+        // 3. Process the action using your existing function
+        if (Agent->bDebug) UE_LOG(LogTemp, Log, TEXT("Step 3/3: Passing ActionJSON to ReceiveRLAction for processing."));
+        Agent->ReceiveRLAction(ActionJSON);
+    });
 }
 
 void ARLAgent::Server_RequestGameState_Implementation(int32 SelectableTeamId)
@@ -709,13 +750,13 @@ void ARLAgent::Client_ReceiveGameState_Implementation(const FGameStateData& Game
         return;
     }
 
-    // Convert GameStateData to JSON (or another format your RL process understands)
-    FString GameStateJSON = CreateGameStateJSON(GameState);
-    
-    // Write to shared memory
+    // Write the binary observation into the shared-memory ring
     if (SharedMemoryManager)
     {
-        SharedMemoryManager->WriteGameState(GameStateJSON);
+        if (!SharedMemoryManager->WriteObservation(CreateObservationRecord(GameState)) && bDebug)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[ARLAgent] Observation ring full, trainer is behind (dropped %llu)."), SharedMemoryManager->GetDroppedObservations());
+        }
     }
     else
     {
@@ -504,6 +504,8 @@ void AAbilityUnit::SpendAbilityPoints(EGASAbilityInputID AbilityID, int AbilityI
 
 	if(AbilityIndex <= 3)
 		LevelData.UsedAbilityPointsArray[AbilityIndex] += AbilityCost;
+
+	NotifyLevelDataChanged();
 }
 
 
@@ -539,6 +541,7 @@ void AAbilityUnit::AddAbilityPoint()
 	if((LevelData.CharacterLevel % LevelUpData.AbilityPointsEveryXLevel) == 0) // Every 5 levels
 	{
 		LevelData.AbilityPoints++;
+		NotifyLevelDataChanged();
 	}
 }
 
@@ -577,6 +580,7 @@ void AAbilityUnit::LoadAbilityAndLevelData(const FString& SlotName)
 		LevelData = SaveGameInstance->LevelData;
 		LevelUpData = SaveGameInstance->LevelUpData;
 		Attributes->UpdateAttributes(SaveGameInstance->AttributeSaveData);
+		NotifyLevelDataChanged();
 	}
 	
 }
@@ -590,6 +594,7 @@ void AAbilityUnit::ResetAbility()
 	LevelData.AbilityPoints = LevelData.UsedAbilityPoints+LevelData.AbilityPoints-AbilityResetPenalty;
 	LevelData.UsedAbilityPoints = 0;
 	LevelData.UsedAbilityPointsArray = { 0, 0, 0, 0, 0 };
+	NotifyLevelDataChanged();
 }
 
 
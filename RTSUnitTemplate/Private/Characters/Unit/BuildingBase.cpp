@@ -12,6 +12,8 @@
 #include "Controller/PlayerController/CustomControllerBase.h"
 #include "EngineUtils.h"
 #include "System/RTSBeaconSubsystem.h"
+#include "Subsystems/GroundHeightCacheSubsystem.h"
+#include "System/PlacementIndexSubsystem.h"
 
 
 ABuildingBase::ABuildingBase(const FObjectInitializer& ObjectInitializer)
@@ -39,6 +41,14 @@ void ABuildingBase::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Columns under the building must be re-sampled so flyers keep hovering over it.
+	UGroundHeightCacheSubsystem::InvalidateActorBounds(this);
+
+	if (UPlacementIndexSubsystem* PlacementIndex = GetWorld()->GetSubsystem<UPlacementIndexSubsystem>())
+	{
+		PlacementIndex->RegisterStructure(this);
+	}
+
 	if (EnergyWallClass && Origin)
 	{
 		SpawnEnergyWall(EnergyWallClass, Origin);
@@ -125,6 +135,11 @@ void ABuildingBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 			GM->CheckWinLoseCondition(this);
 		}
 	}
+	UGroundHeightCacheSubsystem::InvalidateActorBounds(this);
+	if (UPlacementIndexSubsystem* PlacementIndex = GetWorld()->GetSubsystem<UPlacementIndexSubsystem>())
+	{
+		PlacementIndex->UnregisterStructure(this);
+	}
 	Super::EndPlay(EndPlayReason);
 }
 
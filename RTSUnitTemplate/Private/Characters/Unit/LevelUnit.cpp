@@ -5,6 +5,9 @@
 #include "Core/TalentSaveGame.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Characters/Unit/UnitBase.h"
+#include "System/UnitIndexSubsystem.h"
+#include "System/HudEventSubsystem.h"
 
 void ALevelUnit::Tick(float DeltaTime)
 {
@@ -60,6 +63,16 @@ void ALevelUnit::OnRep_LevelData(const FLevelData& OldLevelData)
 	{
 		LevelVisibilityCheck();
 	}
+	NotifyLevelDataChanged();
+}
+
+void ALevelUnit::NotifyLevelDataChanged()
+{
+	UWorld* World = GetWorld();
+	if (UHudEventSubsystem* HudEvents = World ? World->GetSubsystem<UHudEventSubsystem>() : nullptr)
+	{
+		HudEvents->NotifyUnitProgressChanged(this);
+	}
 }
 
 void ALevelUnit::LevelVisibilityCheck()
@@ -70,6 +83,12 @@ void ALevelUnit::LevelVisibilityCheck()
 void ALevelUnit::SetUnitIndex(int32 NewIndex)
 {
 	UnitIndex = NewIndex;
+
+	UWorld* World = GetWorld();
+	if (UUnitIndexSubsystem* UnitIndexSubsystem = World ? World->GetSubsystem<UUnitIndexSubsystem>() : nullptr)
+	{
+		UnitIndexSubsystem->NotifyUnitChanged(Cast<AUnitBase>(this));
+	}
 }
 
 
@@ -83,6 +102,7 @@ void ALevelUnit::LevelUp_Implementation()
 		LevelData.TalentPoints += LevelUpData.TalentPointsPerLevel; // Define TalentPointsPerLevel as appropriate
 		LevelData.Experience -= LevelUpData.ExperiencePerLevel*LevelData.CharacterLevel;
 		UpdateCachedLevelString();
+		NotifyLevelDataChanged();
 		OnLevelUp(LevelData.CharacterLevel);
 		// Trigger any additional level-up effects or logic here
 		LevelVisibilityCheck();
@@ -141,6 +161,7 @@ void ALevelUnit::InvestPointIntoStamina()
 		ApplyInvestmentEffect(StaminaInvestmentEffect);
 		--LevelData.TalentPoints; // Deduct a talent point
 		LevelData.UsedTalentPoints++;
+		NotifyLevelDataChanged();
 	}
 	
 }
@@ -152,6 +173,7 @@ void ALevelUnit::InvestPointIntoAttackPower()
 		ApplyInvestmentEffect(AttackPowerInvestmentEffect);
 		--LevelData.TalentPoints; // Deduct a talent point
 		LevelData.UsedTalentPoints++;
+		NotifyLevelDataChanged();
 	}
 }
 
@@ -163,6 +185,7 @@ void ALevelUnit::InvestPointIntoWillPower()
 		ApplyInvestmentEffect(WillpowerInvestmentEffect);
 		--LevelData.TalentPoints; // Deduct a talent point
 		LevelData.UsedTalentPoints++;
+		NotifyLevelDataChanged();
 	}
 }
 
@@ -173,6 +196,7 @@ void ALevelUnit::InvestPointIntoHaste()
 		ApplyInvestmentEffect(HasteInvestmentEffect);
 		--LevelData.TalentPoints; // Deduct a talent point
 		LevelData.UsedTalentPoints++;
+		NotifyLevelDataChanged();
 	}
 }
 
@@ -183,6 +207,7 @@ void ALevelUnit::InvestPointIntoArmor()
 		ApplyInvestmentEffect(ArmorInvestmentEffect);
 		--LevelData.TalentPoints; // Deduct a talent point
 		LevelData.UsedTalentPoints++;
+		NotifyLevelDataChanged();
 	}
 }
 
@@ -193,6 +218,7 @@ void ALevelUnit::InvestPointIntoMagicResistance()
 		ApplyInvestmentEffect(MagicResistanceInvestmentEffect);
 		--LevelData.TalentPoints; // Deduct a talent point
 		LevelData.UsedTalentPoints++;
+		NotifyLevelDataChanged();
 	}
 }
 
@@ -215,6 +241,7 @@ void ALevelUnit::ResetTalents()
 
 	Attributes->SetHealthRegeneration(0);
 	Attributes->SetShieldRegeneration(0);
+	NotifyLevelDataChanged();
 }
 
 // ---------------------------------------------------------------------------
@@ -357,6 +384,7 @@ bool ALevelUnit::InvestInAttributeTreeNode(FName NodeId)
 		// stat, from dead-locking. Raise MaxTalentsPerStat if you never want a point spent this way.
 		LevelData.TalentPoints = FMath::Max(0, LevelData.TalentPoints - 1);
 		LevelData.UsedTalentPoints += 1;
+		NotifyLevelDataChanged();
 	}
 
 	// Book-keeping: bump the node's invested count.
@@ -393,6 +421,7 @@ void ALevelUnit::ResetLevel()
 	LevelData.TalentPoints = 0;
 	LevelData.UsedTalentPoints = 0;
 	LevelData.Experience = 0;
+	NotifyLevelDataChanged();
 	//InitializeAttributes();
 	Attributes->SetStamina(0);
 	Attributes->SetMaxHealth(Attributes->GetBaseHealth());
@@ -444,6 +473,7 @@ void ALevelUnit::LoadLevelDataAndAttributes(const FString& SlotName)
 		LevelUpData = SaveGameInstance->LevelUpData;
 		
 		Attributes->UpdateAttributes(SaveGameInstance->AttributeSaveData);
+		NotifyLevelDataChanged();
 	}
 	
 }
@@ -35,6 +35,7 @@
 #include "Engine/GameInstance.h"
 #include "Controller/PlayerController/ControllerBase.h"
 #include "Core/ViewportUtils.h"
+#include "System/UnitIndexSubsystem.h"
 
 // Debug category for squad healthbar visibility
 DEFINE_LOG_CATEGORY_STATIC(LogSquadHB, Log, All);
@@ -186,21 +187,11 @@ void APerformanceUnit::HandleSquadHealthBarVisibility()
 	// Determine owner among alive squadmates with same team
 	AUnitBase* ThisAsUnit = Cast<AUnitBase>(this);
 	AUnitBase* Best = nullptr;
-	int32 BestIndex = TNumericLimits<int32>::Max();
 	if (UWorld* World = GetWorld())
 	{
-		for (TActorIterator<AUnitBase> It(World); It; ++It)
+		if (UUnitIndexSubsystem* UnitIndexSubsystem = World->GetSubsystem<UUnitIndexSubsystem>())
 		{
-			AUnitBase* U = *It;
-			if (!U || U->TeamId != TeamId || U->SquadId != SquadId) continue;
-			if (U->GetUnitState() == UnitData::Dead) continue;
-			int32 Index = U->UnitIndex;
-			if (Index < 0) Index = INT_MAX - 1;
-			if (!Best || Index < BestIndex)
-			{
-				Best = U;
-				BestIndex = Index;
-			}
+			Best = UnitIndexSubsystem->FindSquadHealthbarOwner(TeamId, SquadId);
 		}
 	}
 	
@@ -34,6 +34,8 @@
 #include "Widgets/SquadHealthBar.h"
 #include "EngineUtils.h"
 #include "System/PlayerTeamSubsystem.h"
+#include "System/UnitIndexSubsystem.h"
+#include "System/ProjectilePoolSubsystem.h"
 #include <climits>
 // Mass includes for follow application and spawn return adjustments
 #include "Mass/Projectile/ProjectileVisualManager.h"
@@ -138,6 +140,11 @@ void AUnitBase::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (UUnitIndexSubsystem* UnitIndexSubsystem = GetWorld()->GetSubsystem<UUnitIndexSubsystem>())
+	{
+		UnitIndexSubsystem->RegisterUnit(this);
+	}
+
 	if (APlayerController* PC = GetWorld()->GetFirstPlayerController())
 	{
 		if (AHUDBase* HUD = Cast<AHUDBase>(PC->GetHUD()))
@@ -201,6 +208,11 @@ void AUnitBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		}
 	}
 
+	if (UUnitIndexSubsystem* UnitIndexSubsystem = GetWorld()->GetSubsystem<UUnitIndexSubsystem>())
+	{
+		UnitIndexSubsystem->UnregisterUnit(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -209,25 +221,13 @@ void AUnitBase::EnsureSquadHealthbarState()
 	if (!HealthWidgetComp) return;
 	if (SquadId <= 0) return; // Regular units keep their own healthbar
 
-	// Select designated owner: alive squadmate with smallest UnitIndex; fallback to first found
-	AUnitBase* Best = nullptr;
-	int32 BestIndex = TNumericLimits<int32>::Max();
+	// Select designated owner: alive squadmate with smallest UnitIndex
 	UWorld* World = GetWorld();
 	if (!World) return;
+	UUnitIndexSubsystem* UnitIndexSubsystem = World->GetSubsystem<UUnitIndexSubsystem>();
+	if (!UnitIndexSubsystem) return;
 
-	for (TActorIterator<AUnitBase> It(World); It; ++It)
-	{
-		AUnitBase* U = *It;
-		if (!U || U->TeamId != TeamId || U->SquadId != SquadId) continue;
-		if (U->GetUnitState() == UnitData::Dead) continue;
-		int32 Index = U->UnitIndex;
-		if (Index < 0) Index = INT_MAX - 1; // push invalids back
-		if (!Best || Index < BestIndex)
-		{
-			Best = U;
-			BestIndex = Index;
-		}
-	}
+	AUnitBase* Best = UnitIndexSubsystem->FindSquadHealthbarOwner(TeamId, SquadId);
 
 	if (!Best)
 	{
@@ -289,25 +289,8 @@ bool AUnitBase::IsSquadHealthbarOwner() const
 	UWorld* World = GetWorld();
 	if (!World) return false;
 
-	const int32 MyTeam = TeamId;
-	const int32 MySquad = SquadId;
-
-	AUnitBase* Best = nullptr;
-	int32 BestIndex = TNumericLimits<int32>::Max();
-	for (TActorIterator<AUnitBase> It(World); It; ++It)
-	{
-		AUnitBase* U = *It;
-		if (!U || U->TeamId != MyTeam || U->SquadId != MySquad) continue;
-		if (U->GetUnitState() == UnitData::Dead) continue;
-		int32 Index = U->UnitIndex;
-		if (Index < 0) Index = INT_MAX - 1; // push invalids back
-		if (!Best || Index < BestIndex)
-		{
-			Best = U;
-			BestIndex = Index;
-		}
-	}
-	return Best == this;
+	UUnitIndexSubsystem* UnitIndexSubsystem = World->GetSubsystem<UUnitIndexSubsystem>();
+	return UnitIndexSubsystem && UnitIndexSubsystem->FindSquadHealthbarOwner(TeamId, SquadId) == this;
 }
 
 
@@ -648,17 +631,15 @@ void AUnitBase::DeadEffectsAndEvents()
 	if (SquadId > 0)
 	{
 		UWorld* World = GetWorld();
-		if (World)
+		if (UUnitIndexSubsystem* UnitIndexSubsystem = World ? World->GetSubsystem<UUnitIndexSubsystem>() : nullptr)
 		{
-			for (TActorIterator<AUnitBase> It(World); It; ++It)
+			UnitIndexSubsystem->ForEachSquadMember(TeamId, SquadId, [this](AUnitBase* U)
 			{
-				AUnitBase* U = *It;
-				if (!U || U == this) continue;
-				if (U->TeamId == TeamId && U->SquadId == SquadId)
+				if (U != this)
 				{
 					U->EnsureSquadHealthbarState();
 				}
-			}
+			});
 		}
 	}
 }
@@ -727,24 +708,10 @@ void AUnitBase::UpdateSquadHealthBar()
 	if (SquadId <= 0) return;
 
 	AUnitBase* Best = nullptr;
-	int32 BestIndex = TNumericLimits<int32>::Max();
 	UWorld* World = GetWorld();
-	if (World)
+	if (UUnitIndexSubsystem* UnitIndexSubsystem = World ? World->GetSubsystem<UUnitIndexSubsystem>() : nullptr)
 	{
-		for (TActorIterator<AUnitBase> It(World); It; ++It)
-		{
-			AUnitBase* U = *It;
-			if (!U || U->TeamId != TeamId || U->SquadId != SquadId) continue;
-			if (U->GetUnitState() == UnitData::Dead) continue;
-			
-			int32 Index = U->UnitIndex;
-			if (Index < 0) Index = INT_MAX - 1;
-			if (!Best || Index < BestIndex)
-			{
-				Best = U;
-				BestIndex = Index;
-			}
-		}
+		Best = UnitIndexSubsystem->FindSquadHealthbarOwner(TeamId, SquadId);
 	}
 
 	if (Best)
@@ -756,6 +723,7 @@ void AUnitBase::UpdateSquadHealthBar()
 void AUnitBase::IncreaseExperience()
 {
 	LevelData.Experience++;
+	NotifyLevelDataChanged();
 		
 	UpdateWidget();
 }
@@ -1033,9 +1001,8 @@ void AUnitBase::SpawnProjectile_Implementation(AActor* Target, AActor* Attacker)
 			Transform.SetRotation(FQuat(InitialRotation));
 			Transform.SetScale3D(ShootingUnit->ProjectileScale);
 
-			const auto MyProjectile = Cast<AProjectile>
-								(UGameplayStatics::BeginDeferredActorSpawnFromClass
-								(this, ProjectileBaseClass, Transform,  ESpawnActorCollisionHandlingMethod::AlwaysSpawn));
+			UProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UProjectilePoolSubsystem>();
+			AProjectile* MyProjectile = ProjectilePool ? ProjectilePool->AcquireProjectile(ProjectileBaseClass, Transform) : nullptr;
 				if (MyProjectile != nullptr)
 				{
 					if (HomingCount > 0) MyProjectile->FollowTarget = true;
@@ -1045,7 +1012,7 @@ void AUnitBase::SpawnProjectile_Implementation(AActor* Target, AActor* Attacker)
 					
 					MyProjectile->Init(Target, Attacker);
 					MyProjectile->SetProjectileVisibility();
-					UGameplayStatics::FinishSpawningActor(MyProjectile, Transform);
+					ProjectilePool->FinishProjectile(MyProjectile, Transform);
 					MyProjectile->SetReplicates(true);
 				}
 		}
@@ -1217,14 +1184,8 @@ void AUnitBase::SpawnProjectileFromClass_Implementation(
             }
             else
             {
-                AProjectile* MyProj = Cast<AProjectile>(
-                    UGameplayStatics::BeginDeferredActorSpawnFromClass(
-                        this,
-                        ProjectileClass,
-                        SpawnXf,
-                        ESpawnActorCollisionHandlingMethod::AlwaysSpawn
-                    )
-                );
+                UProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UProjectilePoolSubsystem>();
+                AProjectile* MyProj = ProjectilePool ? ProjectilePool->AcquireProjectile(ProjectileClass, SpawnXf) : nullptr;
 
                 if (MyProj)
                 {
@@ -1245,7 +1206,7 @@ void AUnitBase::SpawnProjectileFromClass_Implementation(
                     MyProj->IsBouncingBack    = IsBouncingBack;
             
                     MyProj->SetProjectileVisibility();
-                    UGameplayStatics::FinishSpawningActor(MyProj, SpawnXf);
+                    ProjectilePool->FinishProjectile(MyProj, SpawnXf);
                     MyProj->SetReplicates(true);
                 }
             }
@@ -1447,14 +1408,8 @@ void AUnitBase::SpawnProjectileFromClassWithAim_Implementation(
             }
             else
             {
-                AProjectile* Proj = Cast<AProjectile>(
-                    UGameplayStatics::BeginDeferredActorSpawnFromClass(
-                        this,
-                        ProjectileClass,
-                        SpawnXf,
-                        ESpawnActorCollisionHandlingMethod::AlwaysSpawn
-                    )
-                );
+                UProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UProjectilePoolSubsystem>();
+                AProjectile* Proj = ProjectilePool ? ProjectilePool->AcquireProjectile(ProjectileClass, SpawnXf) : nullptr;
 
                 if (Proj)
                 {
@@ -1476,7 +1431,7 @@ void AUnitBase::SpawnProjectileFromClassWithAim_Implementation(
                     Proj->ProjectileEffect3 = NewEffect3;
             
                     Proj->SetProjectileVisibility();
-                    UGameplayStatics::FinishSpawningActor(Proj, SpawnXf);
+                    ProjectilePool->FinishProjectile(Proj, SpawnXf);
                     Proj->SetReplicates(true);
                 }
             }
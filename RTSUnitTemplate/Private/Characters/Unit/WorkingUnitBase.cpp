@@ -52,6 +52,12 @@ void AWorkingUnitBase::Destroyed()
 		WorkResource->Destroy();
 		WorkResource = nullptr;
 	}
+
+	// Keep the team's worker counters in step; only the server has the game mode.
+	if (AResourceGameMode* GameMode = Cast<AResourceGameMode>(GetWorld()->GetAuthGameMode()))
+	{
+		GameMode->ReleaseWorkPlace(this);
+	}
 	Super::Destroyed();
 }
 
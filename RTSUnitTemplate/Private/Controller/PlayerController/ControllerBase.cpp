@@ -38,6 +38,7 @@
 #include "Controller/PlayerController/ExtendedControllerBase.h"
 #include "GAS/GameplayAbilityBase.h"
 #include "Characters/Unit/GASUnit.h"
+#include "System/HudEventSubsystem.h"
 
 
 AControllerBase::AControllerBase() {
@@ -179,6 +180,30 @@ void AControllerBase::SetupInputComponent() {
 }
 
 
+uint32 AControllerBase::GetHudSelectionHash() const
+{
+	uint32 Hash = HashCombine(GetTypeHash(SelectedUnitCount), GetTypeHash(CurrentUnitWidgetIndex));
+	for (const AUnitBase* Unit : SelectedUnits)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Unit));
+		// Squad buttons and labels group by SquadId
+		Hash = HashCombine(Hash, GetTypeHash(Unit ? Unit->SquadId : 0));
+	}
+
+	// Ability buttons of the focused unit
+	if (SelectedUnits.IsValidIndex(CurrentUnitWidgetIndex))
+	{
+		if (const AUnitBase* Unit = SelectedUnits[CurrentUnitWidgetIndex])
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Unit->DefaultAbilities.Num()));
+			Hash = HashCombine(Hash, GetTypeHash(Unit->SecondAbilities.Num()));
+			Hash = HashCombine(Hash, GetTypeHash(Unit->ThirdAbilities.Num()));
+			Hash = HashCombine(Hash, GetTypeHash(Unit->FourthAbilities.Num()));
+		}
+	}
+	return Hash;
+}
+
 void AControllerBase::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
@@ -192,6 +217,19 @@ void AControllerBase::Tick(float DeltaSeconds)
 	}
 
 	if(HUDBase) SelectedUnitCount = HUDBase->SelectedUnits.Num();
+
+	if (IsLocalController())
+	{
+		const uint32 SelectionHash = GetHudSelectionHash();
+		if (SelectionHash != LastHudSelectionHash)
+		{
+			LastHudSelectionHash = SelectionHash;
+			if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+			{
+				HudEvents->NotifySelectionChanged(this);
+			}
+		}
+	}
 	
 	FHitResult Hit;
 	GetHitResultUnderCursor(ECollisionChannel::ECC_Visibility, false, Hit);
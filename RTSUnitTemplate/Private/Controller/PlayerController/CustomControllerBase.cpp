@@ -48,6 +48,7 @@
 #include "Actors/WorkArea.h"
 #include "GAS/AttributeSetBase.h"
 #include "Blueprint/UserWidget.h"
+#include "System/HudEventSubsystem.h"
 
 
 void ACustomControllerBase::BeginPlay()
@@ -2265,13 +2266,15 @@ TArray<FVector> ACustomControllerBase::ComputeSlotOffsets(const TArray<AUnitBase
     return Offsets;
 }
 
-TArray<TArray<float>> ACustomControllerBase::BuildCostMatrix(
+void ACustomControllerBase::BuildCostMatrix(
     const TArray<AUnitBase*>& Units,
     const TArray<FVector>& SlotOffsets,
-    const FVector& TargetCenter) const
+    const FVector& TargetCenter,
+    FFormationCostMatrix& OutCost) const
 {
     int32 N = Units.Num();
-    if (N == 0) return TArray<TArray<float>>();
+    OutCost.Reset(N);
+    if (N == 0) return;
 
     // 1. Collect radii and identify slot capacities
     TArray<float> Radii;
@@ -2300,14 +2303,12 @@ TArray<TArray<float>> ACustomControllerBase::BuildCostMatrix(
     }
 
     // 2. Build the matrix with penalties
-    TArray<TArray<float>> Cost;
-    Cost.SetNum(N);
     for (int32 i = 0; i < N; ++i)
     {
         float UnitR = Radii[i];
         FVector UnitLoc = GetUnitWorldLocation(Units[i]);
 
-        Cost[i].SetNum(N);
+        float* CostRow = &OutCost.At(i, 0);
         for (int32 j = 0; j < N; ++j)
         {
             int32 Row = j / GridSize;
@@ -2321,69 +2322,14 @@ TArray<TArray<float>> ACustomControllerBase::BuildCostMatrix(
             // We use a small epsilon for float comparison.
             if (UnitR > Capacity + 0.1f)
             {
-                Cost[i][j] = DistSq + 1e10f; 
+                CostRow[j] = DistSq + 1e10f;
             }
             else
             {
-                Cost[i][j] = DistSq;
+                CostRow[j] = DistSq;
             }
         }
     }
-    return Cost;
-}
-
-TArray<int32> ACustomControllerBase::SolveHungarian(const TArray<TArray<float>>& Matrix) const
-{
-    int n = Matrix.Num();
-    TArray<float> u; u.Init(0.f, n+1);
-    TArray<float> v; v.Init(0.f, n+1);
-    TArray<int32> p; p.Init(0, n+1);
-    TArray<int32> way; way.Init(0, n+1);
-
-    for (int i = 1; i <= n; ++i)
-    {
-        p[0] = i;
-        int j0 = 0;
-        TArray<float> minv; minv.Init(FLT_MAX, n+1);
-        TArray<bool> used; used.Init(false, n+1);
-        do
-        {
-            used[j0] = true;
-            int i0 = p[j0];
-            float delta = FLT_MAX;
-            int j1 = 0;
-            for (int j = 1; j <= n; ++j)
-            {
-                if (!used[j])
-                {
-                    float cur = Matrix[i0-1][j-1] - u[i0] - v[j];
-                    if (cur < minv[j]) { minv[j] = cur; way[j] = j0; }
-                    if (minv[j] < delta) { delta = minv[j]; j1 = j; }
-                }
-            }
-            for (int j = 0; j <= n; ++j)
-            {
-                if (used[j]) { u[p[j]] += delta; v[j] -= delta; }
-                else { minv[j] -= delta; }
-            }
-            j0 = j1;
-        } while (p[j0] != 0);
-
-        do
-        {
-            int j1 = way[j0];
-            p[j0] = p[j1];
-            j0 = j1;
-        } while (j0);
-    }
-
-    TArray<int32> Assignment;
-    Assignment.SetNum(n);
-    for (int j = 1; j <= n; ++j)
-    {
-        if (p[j] > 0) Assignment[p[j] - 1] = j - 1;
-    }
-    return Assignment;
 }
 
 bool ACustomControllerBase::ShouldRecalculateFormation() const
@@ -2417,8 +2363,10 @@ void ACustomControllerBase::RecalculateFormation(const FVector& TargetCenter, fl
     auto Offsets = ComputeSlotOffsets(SortedUnits, Spacing);
     
     // 3. Match units to slots. By including radius info in BuildCostMatrix, we ensure big units get big slots.
-    auto Cost = BuildCostMatrix(SortedUnits, Offsets, TargetCenter);
-    auto Assign = SolveHungarian(Cost);
+    BuildCostMatrix(SortedUnits, Offsets, TargetCenter, FormationCostScratch);
+    const bool bUseGreedy = FormationGreedyUnitThreshold > 0 && N > FormationGreedyUnitThreshold;
+    FFormationAssignment::Solve(bUseGreedy ? EFormationAssignmentSolver::GreedySwap : FormationAssignmentSolver, FormationCostScratch, FormationAssignmentScratch);
+    const TArray<int32>& Assign = FormationAssignmentScratch;
 
     for (int32 i = 0; i < N; ++i)
     {
@@ -3484,12 +3432,9 @@ void ACustomControllerBase::Multi_SetupPlayerMiniMap_Implementation()
 
 void ACustomControllerBase::Client_ReceiveCooldown_Implementation(int32 AbilityIndex, float RemainingTime)
 {
-
-	AExtendedCameraBase* ExtendedCameraBase = Cast<AExtendedCameraBase>(CameraBase);
-	
-	if (ExtendedCameraBase && ExtendedCameraBase->UnitSelectorWidget)
+	if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
 	{
-		ExtendedCameraBase->UnitSelectorWidget->SetWidgetCooldown(AbilityIndex, RemainingTime);
+		HudEvents->NotifyAbilityCooldown(AbilityIndex, RemainingTime);
 	}
 }
 
@@ -48,53 +48,35 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Core/UnitData.h"
 #include "Core/RTSUnitUtils.h"
+#include "System/PlacementIndexSubsystem.h"
 
 using namespace RTSUnitUtils;
 
 // Helper: compute snap center/extent for any actor (works with ISMs too)
 static bool GetActorBoundsForSnap(AActor* Actor, FVector& OutCenter, FVector& OutExtent)
 {
-	if (!Actor)
-	{
-		return false;
-	}
+	return UPlacementIndexSubsystem::GetStructureBounds(Actor, OutCenter, OutExtent);
+}
 
-	// Prefer explicit mesh on WorkArea
-	if (AWorkArea* WA = Cast<AWorkArea>(Actor))
+// Helper: work areas and buildings near Center from the placement index
+static void QueryPlacementNeighbors(UWorld* World, const FVector& Center, float Radius, TArray<AActor*>& OutActors, EPlacementIndexFilter Filter = EPlacementIndexFilter::All)
+{
+	OutActors.Reset();
+	if (UPlacementIndexSubsystem* PlacementIndex = World ? World->GetSubsystem<UPlacementIndexSubsystem>() : nullptr)
 	{
-		if (WA->Mesh)
-		{
-			const FBoxSphereBounds B = WA->Mesh->CalcBounds(WA->Mesh->GetComponentTransform());
-			OutCenter = B.Origin;
-			OutExtent = B.BoxExtent;
-			return true;
-		}
+		PlacementIndex->QueryNearby(Center, Radius, OutActors, Filter);
 	}
+}
 
-	// For buildings: approximate footprint as a square using the capsule radius (radius*2 side length)
-	if (ABuildingBase* Bld = Cast<ABuildingBase>(Actor))
+// Helper: let a trace pass through every work area
+static void IgnoreAllWorkAreas(UWorld* World, FCollisionQueryParams& Params)
+{
+	if (UPlacementIndexSubsystem* PlacementIndex = World ? World->GetSubsystem<UPlacementIndexSubsystem>() : nullptr)
 	{
-		if (UCapsuleComponent* Capsule = Bld->FindComponentByClass<UCapsuleComponent>())
-		{
-			float R = Capsule->GetScaledCapsuleRadius();
-			if (Bld->MassActorBindingComponent)
-			{
-				R += Bld->MassActorBindingComponent->AdditionalCapsuleRadius;
-			}
-			OutCenter = Bld->GetActorLocation();
-			// Use radius for XY half-extents; keep Z from capsule half-height
-			OutExtent.X = R;
-			OutExtent.Y = R;
-			OutExtent.Z = Capsule->GetScaledCapsuleHalfHeight();
-			return true;
-		}
+		TArray<AActor*> WorkAreas;
+		PlacementIndex->GetAllWorkAreas(WorkAreas);
+		Params.AddIgnoredActors(WorkAreas);
 	}
-
-	// Otherwise, fall back to aggregate component bounds (works for ISM as well)
-	const FBox CompBox = Actor->GetComponentsBoundingBox(/*bNonColliding=*/true);
-	OutCenter = CompBox.GetCenter();
-	OutExtent = CompBox.GetExtent();
-	return true;
 }
 
 void AExtendedControllerBase::BeginPlay()
@@ -1082,9 +1064,11 @@ void AExtendedControllerBase::SetWorkAreaPosition_Implementation(AWorkArea* Drag
     FHitResult HitResult;
     FCollisionQueryParams TraceParams(FName(TEXT("WorkAreaGroundTrace")), true, DraggedArea);
     //TraceParams.AddIgnoredActor(DraggedArea);
-	for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
+	// Only work areas over the trace column can block it; anything else non-landscape is skipped below
 	{
-		TraceParams.AddIgnoredActor(*It);
+		TArray<AActor*> WorkAreasOnColumn;
+		QueryPlacementNeighbors(GetWorld(), MeshBottomWorld, 1.f, WorkAreasOnColumn, EPlacementIndexFilter::WorkAreas);
+		TraceParams.AddIgnoredActors(WorkAreasOnColumn);
 	}
 
     {
@@ -1224,11 +1208,10 @@ FVector AExtendedControllerBase::ComputeGroundedLocation(AWorkArea* DraggedArea,
 	if (UWorld* World = DraggedArea->GetWorld())
 	{
 		FCollisionQueryParams Params(FName(TEXT("WorkArea_GroundTrace")), true, DraggedArea);
-		// Ignore all WorkAreas so we hit world
-		for (TActorIterator<AWorkArea> It(World); It; ++It)
-		{
-			Params.AddIgnoredActor(*It);
-		}
+		// Ignore the WorkAreas over the trace column so we hit world
+		TArray<AActor*> WorkAreasOnColumn;
+		QueryPlacementNeighbors(World, DesiredLocation, 1.f, WorkAreasOnColumn, EPlacementIndexFilter::WorkAreas);
+		Params.AddIgnoredActors(WorkAreasOnColumn);
 
 		// Iteratively ignore non-landscape hits until we find Landscape or no hit
 		const int32 MaxTries = 8;
@@ -1395,10 +1378,7 @@ void AExtendedControllerBase::SnapToActor(AWorkArea* DraggedActor, AActor* Other
                 const FVector TraceStart = MousePos;
                 const FVector TraceEnd = TraceStart + MouseDir * 1000000.f;
                 FCollisionQueryParams Params;
-                for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-                {
-                    Params.AddIgnoredActor(*It);
-                }
+                IgnoreAllWorkAreas(GetWorld(), Params);
                 FHitResult GroundHit;
                 if (GetWorld() && GetWorld()->LineTraceSingleByChannel(GroundHit, TraceStart, TraceEnd, ECC_Visibility, Params))
                 {
@@ -1648,10 +1628,7 @@ bool AExtendedControllerBase::TraceMouseToGround(FVector& OutMouseGround, FHitRe
     Params.bTraceComplex = true;
 
     // Ignore all actors of class AWorkArea
-    for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-    {
-        Params.AddIgnoredActor(*It);
-    }
+    IgnoreAllWorkAreas(GetWorld(), Params);
 
     if (!GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, Params))
     {
@@ -1841,10 +1818,15 @@ bool AExtendedControllerBase::TrySnapViaProximity(AWorkArea* DraggedWorkArea, co
     UStaticMeshComponent* BestCandidateMesh = nullptr;
     float BestCandidateDist = TNumericLimits<float>::Max();
 
+    // Only structures within snap reach of the dragged area can win
+    TArray<AActor*> Candidates;
+    const float CandidateRadius = SnapDistance + SnapGap + (Extent.X + Extent.Y) * 0.5f;
+    QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), CandidateRadius, Candidates, EPlacementIndexFilter::WorkAreas);
+
     // Scan WorkAreas
-    for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
+    for (AActor* CandidateActor : Candidates)
     {
-        AWorkArea* Candidate = *It;
+        AWorkArea* Candidate = Cast<AWorkArea>(CandidateActor);
         if (!Candidate || Candidate == DraggedWorkArea) continue;
 
         if (Candidate->IsNoBuildZone)
@@ -1878,9 +1860,10 @@ bool AExtendedControllerBase::TrySnapViaProximity(AWorkArea* DraggedWorkArea, co
     }
 
     // Scan Buildings
-    for (TActorIterator<ABuildingBase> ItB(GetWorld()); ItB; ++ItB)
+    QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), CandidateRadius, Candidates, EPlacementIndexFilter::Buildings);
+    for (AActor* CandidateActor : Candidates)
     {
-        ABuildingBase* Candidate = *ItB;
+        ABuildingBase* Candidate = Cast<ABuildingBase>(CandidateActor);
         if (!Candidate) continue;
 
         FVector OtherCenter, OtherExtent;
@@ -2041,13 +2024,11 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
         }
     };
 
-    for (TActorIterator<AWorkArea> It(World); It; ++It)
+    TArray<AActor*> NearbyStructures;
+    QueryPlacementNeighbors(World, DesiredGrounded, DragXY, NearbyStructures);
+    for (AActor* Candidate : NearbyStructures)
     {
-        ConsiderActor(*It);
-    }
-    for (TActorIterator<ABuildingBase> ItB(World); ItB; ++ItB)
-    {
-        ConsiderActor(*ItB);
+        ConsiderActor(Candidate);
     }
 
     // Helper: iterative push-away to satisfy distances vs all neighbors
@@ -2058,16 +2039,9 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
         const float MinStep = 0.1f;
         bOutAllGood = false;
 
-        // Build neighbor list once
+        // Neighbors are re-queried around the working location every iteration, the push can move it far
         TArray<AActor*> Neighbors;
-        for (TActorIterator<AWorkArea> ItWA(World); ItWA; ++ItWA)
-        {
-            if (*ItWA && *ItWA != DraggedWorkArea) Neighbors.Add(*ItWA);
-        }
-        for (TActorIterator<ABuildingBase> ItBD(World); ItBD; ++ItBD)
-        {
-            if (*ItBD) Neighbors.Add(*ItBD);
-        }
+        const float ResourceReach = DraggedWorkArea->DenyPlacementCloseToResources ? DraggedWorkArea->ResourcePlacementDistance : 0.f;
 
         FVector WorkingLoc = InOutLocation;
         bool bSolved = false;
@@ -2082,13 +2056,14 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
                 break; // cannot evaluate; treat as failure
             }
             const float DragR = FMath::Max(DragE.X, DragE.Y);
+            QueryPlacementNeighbors(World, DragC, FMath::Max(DragR + SnapGap, ResourceReach), Neighbors);
 
             bool bAnyViolation = false;
             FVector AccumulatedPush = FVector::ZeroVector;
 
             for (AActor* N : Neighbors)
             {
-                if (!N) continue;
+                if (!N || N == DraggedWorkArea) continue;
                 FVector NC, NE;
                 if (!GetActorBoundsForSnap(N, NC, NE)) continue;
                 const float NR = FMath::Max(NE.X, NE.Y);
@@ -2148,9 +2123,10 @@ bool AExtendedControllerBase::MoveWorkArea_Local_Simplified(float DeltaSeconds)
             {
                 const float DragR2 = FMath::Max(DragE2.X, DragE2.Y);
                 bool bStillBad = false;
+                QueryPlacementNeighbors(World, DragC2, FMath::Max(DragR2 + SnapGap, ResourceReach), Neighbors);
                 for (AActor* N : Neighbors)
                 {
-                    if (!N) continue;
+                    if (!N || N == DraggedWorkArea) continue;
                     FVector NC, NE;
                     if (!GetActorBoundsForSnap(N, NC, NE)) continue;
                     const float NR = FMath::Max(NE.X, NE.Y);
@@ -2252,16 +2228,10 @@ void AExtendedControllerBase::PerformWorkAreaDistanceResolution(AWorkArea* Dragg
     UWorld* World = GetWorld();
     if (!World) return;
 
-    // Build neighbor list once
+    // Neighbors are re-queried around the working location every iteration, the push can move it far
     TArray<AActor*> Neighbors;
-    for (TActorIterator<AWorkArea> ItWA(World); ItWA; ++ItWA)
-    {
-        if (*ItWA && *ItWA != DraggedWorkArea) Neighbors.Add(*ItWA);
-    }
-    for (TActorIterator<ABuildingBase> ItBD(World); ItBD; ++ItBD)
-    {
-        if (*ItBD) Neighbors.Add(*ItBD);
-    }
+    const float NeighborGap = bWorkAreaIsSnapped ? 0.f : SnapGap;
+    const float ResourceReach = DraggedWorkArea->DenyPlacementCloseToResources ? DraggedWorkArea->ResourcePlacementDistance : 0.f;
 
     FVector WorkingLoc = DraggedWorkArea->GetActorLocation();
     for (int32 Iter = 0; Iter < MaxIterations; ++Iter)
@@ -2274,13 +2244,14 @@ void AExtendedControllerBase::PerformWorkAreaDistanceResolution(AWorkArea* Dragg
             break; // cannot evaluate
         }
         const float DragR = FMath::Max(DragE.X, DragE.Y);
+        QueryPlacementNeighbors(World, DragC, FMath::Max(DragR + NeighborGap, ResourceReach), Neighbors);
 
         bool bAnyViolation = false;
         FVector AccumulatedPush = FVector::ZeroVector;
 
         for (AActor* N : Neighbors)
         {
-            if (!N) continue;
+            if (!N || N == DraggedWorkArea) continue;
             FVector NC, NE;
             if (!GetActorBoundsForSnap(N, NC, NE)) continue;
             const float NR = FMath::Max(NE.X, NE.Y);
@@ -2906,10 +2877,7 @@ void AExtendedControllerBase::MoveWorkArea_Local(float DeltaSeconds)
     //CollisionParams.AddIgnoredActor(DraggedWorkArea);
 
 	// Ignore all actors of class AWorkArea
-	for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
-	{
-		CollisionParams.AddIgnoredActor(*It);
-	}
+	IgnoreAllWorkAreas(GetWorld(), CollisionParams);
 	
 	bool bHit = GetWorld()->LineTraceSingleByChannel(
 		HitResult,
@@ -3130,10 +3098,15 @@ void AExtendedControllerBase::MoveWorkArea_Local(float DeltaSeconds)
         UStaticMeshComponent* BestCandidateMesh = nullptr;
         float BestCandidateDist = TNumericLimits<float>::Max();
 
+        // Only structures within snap reach of the dragged area can win
+        TArray<AActor*> Candidates;
+        const float CandidateRadius = SnapDistance + SnapGap + (Extent.X + Extent.Y) * 0.5f;
+        QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), CandidateRadius, Candidates, EPlacementIndexFilter::WorkAreas);
+
         // Scan WorkAreas
-        for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
+        for (AActor* CandidateActor : Candidates)
         {
-            AWorkArea* Candidate = *It;
+            AWorkArea* Candidate = Cast<AWorkArea>(CandidateActor);
             if (!Candidate || Candidate == DraggedWorkArea) continue;
 
             if (Candidate->IsNoBuildZone)
@@ -3168,9 +3141,10 @@ void AExtendedControllerBase::MoveWorkArea_Local(float DeltaSeconds)
         }
 
         // Scan Buildings
-        for (TActorIterator<ABuildingBase> ItB(GetWorld()); ItB; ++ItB)
+        QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), CandidateRadius, Candidates, EPlacementIndexFilter::Buildings);
+        for (AActor* CandidateActor : Candidates)
         {
-            ABuildingBase* Candidate = *ItB;
+            ABuildingBase* Candidate = Cast<ABuildingBase>(CandidateActor);
             if (!Candidate) continue;
 
             FVector OtherCenter, OtherExtent;
@@ -3490,10 +3464,15 @@ void AExtendedControllerBase::SetWorkArea(FTransform AreaTransform)
         UStaticMeshComponent* BestCandidateMesh = nullptr;
         float BestCandidateDist = TNumericLimits<float>::Max();
 
+        // Only structures within snap reach of the dragged area can win
+        TArray<AActor*> Candidates;
+        const float CandidateRadius = SnapDistance + SnapGap + (Extent.X + Extent.Y) * 0.5f;
+        QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), CandidateRadius, Candidates, EPlacementIndexFilter::WorkAreas);
+
         // Scan WorkAreas
-        for (TActorIterator<AWorkArea> It(GetWorld()); It; ++It)
+        for (AActor* CandidateActor : Candidates)
         {
-            AWorkArea* Candidate = *It;
+            AWorkArea* Candidate = Cast<AWorkArea>(CandidateActor);
             if (!Candidate || Candidate == DraggedWorkArea) continue;
 
             if (Candidate->IsNoBuildZone)
@@ -3528,9 +3507,10 @@ void AExtendedControllerBase::SetWorkArea(FTransform AreaTransform)
         }
 
         // Scan Buildings
-        for (TActorIterator<ABuildingBase> ItB(GetWorld()); ItB; ++ItB)
+        QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), CandidateRadius, Candidates, EPlacementIndexFilter::Buildings);
+        for (AActor* CandidateActor : Candidates)
         {
-            ABuildingBase* Candidate = *ItB;
+            ABuildingBase* Candidate = Cast<ABuildingBase>(CandidateActor);
             if (!Candidate) continue;
 
             FVector OtherCenter, OtherExtent;
@@ -3834,8 +3814,9 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
                 BestDist = D; BestCandidate = Candidate;
             }
         };
-        for (TActorIterator<AWorkArea> ItWA(World); ItWA; ++ItWA) { ConsiderActor(*ItWA); }
-        for (TActorIterator<ABuildingBase> ItBD(World); ItBD; ++ItBD) { ConsiderActor(*ItBD); }
+        TArray<AActor*> NearbyStructures;
+        QueryPlacementNeighbors(World, DesiredGrounded, DragXY, NearbyStructures);
+        for (AActor* Candidate : NearbyStructures) { ConsiderActor(Candidate); }
 
         auto ComputeSnapForIndicator = [&](AActor* OtherActor, FVector& OutLoc)
         {
@@ -3885,9 +3866,9 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
             const float Padding = 1.0f;
             const float MinStep = 0.1f;
             bOutAllGood = false;
+            // Neighbors are re-queried around the working location every iteration
             TArray<AActor*> Neighbors;
-            for (TActorIterator<AWorkArea> ItWA2(World); ItWA2; ++ItWA2) { if (*ItWA2) Neighbors.Add(*ItWA2); }
-            for (TActorIterator<ABuildingBase> ItBD2(World); ItBD2; ++ItBD2) { if (*ItBD2) Neighbors.Add(*ItBD2); }
+            const float ResourceReach = (CurrentIndicator->DetectOverlapWithWorkArea && CurrentIndicator->DenyPlacementCloseToResources) ? CurrentIndicator->ResourcePlacementDistance : 0.f;
             FVector Working = InOutLoc;
             bool bSolved = false;
             for (int32 Iter=0; Iter<MaxIterations; ++Iter)
@@ -3896,6 +3877,7 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
                 const FBoxSphereBounds DragNow = CurrentIndicator->IndicatorMesh->CalcBounds(CurrentIndicator->IndicatorMesh->GetComponentTransform());
                 const FVector DragExtNow = DragNow.BoxExtent;
                 const float DragR = FMath::Max(DragExtNow.X, DragExtNow.Y);
+                QueryPlacementNeighbors(World, DragNow.Origin, FMath::Max(DragR + SnapGap, ResourceReach), Neighbors);
                 bool bAnyViolation = false;
                 FVector Accum = FVector::ZeroVector;
                 for (AActor* N : Neighbors)
@@ -3949,6 +3931,7 @@ void AExtendedControllerBase::MoveAbilityIndicator_Local(float DeltaSeconds)
                 const FVector DragExtNow = DragNow.BoxExtent;
                 const float DragR = FMath::Max(DragExtNow.X, DragExtNow.Y);
                 bool bStillBad = false;
+                QueryPlacementNeighbors(World, DragNow.Origin, FMath::Max(DragR + SnapGap, ResourceReach), Neighbors);
                 for (AActor* N : Neighbors)
                 {
                     if (!N) continue;
@@ -4433,9 +4416,11 @@ bool AExtendedControllerBase::DropWorkAreaForUnit(AUnitBase* UnitBase, bool bWor
 			bool bTooCloseToResources = false;
 			if (DraggedWorkArea->DenyPlacementCloseToResources)
 			{
-				for (TActorIterator<AWorkArea> ItWA(GetWorld()); ItWA; ++ItWA)
+				TArray<AActor*> NearbyWorkAreas;
+				QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), DraggedWorkArea->ResourcePlacementDistance, NearbyWorkAreas, EPlacementIndexFilter::WorkAreas);
+				for (AActor* NearbyActor : NearbyWorkAreas)
 				{
-					AWorkArea* ResWA = *ItWA;
+					AWorkArea* ResWA = Cast<AWorkArea>(NearbyActor);
 					if (ResWA && ResWA != DraggedWorkArea)
 					{
 						const WorkAreaData::WorkAreaType T = ResWA->Type;
@@ -4564,9 +4549,11 @@ bool AExtendedControllerBase::DropWorkAreaForUnit(AUnitBase* UnitBase, bool bWor
 				if (!TargetBuilding && bWorkAreaIsSnapped)
 				{
 					float BestD = 250.f; // Small radius search
-					for (TActorIterator<ABuildingBase> It(GetWorld()); It; ++It)
+					TArray<AActor*> NearbyBuildings;
+					QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), BestD, NearbyBuildings, EPlacementIndexFilter::Buildings);
+					for (AActor* NearbyActor : NearbyBuildings)
 					{
-						ABuildingBase* BB = *It;
+						ABuildingBase* BB = Cast<ABuildingBase>(NearbyActor);
 						if (BB && BB != InitiatingBuilding && IsCompatibleForEnergyWall(InitiatingBuilding, BB))
 						{
 							float D = FVector::Dist2D(DraggedWorkArea->GetActorLocation(), BB->GetActorLocation());
@@ -4771,9 +4758,11 @@ bool AExtendedControllerBase::TryConnectEnergyWall(AUnitBase* UnitBase, AWorkAre
 	if (!TargetBuilding && bIsSnapped)
 	{
 		float BestD = 250.f;
-		for (TActorIterator<ABuildingBase> It(GetWorld()); It; ++It)
+		TArray<AActor*> NearbyBuildings;
+		QueryPlacementNeighbors(GetWorld(), DraggedWorkArea->GetActorLocation(), BestD, NearbyBuildings, EPlacementIndexFilter::Buildings);
+		for (AActor* NearbyActor : NearbyBuildings)
 		{
-			ABuildingBase* BB = *It;
+			ABuildingBase* BB = Cast<ABuildingBase>(NearbyActor);
 			if (BB && BB != InitiatingBuilding && IsCompatibleForEnergyWall(InitiatingBuilding, BB))
 			{
 				float D = FVector::Dist2D(DraggedWorkArea->GetActorLocation(), BB->GetActorLocation());
@@ -5300,6 +5289,11 @@ void AExtendedControllerBase::Client_DeselectSingleUnit_Implementation(AUnitBase
 	SelectedUnits = HUDBase->SelectedUnits;
 }
 
+uint32 AExtendedControllerBase::GetHudSelectionHash() const
+{
+	return HashCombine(Super::GetHudSelectionHash(), GetTypeHash(AbilityArrayIndex));
+}
+
 void AExtendedControllerBase::AddToCurrentUnitWidgetIndex(int Add)
 {
 	const int NumUnits = SelectedUnits.Num();
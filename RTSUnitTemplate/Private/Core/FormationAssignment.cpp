@@ -0,0 +1,276 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "Core/FormationAssignment.h"
+
+namespace
+{
+	// Epsilon is divided by this after every auction phase (Bertsekas suggests 4..10).
+	constexpr double AuctionEpsilonScaling = 6.0;
+
+	// Bids per unit and phase before the auction gives up and finishes greedily. Never hit on formation-like inputs.
+	constexpr int32 AuctionMaxBidsPerUnit = 256;
+
+	void AssignFreeSlotsGreedy(const FFormationCostMatrix& Cost, TArray<int32>& InOutAssignment, TArray<bool>& SlotTaken)
+	{
+		const int32 N = Cost.Num;
+		for (int32 Unit = 0; Unit < N; ++Unit)
+		{
+			if (InOutAssignment[Unit] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			const float* Row = Cost.Row(Unit);
+			int32 BestSlot = INDEX_NONE;
+			for (int32 Slot = 0; Slot < N; ++Slot)
+			{
+				if (!SlotTaken[Slot] && (BestSlot == INDEX_NONE || Row[Slot] < Row[BestSlot]))
+				{
+					BestSlot = Slot;
+				}
+			}
+			InOutAssignment[Unit] = BestSlot;
+			SlotTaken[BestSlot] = true;
+		}
+	}
+}
+
+void FFormationAssignment::Solve(EFormationAssignmentSolver Solver, const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment)
+{
+	switch (Solver)
+	{
+	case EFormationAssignmentSolver::Hungarian:
+		SolveHungarian(Cost, OutAssignment);
+		break;
+	case EFormationAssignmentSolver::GreedySwap:
+		SolveGreedySwap(Cost, OutAssignment);
+		break;
+	case EFormationAssignmentSolver::Auction:
+	default:
+		SolveAuction(Cost, OutAssignment);
+		break;
+	}
+}
+
+void FFormationAssignment::SolveHungarian(const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment)
+{
+	const int32 n = Cost.Num;
+	TArray<float> u; u.Init(0.f, n+1);
+	TArray<float> v; v.Init(0.f, n+1);
+	TArray<int32> p; p.Init(0, n+1);
+	TArray<int32> way; way.Init(0, n+1);
+	TArray<float> minv; minv.SetNumUninitialized(n+1);
+	TArray<bool> used; used.SetNumUninitialized(n+1);
+
+	for (int32 i = 1; i <= n; ++i)
+	{
+		p[0] = i;
+		int32 j0 = 0;
+		for (int32 j = 0; j <= n; ++j) { minv[j] = FLT_MAX; used[j] = false; }
+		do
+		{
+			used[j0] = true;
+			const int32 i0 = p[j0];
+			const float* Row = Cost.Row(i0-1);
+			float delta = FLT_MAX;
+			int32 j1 = 0;
+			for (int32 j = 1; j <= n; ++j)
+			{
+				if (!used[j])
+				{
+					const float cur = Row[j-1] - u[i0] - v[j];
+					if (cur < minv[j]) { minv[j] = cur; way[j] = j0; }
+					if (minv[j] < delta) { delta = minv[j]; j1 = j; }
+				}
+			}
+			for (int32 j = 0; j <= n; ++j)
+			{
+				if (used[j]) { u[p[j]] += delta; v[j] -= delta; }
+				else { minv[j] -= delta; }
+			}
+			j0 = j1;
+		} while (p[j0] != 0);
+
+		do
+		{
+			const int32 j1 = way[j0];
+			p[j0] = p[j1];
+			j0 = j1;
+		} while (j0);
+	}
+
+	OutAssignment.SetNumUninitialized(n);
+	for (int32 j = 1; j <= n; ++j)
+	{
+		if (p[j] > 0) OutAssignment[p[j] - 1] = j - 1;
+	}
+}
+
+void FFormationAssignment::SolveAuction(const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment, float RelativeTolerance)
+{
+	const int32 N = Cost.Num;
+	OutAssignment.Init(INDEX_NONE, N);
+	if (N <= 1)
+	{
+		if (N == 1) OutAssignment[0] = 0;
+		return;
+	}
+
+	// Cost range drives the starting epsilon, the row-minimum sum (a lower bound of the optimum) the final one:
+	// the auction ends within N * Epsilon of the optimum.
+	double MinCost = DBL_MAX;
+	double MaxCost = -DBL_MAX;
+	double LowerBound = 0.0;
+	for (int32 Unit = 0; Unit < N; ++Unit)
+	{
+		const float* Row = Cost.Row(Unit);
+		double RowMin = DBL_MAX;
+		for (int32 Slot = 0; Slot < N; ++Slot)
+		{
+			RowMin = FMath::Min<double>(RowMin, Row[Slot]);
+			MaxCost = FMath::Max<double>(MaxCost, Row[Slot]);
+		}
+		MinCost = FMath::Min(MinCost, RowMin);
+		LowerBound += RowMin;
+	}
+
+	if (MaxCost - MinCost <= 0.0)
+	{
+		for (int32 Unit = 0; Unit < N; ++Unit) OutAssignment[Unit] = Unit;
+		return;
+	}
+
+	const double FinalEpsilon = FMath::Max(RelativeTolerance * LowerBound / N, 1e-3);
+	double Epsilon = FMath::Max((MaxCost - MinCost) * 0.25, FinalEpsilon);
+
+	TArray<double> Prices; Prices.Init(0.0, N);
+	TArray<int32> SlotOwner; SlotOwner.SetNumUninitialized(N);
+	TArray<int32> Unassigned; Unassigned.SetNumUninitialized(N);
+	const int64 MaxBids = int64(AuctionMaxBidsPerUnit) * N;
+	bool bGaveUp = false;
+
+	while (!bGaveUp)
+	{
+		// Each phase restarts the assignment but keeps the prices of the previous (coarser) phase.
+		int32 NumUnassigned = N;
+		for (int32 k = 0; k < N; ++k)
+		{
+			OutAssignment[k] = INDEX_NONE;
+			SlotOwner[k] = INDEX_NONE;
+			Unassigned[k] = N - 1 - k;
+		}
+
+		int64 Bids = 0;
+		while (NumUnassigned > 0)
+		{
+			if (++Bids > MaxBids)
+			{
+				bGaveUp = true;
+				break;
+			}
+
+			const int32 Unit = Unassigned[--NumUnassigned];
+			const float* Row = Cost.Row(Unit);
+
+			// Best and second best slot by cost + price.
+			int32 BestSlot = INDEX_NONE;
+			double Best = DBL_MAX;
+			double Second = DBL_MAX;
+			for (int32 Slot = 0; Slot < N; ++Slot)
+			{
+				const double Value = Row[Slot] + Prices[Slot];
+				if (Value < Best)
+				{
+					Second = Best;
+					Best = Value;
+					BestSlot = Slot;
+				}
+				else if (Value < Second)
+				{
+					Second = Value;
+				}
+			}
+
+			Prices[BestSlot] += (Second - Best) + Epsilon;
+
+			const int32 Outbid = SlotOwner[BestSlot];
+			if (Outbid != INDEX_NONE)
+			{
+				OutAssignment[Outbid] = INDEX_NONE;
+				Unassigned[NumUnassigned++] = Outbid;
+			}
+			SlotOwner[BestSlot] = Unit;
+			OutAssignment[Unit] = BestSlot;
+		}
+
+		if (Epsilon <= FinalEpsilon)
+		{
+			break;
+		}
+		Epsilon = FMath::Max(Epsilon / AuctionEpsilonScaling, FinalEpsilon);
+	}
+
+	if (bGaveUp)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FormationAssignment: Auction exceeded its bid budget for %d units, finishing greedily."), N);
+		TArray<bool> SlotTaken; SlotTaken.Init(false, N);
+		for (int32 Unit = 0; Unit < N; ++Unit)
+		{
+			if (OutAssignment[Unit] != INDEX_NONE) SlotTaken[OutAssignment[Unit]] = true;
+		}
+		AssignFreeSlotsGreedy(Cost, OutAssignment, SlotTaken);
+		ImproveBySwaps(Cost, OutAssignment, 4);
+	}
+}
+
+void FFormationAssignment::SolveGreedySwap(const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment, int32 MaxSwapPasses)
+{
+	const int32 N = Cost.Num;
+	OutAssignment.Init(INDEX_NONE, N);
+	TArray<bool> SlotTaken; SlotTaken.Init(false, N);
+
+	// Units arrive sorted by radius (largest first), so big units claim their slots before small ones.
+	AssignFreeSlotsGreedy(Cost, OutAssignment, SlotTaken);
+	ImproveBySwaps(Cost, OutAssignment, MaxSwapPasses);
+}
+
+void FFormationAssignment::ImproveBySwaps(const FFormationCostMatrix& Cost, TArray<int32>& InOutAssignment, int32 MaxPasses)
+{
+	const int32 N = Cost.Num;
+	for (int32 Pass = 0; Pass < MaxPasses; ++Pass)
+	{
+		bool bImproved = false;
+		for (int32 A = 0; A < N; ++A)
+		{
+			const float* RowA = Cost.Row(A);
+			for (int32 B = A + 1; B < N; ++B)
+			{
+				const int32 SlotA = InOutAssignment[A];
+				const int32 SlotB = InOutAssignment[B];
+				const float* RowB = Cost.Row(B);
+				const double Delta = (double(RowA[SlotB]) + RowB[SlotA]) - (double(RowA[SlotA]) + RowB[SlotB]);
+				if (Delta < 0.0)
+				{
+					InOutAssignment[A] = SlotB;
+					InOutAssignment[B] = SlotA;
+					bImproved = true;
+				}
+			}
+		}
+
+		if (!bImproved)
+		{
+			break;
+		}
+	}
+}
+
+double FFormationAssignment::TotalCost(const FFormationCostMatrix& Cost, const TArray<int32>& Assignment)
+{
+	double Total = 0.0;
+	for (int32 Unit = 0; Unit < Assignment.Num(); ++Unit)
+	{
+		Total += Cost.At(Unit, Assignment[Unit]);
+	}
+	return Total;
+}
@@ -0,0 +1,150 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "Core/UnitRoster.h"
+
+void FUnitRoster::Add(int32 Handle, const FUnitRosterKey& Key)
+{
+	check(Handle >= 0);
+	if (Contains(Handle))
+	{
+		Update(Handle, Key);
+		return;
+	}
+
+	if (Handle >= Entries.Num())
+	{
+		Entries.SetNum(Handle + 1);
+	}
+	FEntry& Entry = Entries[Handle];
+	Entry.Key = Key;
+	Entry.bUsed = true;
+	++NumUsed;
+	Link(Handle);
+}
+
+void FUnitRoster::Remove(int32 Handle)
+{
+	if (!Contains(Handle))
+	{
+		return;
+	}
+	Unlink(Handle);
+	Entries[Handle] = FEntry();
+	--NumUsed;
+}
+
+bool FUnitRoster::Update(int32 Handle, const FUnitRosterKey& Key)
+{
+	if (!Contains(Handle) || Entries[Handle].Key == Key)
+	{
+		return false;
+	}
+	Unlink(Handle);
+	Entries[Handle].Key = Key;
+	Link(Handle);
+	return true;
+}
+
+TConstArrayView<int32> FUnitRoster::GetTeam(int32 TeamId) const
+{
+	if (const TArray<int32>* Members = TeamMembers.Find(TeamId))
+	{
+		return *Members;
+	}
+	return {};
+}
+
+TConstArrayView<int32> FUnitRoster::GetSquad(int32 TeamId, int32 SquadId) const
+{
+	if (SquadId <= 0)
+	{
+		return {};
+	}
+	if (const TArray<int32>* Members = SquadMembers.Find(SquadKey(TeamId, SquadId)))
+	{
+		return *Members;
+	}
+	return {};
+}
+
+int32 FUnitRoster::FindByUnitIndex(int32 UnitIndex) const
+{
+	const int32* Handle = UnitIndex >= 0 ? HandleByUnitIndex.Find(UnitIndex) : nullptr;
+	return Handle ? *Handle : INDEX_NONE;
+}
+
+void FUnitRoster::Reset()
+{
+	Entries.Reset();
+	TeamMembers.Reset();
+	SquadMembers.Reset();
+	HandleByUnitIndex.Reset();
+	NumUsed = 0;
+}
+
+void FUnitRoster::Link(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+
+	TArray<int32>& Team = TeamMembers.FindOrAdd(Entry.Key.TeamId);
+	Entry.TeamSlot = Team.Add(Handle);
+
+	if (Entry.Key.SquadId > 0)
+	{
+		TArray<int32>& Squad = SquadMembers.FindOrAdd(SquadKey(Entry.Key.TeamId, Entry.Key.SquadId));
+		Entry.SquadSlot = Squad.Add(Handle);
+	}
+
+	if (Entry.Key.UnitIndex >= 0)
+	{
+		HandleByUnitIndex.Add(Entry.Key.UnitIndex, Handle);
+	}
+}
+
+void FUnitRoster::Unlink(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+
+	// Swap-remove from the bucket and patch the slot of the member that moved into the gap.
+	auto RemoveFromBucket = [this](TArray<int32>& Bucket, int32 Slot, int32 FEntry::* SlotMember)
+	{
+		Bucket.RemoveAtSwap(Slot);
+		if (Slot < Bucket.Num())
+		{
+			Entries[Bucket[Slot]].*SlotMember = Slot;
+		}
+	};
+
+	if (TArray<int32>* Team = TeamMembers.Find(Entry.Key.TeamId))
+	{
+		RemoveFromBucket(*Team, Entry.TeamSlot, &FEntry::TeamSlot);
+		if (Team->IsEmpty())
+		{
+			TeamMembers.Remove(Entry.Key.TeamId);
+		}
+	}
+	Entry.TeamSlot = INDEX_NONE;
+
+	if (Entry.Key.SquadId > 0)
+	{
+		const FIntPoint Key = SquadKey(Entry.Key.TeamId, Entry.Key.SquadId);
+		if (TArray<int32>* Squad = SquadMembers.Find(Key))
+		{
+			RemoveFromBucket(*Squad, Entry.SquadSlot, &FEntry::SquadSlot);
+			if (Squad->IsEmpty())
+			{
+				SquadMembers.Remove(Key);
+			}
+		}
+	}
+	Entry.SquadSlot = INDEX_NONE;
+
+	if (Entry.Key.UnitIndex >= 0)
+	{
+		const int32* Filed = HandleByUnitIndex.Find(Entry.Key.UnitIndex);
+		if (Filed && *Filed == Handle)
+		{
+			HandleByUnitIndex.Remove(Entry.Key.UnitIndex);
+		}
+	}
+}
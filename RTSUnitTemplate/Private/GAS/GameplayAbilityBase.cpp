@@ -32,6 +32,8 @@
 #include "Mass/UnitMassTag.h"
 #include "Mass/Abilitys/CastingFallBackProcessor.h"
 #include "MassCommonFragments.h"
+#include "System/UnitIndexSubsystem.h"
+#include "System/ProjectilePoolSubsystem.h"
 
 // Static registry of disabled ability keys per team
 static TMap<int32, TSet<FString>> GDisabledAbilityKeysByTeam;
@@ -755,9 +757,8 @@ void UGameplayAbilityBase::SpawnProjectileFromClass(FVector Aim, AActor* Attacke
 			Transform.SetRotation(FQuat(InitialRotation));
 			Transform.SetScale3D(ShootingUnit->ProjectileScale*Scale);
 			
-			const auto MyProjectile = Cast<AProjectile>
-							(UGameplayStatics::BeginDeferredActorSpawnFromClass
-							(this, ProjectileClass, Transform,  ESpawnActorCollisionHandlingMethod::AlwaysSpawn));
+			UProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UProjectilePoolSubsystem>();
+			AProjectile* MyProjectile = ProjectilePool ? ProjectilePool->AcquireProjectile(ProjectileClass, Transform) : nullptr;
 			
 			if (MyProjectile != nullptr)
 			{
@@ -772,7 +773,7 @@ void UGameplayAbilityBase::SpawnProjectileFromClass(FVector Aim, AActor* Attacke
 			
 				//if(!MyProjectile->IsOnViewport) MyProjectile->SetProjectileVisibility(false);
 				//MyProjectile->SetProjectileVisibility();
-				UGameplayStatics::FinishSpawningActor(MyProjectile, Transform);
+				ProjectilePool->FinishProjectile(MyProjectile, Transform);
 				
 				//ShootingUnit->ProjectileAndEffectsVisibility(MyProjectile);
 			}
@@ -1120,12 +1121,12 @@ void UGameplayAbilityBase::UpgradeUnits(TSubclassOf<UGameplayEffect> UpgradeEffe
 	for (const FWorldContext& Context : GEngine->GetWorldContexts())
 	{
 		UWorld* World = Context.World();
-		if (World && !World->IsNetMode(NM_Client)) // Server or Standalone
+		UUnitIndexSubsystem* UnitIndexSubsystem = World ? World->GetSubsystem<UUnitIndexSubsystem>() : nullptr;
+		if (UnitIndexSubsystem && !World->IsNetMode(NM_Client)) // Server or Standalone
 		{
-			for (TActorIterator<AUnitBase> It(World); It; ++It)
+			UnitIndexSubsystem->ForEachTeamUnit(TeamId, [&](AUnitBase* Unit)
 			{
-				AUnitBase* Unit = *It;
-				if (Unit && Unit->TeamId == TeamId && Unit->UnitTags.HasTag(Tag))
+				if (Unit->UnitTags.HasTag(Tag))
 				{
 					if (UAbilitySystemComponent* ASC = Unit->GetAbilitySystemComponent())
 					{
@@ -1138,7 +1139,7 @@ void UGameplayAbilityBase::UpgradeUnits(TSubclassOf<UGameplayEffect> UpgradeEffe
 						}
 					}
 				}
-			}
+			});
 		}
 	}
 }
@@ -292,7 +292,7 @@ void ARTSGameModeBase::UpdateTagProgressForConfig(AWinLoseConfigActor* Config)
 			Progress.TargetCount = TargetCount;
 			NewTagProgress.Add(Progress);
 		}
-		Config->TagProgress = NewTagProgress;
+		Config->SetTagProgress(MoveTemp(NewTagProgress));
 	}
 }
 
@@ -14,6 +14,7 @@
 
 
 #include "System/MapSwitchSubsystem.h"
+#include "System/UnitIndexSubsystem.h"
 #include "Engine/GameInstance.h"
 
 AResourceGameMode::AResourceGameMode()
@@ -38,7 +39,6 @@ void AResourceGameMode::BeginPlay()
 	{
 		RGState->SetTeamResources(TeamResources); 
 	}
-	//AssignWorkAreasToWorkers();
 }
 
 void AResourceGameMode::CheckWinLoseConditionTimer()
@@ -367,24 +367,39 @@ bool AResourceGameMode::CanAffordConstructionExtended(const FBuildingCost& Const
 	return OutMissingResources.Num() == 0;
 }
 
-void AResourceGameMode::AssignWorkAreasToWorkers()
+namespace ResourceAssignment
 {
-	TArray<AActor*> TempActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AWorkingUnitBase::StaticClass(), TempActors);
-	
-	// Use the improved AssignWorkAreasToWorker function for each worker
-	// This ensures proper distribution with DistanceThresholdMultiplier and even worker distribution
-	for (AActor* MyActor : TempActors)
+	// Up to Count areas closest to ReferenceLocation, nearest first. Partial selection instead of sorting every area.
+	void SelectClosest(const TArray<AWorkArea*>& Areas, const FVector& ReferenceLocation, int32 Count, TArray<AWorkArea*>& OutClosest)
 	{
-		AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(MyActor);
-		
-		if (!Worker || !Worker->IsWorker) continue;
+		OutClosest.Reset();
+		if (Count <= 0)
+		{
+			return;
+		}
 
-		// Use the single worker assignment function which handles:
-		// - DistanceThresholdMultiplier threshold from base
-		// - Worker distribution constraints (TeamResources)
-		// - Even distribution based on worker count at each location
-		AssignWorkAreasToWorker(Worker);
+		TArray<float, TInlineAllocator<8>> ClosestDistSq;
+		for (AWorkArea* Area : Areas)
+		{
+			const float DistSq = FVector::DistSquared(Area->GetActorLocation(), ReferenceLocation);
+			if (OutClosest.Num() == Count && DistSq >= ClosestDistSq.Last())
+			{
+				continue;
+			}
+
+			int32 Slot = OutClosest.Num();
+			while (Slot > 0 && ClosestDistSq[Slot - 1] > DistSq)
+			{
+				--Slot;
+			}
+			if (OutClosest.Num() == Count)
+			{
+				OutClosest.Pop();
+				ClosestDistSq.Pop();
+			}
+			OutClosest.Insert(Area, Slot);
+			ClosestDistSq.Insert(DistSq, Slot);
+		}
 	}
 }
 
@@ -405,21 +420,26 @@ void AResourceGameMode::AssignWorkAreasToWorker(AWorkingUnitBase* Worker)
 		return;
 	}
 	
-	// Check if worker distribution is set for this team
-	const bool bWorkerDistributionSet = IsWorkerDistributionSet(Worker->TeamId);
-	
-	// Filter work places based on worker distribution settings and find the one with fewest workers
-	AWorkArea* BestWorkPlace = nullptr;
-	int32 LowestWorkerCount = INT_MAX;
-	
 	// Get the closest resource's distance as reference for threshold
 	const FVector ReferenceLocation = (Worker->Base && IsValid(Worker->Base)) 
 		? Worker->Base->GetActorLocation() 
 		: Worker->GetActorLocation();
+
+	AssignWorkPlace(Worker, WorkPlaces, ReferenceLocation, IsWorkerDistributionSet(Worker->TeamId));
+}
+
+void AResourceGameMode::AssignWorkPlace(AWorkingUnitBase* Worker, const TArray<AWorkArea*>& WorkPlaces, const FVector& ReferenceLocation, bool bWorkerDistributionSet)
+{
+	if (WorkPlaces.Num() == 0)
+	{
+		return;
+	}
+
+	// Filter work places based on worker distribution settings and find the one with fewest workers
+	AWorkArea* BestWorkPlace = nullptr;
+	int32 LowestWorkerCount = INT_MAX;
 	
-	const float ClosestDistance = WorkPlaces.Num() > 0 
-		? FVector::Dist(ReferenceLocation, WorkPlaces[0]->GetActorLocation()) 
-		: 0.f;
+	const float ClosestDistance = FVector::Dist(ReferenceLocation, WorkPlaces[0]->GetActorLocation());
 	const float DistanceThreshold = ClosestDistance * ResourceDistanceMultiplier;
 	
 	for (AWorkArea* WorkPlace : WorkPlaces)
@@ -490,6 +510,8 @@ void AResourceGameMode::AssignWorkAreasToWorker(AWorkingUnitBase* Worker)
 		BestWorkPlace = WorkPlaces[0];
 	}
 	
+	// Moves the worker's count from its previous place, so reassigning never counts it twice
+	ReleaseWorkPlace(Worker);
 	Worker->ResourcePlace = BestWorkPlace;
 
 	if (Worker->ResourcePlace)
@@ -505,6 +527,18 @@ void AResourceGameMode::AssignWorkAreasToWorker(AWorkingUnitBase* Worker)
 
 }
 
+void AResourceGameMode::ReleaseWorkPlace(AWorkingUnitBase* Worker)
+{
+	if (!Worker || !Worker->ResourcePlace)
+	{
+		return;
+	}
+
+	AddCurrentWorkersForResourceType(Worker->TeamId, ConvertToResourceType(Worker->ResourcePlace->Type), -1.0f);
+	Worker->ResourcePlace->RemoveWorkerFromArray(Worker);
+	Worker->ResourcePlace = nullptr;
+}
+
 ABuildingBase* AResourceGameMode::GetClosestBaseFromArray(AWorkingUnitBase* Worker, const TArray<ABuildingBase*>& Bases)
 {
     ABuildingBase* ClosestBase = nullptr;
@@ -561,50 +595,45 @@ AWorkArea* AResourceGameMode::GetClosestWorkArea(AWorkingUnitBase* Worker, const
 
 TArray<AWorkArea*> AResourceGameMode::GetFiveClosestResourcePlaces(AWorkingUnitBase* Worker)
 {
-	
-	WorkAreaGroups.PrimaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.SecondaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.TertiaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.RareAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.EpicAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.LegendaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	
 	TArray<AWorkArea*> AllAreas;
-	// Combine all resource areas into a single array for simplicity
-	AllAreas.Append(WorkAreaGroups.PrimaryAreas);
-	AllAreas.Append(WorkAreaGroups.SecondaryAreas);
-	AllAreas.Append(WorkAreaGroups.TertiaryAreas);
-	AllAreas.Append(WorkAreaGroups.RareAreas);
-	AllAreas.Append(WorkAreaGroups.EpicAreas);
-	AllAreas.Append(WorkAreaGroups.LegendaryAreas);
-	// Exclude BaseAreas and BuildAreas if they are not considered resource places
-
-	// Skip depleted resource areas (AvailableResourceAmount <= 0) and any stale/invalid pointers so
-	// workers are never assigned to a place they cannot actually extract from.
-	AllAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area) || Area->AvailableResourceAmount <= 0.f; });
+	GetAvailableResourcePlaces(AllAreas);
 
-	// Sort all areas by distance to the worker's base (if available), otherwise use worker location
+	// Select by distance to the worker's base (if available), otherwise use worker location
 	// This ensures resources are selected based on proximity to the base, not the worker's current position
 	const FVector ReferenceLocation = (Worker->Base && IsValid(Worker->Base)) 
 		? Worker->Base->GetActorLocation() 
 		: Worker->GetActorLocation();
-	
-	AllAreas.Sort([ReferenceLocation](const AWorkArea& AreaA, const AWorkArea& AreaB) {
-		return (AreaA.GetActorLocation() - ReferenceLocation).SizeSquared() < 
-			   (AreaB.GetActorLocation() - ReferenceLocation).SizeSquared();
-	});
 
-	// Take up to the first five areas
-	int32 NumAreas = FMath::Min(MaxResourceAreasToSet, AllAreas.Num());
 	TArray<AWorkArea*> ClosestAreas;
-	for (int i = 0; i < NumAreas; ++i)
-	{
-		ClosestAreas.Add(AllAreas[i]);
-	}
-
+	ResourceAssignment::SelectClosest(AllAreas, ReferenceLocation, MaxResourceAreasToSet, ClosestAreas);
 	return ClosestAreas;
 }
 
+void AResourceGameMode::GetAvailableResourcePlaces(TArray<AWorkArea*>& OutAreas)
+{
+	// Clean up all arrays in WorkAreaGroups to remove invalid pointers
+	WorkAreaGroups.PrimaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
+	WorkAreaGroups.SecondaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
+	WorkAreaGroups.TertiaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
+	WorkAreaGroups.RareAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
+	WorkAreaGroups.EpicAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
+	WorkAreaGroups.LegendaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
+
+	OutAreas.Reset();
+	// Combine all resource areas into a single array for simplicity
+	// Exclude BaseAreas and BuildAreas if they are not considered resource places
+	OutAreas.Append(WorkAreaGroups.PrimaryAreas);
+	OutAreas.Append(WorkAreaGroups.SecondaryAreas);
+	OutAreas.Append(WorkAreaGroups.TertiaryAreas);
+	OutAreas.Append(WorkAreaGroups.RareAreas);
+	OutAreas.Append(WorkAreaGroups.EpicAreas);
+	OutAreas.Append(WorkAreaGroups.LegendaryAreas);
+
+	// Skip depleted resource areas (AvailableResourceAmount <= 0) so workers are never assigned to a place
+	// they cannot actually extract from.
+	OutAreas.RemoveAll([](AWorkArea* Area) { return Area->AvailableResourceAmount <= 0.f; });
+}
+
 AWorkArea* AResourceGameMode::GetRandomClosestWorkArea(const TArray<AWorkArea*>& WorkAreas)
 {
 	if (WorkAreas.Num() > 0)
@@ -741,26 +770,8 @@ TArray<AWorkArea*> AResourceGameMode::GetClosestResourcePlaces(AWorkingUnitBase*
 
 TArray<AWorkArea*> AResourceGameMode::GetAllResourcePlaces(AWorkingUnitBase* Worker)
 {
-	// Clean up all arrays in WorkAreaGroups to remove invalid pointers
-	WorkAreaGroups.PrimaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.SecondaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.TertiaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.RareAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.EpicAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-	WorkAreaGroups.LegendaryAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area); });
-
 	TArray<AWorkArea*> AllAreas;
-	// Combine all resource areas into a single array for simplicity
-	AllAreas.Append(WorkAreaGroups.PrimaryAreas);
-	AllAreas.Append(WorkAreaGroups.SecondaryAreas);
-	AllAreas.Append(WorkAreaGroups.TertiaryAreas);
-	AllAreas.Append(WorkAreaGroups.RareAreas);
-	AllAreas.Append(WorkAreaGroups.EpicAreas);
-	AllAreas.Append(WorkAreaGroups.LegendaryAreas);
-
-	// Skip depleted resource areas (AvailableResourceAmount <= 0) and any stale/invalid pointers so
-	// workers are never assigned to a place they cannot actually extract from.
-	AllAreas.RemoveAll([](AWorkArea* Area) { return !IsValid(Area) || Area->AvailableResourceAmount <= 0.f; });
+	GetAvailableResourcePlaces(AllAreas);
 
 	// Sort all areas by distance to the worker's base (if available), otherwise use worker location
 	const FVector ReferenceLocation = (Worker->Base && IsValid(Worker->Base))
@@ -836,20 +847,18 @@ AWorkArea* AResourceGameMode::GetSuitableWorkAreaToWorker(int TeamId, const TArr
 
 void AResourceGameMode::AddMaxWorkersForResourceType(int TeamId, EResourceType ResourceType, float Amount)
 {
-	TArray<AActor*> TempActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AWorkingUnitBase::StaticClass(), TempActors);
-	
-	// Correctly use GetWorld()->GetAllActorsOfClass
+	// Only the team's own units are visited, not every actor of the world
 	int32 TeamWorkerCount = 0;
-	for (AActor* MyActor : TempActors)
+	if (UUnitIndexSubsystem* UnitIndex = GetWorld()->GetSubsystem<UUnitIndexSubsystem>())
 	{
-		AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(MyActor);
-		if (Worker && Worker->IsWorker && Worker->TeamId == TeamId)
+		UnitIndex->ForEachTeamUnit(TeamId, [&TeamWorkerCount](AUnitBase* Unit)
 		{
+			const AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(Unit);
+			if (Worker && Worker->IsWorker)
 			{
 				TeamWorkerCount++;
 			}
-		}
+		});
 	}
 
 	const int CurrentMaxWorkerCount = GetMaxWorkersForResourceType(TeamId, EResourceType::Primary) +
@@ -877,11 +886,7 @@ void AResourceGameMode::AddMaxWorkersForResourceType(int TeamId, EResourceType R
 		}
 	}
 
-	AResourceGameState* RGState = GetGameState<AResourceGameState>();
-	if (RGState)
-	{
-		RGState->SetTeamResources(TeamResources);
-	}
+	SyncTeamResourcesToGameState();
 }
 
 void AResourceGameMode::SetCurrentWorkersForResourceType(int TeamId, EResourceType ResourceType, float Amount)
@@ -901,36 +906,7 @@ void AResourceGameMode::SetCurrentWorkersForResourceType(int TeamId, EResourceTy
 		}
 	}
 
-	AResourceGameState* RGState = GetGameState<AResourceGameState>();
-	if (RGState)
-	{
-		RGState->SetTeamResources(TeamResources);
-	}
-}
-
-void AResourceGameMode::SetAllCurrentWorkers(int TeamId)
-{
-	TArray<AActor*> TempActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AWorkingUnitBase::StaticClass(), TempActors);
-	
-	TMap<EResourceType, int32> WorkerCountPerType;
-	
-	for (AActor* MyActor : TempActors)
-	{
-		AWorkingUnitBase* Worker = Cast<AWorkingUnitBase>(MyActor);
-		if (Worker && Worker->ResourcePlace && Worker->TeamId == TeamId)
-		{
-			// Cast the Controller property to AWorkingUnitController
-				EResourceType ResourceType = ConvertToResourceType(Worker->ResourcePlace->Type);
-				// SAVE WORKERCOUNT DEPENDING ON RESOURCETYPE
-				WorkerCountPerType.FindOrAdd(ResourceType)++;
-		}
-	}
-	// Setting current workers for each resource type
-	for (const auto& Pair : WorkerCountPerType)
-	{
-		SetCurrentWorkersForResourceType(TeamId, Pair.Key, Pair.Value);
-	}
+	SyncTeamResourcesToGameState();
 }
 
 void AResourceGameMode::AddCurrentWorkersForResourceType(int TeamId, EResourceType ResourceType, float Amount)
@@ -950,11 +926,7 @@ void AResourceGameMode::AddCurrentWorkersForResourceType(int TeamId, EResourceTy
 		}
 	}
 
-	AResourceGameState* RGState = GetGameState<AResourceGameState>();
-	if (RGState)
-	{
-		RGState->SetTeamResources(TeamResources);
-	}
+	SyncTeamResourcesToGameState();
 }
 
 
@@ -997,3 +969,11 @@ bool AResourceGameMode::IsWorkerDistributionSet(int TeamId) const
 	}
 	return false;
 }
+
+void AResourceGameMode::SyncTeamResourcesToGameState()
+{
+	if (AResourceGameState* RGState = GetGameState<AResourceGameState>())
+	{
+		RGState->SetTeamResources(TeamResources);
+	}
+}
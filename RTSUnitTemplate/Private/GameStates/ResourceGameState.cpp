@@ -5,6 +5,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Widgets/LoadingWidget.h"
 #include "Controller/PlayerController/CameraControllerBase.h"
+#include "System/HudEventSubsystem.h"
 
 void AResourceGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
@@ -32,10 +33,15 @@ void AResourceGameState::OnRep_LoadingWidgetConfig()
 
 void AResourceGameState::OnRep_TeamResources()
 {
-	// Handle any logic needed when TeamResources updates, such as notifying UI elements to refresh.
+	if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+	{
+		HudEvents->NotifyResourcesChanged();
+	}
 }
 
 void AResourceGameState::SetTeamResources(TArray<FResourceArray> Resources)
 {
 	TeamResources = Resources;
+	// No OnRep on the server; listen servers and standalone games refresh their HUD here.
+	OnRep_TeamResources();
 }
@@ -21,6 +21,8 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "MassEntitySubsystem.h"
+#include "MassActorSubsystem.h"
+#include "Mass/UnitPickingSubsystem.h"
 #include "Mass/UnitMassTag.h"
 #include "Mass/MassUnitVisualFragments.h"
 #include "Characters/Unit/MassUnitBase.h"
@@ -1168,10 +1170,24 @@ void AHUDBase::SelectISMUnitsInRectangle(const FVector2D& RectMin, const FVector
     if (!Controller)
         return;
 
-    // Iterate all MassUnitBase actors (which includes UnitBase)
-	for (TActorIterator<AMassUnitBase> It(GetWorld()); It; ++It)
+    // Only units whose pick volume can project into the marquee are tested per instance.
+    UUnitPickingSubsystem* PickingSubsystem = GetWorld()->GetSubsystem<UUnitPickingSubsystem>();
+    UMassEntitySubsystem* EntitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>();
+    if (!PickingSubsystem || !PickingSubsystem->HasSnapshot() || !EntitySubsystem)
+        return;
+
+    const FMassEntityManager& EntityManager = EntitySubsystem->GetEntityManager();
+    TArray<int32> CandidateEntries;
+    PickingSubsystem->QueryScreenRect(*PC, RectMin, RectMax, CandidateEntries);
+
+    for (const int32 EntryIndex : CandidateEntries)
     {
-        AMassUnitBase* Unit = *It;
+        const FUnitPickEntry& PickEntry = PickingSubsystem->GetEntries()[EntryIndex];
+        if (PickEntry.Kind != EUnitPickKind::Unit || !EntityManager.IsEntityValid(PickEntry.Entity))
+            continue;
+
+        const FMassActorFragment* ActorFrag = EntityManager.GetFragmentDataPtr<FMassActorFragment>(PickEntry.Entity);
+        AMassUnitBase* Unit = ActorFrag ? const_cast<AMassUnitBase*>(Cast<AMassUnitBase>(ActorFrag->Get())) : nullptr;
         if (!Unit) continue;
 
         if (Unit->bUseSkeletalMovement || (Controller->SelectableTeamId != 0 && Unit->TeamId != Controller->SelectableTeamId))
@@ -1,6 +1,7 @@
 // Copyright 2025 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
 #include "Mass/ActorTransformSyncProcessor.h"
 #include "Mass/UnitMassTag.h"
+#include "Subsystems/GroundHeightCacheSubsystem.h"
 
 #include "MassExecutionContext.h"
 #include "MassEntityManager.h"
@@ -49,6 +50,15 @@ UActorTransformSyncProcessor::UActorTransformSyncProcessor()
     // Optional ExecutionOrder settings...
 }
 
+void UActorTransformSyncProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+    Super::InitializeInternal(Owner, EntityManager);
+    if (UWorld* World = Owner.GetWorld())
+    {
+        GroundHeightCache = World->GetSubsystem<UGroundHeightCacheSubsystem>();
+    }
+}
+
 void UActorTransformSyncProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
         EntityQuery.Initialize(EntityManager);
@@ -211,31 +221,57 @@ void UActorTransformSyncProcessor::HandleGroundAndHeight(const AUnitBase* UnitBa
     */
 
     // --- Ground/Height Adjustment Logic ---
-    FHitResult Hit;
-    FCollisionQueryParams Params;
-    Params.AddIgnoredActor(UnitBase);
-    FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+    const float TraceTopZ = InOutFinalLocation.Z + 1000.0f;
+    const float TraceBottomZ = InOutFinalLocation.Z - 2000.0f;
 
-    const FVector TraceStart = FVector(InOutFinalLocation.X, InOutFinalLocation.Y, InOutFinalLocation.Z + 1000.0f);
-    const FVector TraceEnd = FVector(InOutFinalLocation.X, InOutFinalLocation.Y, InOutFinalLocation.Z - 2000.0f);
+    bool bHasHit = false;
+    bool bHitValidActor = false;
+    bool bHitIsUnit = false;
+    float HitZ = 0.f;
+    FVector HitNormal = FVector::UpVector;
 
-    if (GetWorld()->LineTraceSingleByObjectType(Hit, TraceStart, TraceEnd, ObjectParams, Params))
+    // Static ground comes from the cached heightfield; only misses, multi-layer areas and buildings are traced.
+    if (GroundHeightCache && GroundHeightCache->GetGroundHeight(InOutFinalLocation, HitZ, HitNormal) && HitZ <= TraceTopZ && HitZ >= TraceBottomZ)
     {
-        
-        const AActor* HitActor = Hit.GetActor();
-        const float DeltaZ = Hit.ImpactPoint.Z - CurrentZ;
+        bHasHit = true;
+        bHitValidActor = true;
+    }
+    else
+    {
+        FHitResult Hit;
+        FCollisionQueryParams Params;
+        Params.AddIgnoredActor(UnitBase);
+        FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+
+        const FVector TraceStart = FVector(InOutFinalLocation.X, InOutFinalLocation.Y, TraceTopZ);
+        const FVector TraceEnd = FVector(InOutFinalLocation.X, InOutFinalLocation.Y, TraceBottomZ);
+
+        if (GetWorld()->LineTraceSingleByObjectType(Hit, TraceStart, TraceEnd, ObjectParams, Params))
+        {
+            const AActor* HitActor = Hit.GetActor();
+            bHasHit = true;
+            bHitValidActor = IsValid(HitActor);
+            bHitIsUnit = bHitValidActor && HitActor->IsA(AUnitBase::StaticClass());
+            HitZ = Hit.ImpactPoint.Z;
+            HitNormal = Hit.ImpactNormal;
+        }
+    }
+
+    if (bHasHit)
+    {
+        const float DeltaZ = HitZ - CurrentZ;
 
-        if (IsValid(HitActor) && !HitActor->IsA(AUnitBase::StaticClass()) && DeltaZ <= (HeightOffset+100.f) && !CharFragment.bIsFlying) // && DeltaZ <= HeightOffset
+        if (bHitValidActor && !bHitIsUnit && DeltaZ <= (HeightOffset+100.f) && !CharFragment.bIsFlying) // && DeltaZ <= HeightOffset
         {
-            CharFragment.LastGroundLocation = Hit.ImpactPoint.Z;
-            const float TargetZ = Hit.ImpactPoint.Z + HeightOffset;
+            CharFragment.LastGroundLocation = HitZ;
+            const float TargetZ = HitZ + HeightOffset;
             InOutFinalLocation.Z = FMath::FInterpConstantTo(CurrentZ, TargetZ, ActualDeltaTime, VerticalInterpSpeed * 100.f);
 
             if (CharFragment.GroundAlignment)
             {
                 // Pitch-only Slope-Alignment: richte die Vorwärtsachse auf die Projektion auf der Bodenebene aus,
                 // rotiere dabei ausschließlich um die Right-Achse (kein Roll), Yaw bleibt erhalten.
-                const FVector SurfaceUp = Hit.ImpactNormal.GetSafeNormal();
+                const FVector SurfaceUp = HitNormal.GetSafeNormal();
 
                 // Yaw-Only Basis aus aktueller Rotation
                 const FRotator CurrentRot = MassTransform.GetRotation().Rotator();
@@ -302,13 +338,13 @@ void UActorTransformSyncProcessor::HandleGroundAndHeight(const AUnitBase* UnitBa
             );
             MassTransform.SetRotation(NewRotQuat);
         }
-        else if (IsValid(HitActor) && CharFragment.bIsFlying) // Flying, but a hit occurred (e.g., flying over terrain)
+        else if (bHitValidActor && CharFragment.bIsFlying) // Flying, but a hit occurred (e.g., flying over terrain)
         {
-            const float TargetZ = bIsDead ? Hit.ImpactPoint.Z + HeightOffset : Hit.ImpactPoint.Z + CharFragment.FlyHeight;
+            const float TargetZ = bIsDead ? HitZ + HeightOffset : HitZ + CharFragment.FlyHeight;
             const float InterpSpeed = bIsDead ? VerticalDeadInterpSpeed : VerticalInterpSpeed;
             
             InOutFinalLocation.Z = FMath::FInterpConstantTo(CurrentZ, TargetZ, ActualDeltaTime, InterpSpeed * 100.f);
-            CharFragment.LastGroundLocation = Hit.ImpactPoint.Z;
+            CharFragment.LastGroundLocation = HitZ;
 
             // For flying units, maintain flat pitch/roll unless specific flight controls dictate otherwise
             FRotator CurrentRotation = MassTransform.GetRotation().Rotator();
@@ -13,7 +13,6 @@
 namespace
 {
     static constexpr float InitialCellSize = 100.f;
-    static constexpr float LifeTime = 3.0f;
     static constexpr float LargeRadiusThreshold = InitialCellSize/2.f;
     static constexpr float SubObstacleRadius = InitialCellSize;
     static constexpr float ClusteringDistanceThreshold = 150.f;
@@ -21,6 +20,28 @@ namespace
     const FColor BoxColor_Single = FColor::Red;
     const FColor SubBoxColor_Circle = FColor::Orange;
     const FColor SubBoxColor_Merged = FColor::Yellow;
+
+    /** Bounds an obstacle is registered with; large circles are split into boxes along the rim. */
+    template<typename FuncType>
+    void ForEachObstacleBounds(const FVector& Location, const float Radius, FuncType&& Func)
+    {
+        if (Radius > LargeRadiusThreshold)
+        {
+            const float SubObstacleDiameter = SubObstacleRadius * 2.0f;
+            const int32 NumSubObstacles = FMath::CeilToInt((2.0f * PI * Radius) / SubObstacleDiameter);
+
+            for (int32 j = 0; j < NumSubObstacles; ++j)
+            {
+                const float Angle = (static_cast<float>(j) / NumSubObstacles) * 2.0f * PI;
+                const FVector Offset(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f);
+                Func(FBox(Location + Offset - FVector(SubObstacleRadius), Location + Offset + FVector(SubObstacleRadius)), true);
+            }
+        }
+        else
+        {
+            Func(FBox(Location - FVector(Radius), Location + FVector(Radius)), false);
+        }
+    }
 }
 
 
@@ -75,41 +96,60 @@ void UDynamicObstacleRegProcessor::Execute(FMassEntityManager& EntityManager, FM
     }
     TimeSinceLastRun -= ExecutionInterval;
 
-    // --- NEW: Destroy volumes spawned in the previous frame ---
-    for (const TWeakObjectPtr<AActor>& VolumePtr : SpawnedNavVolumes)
-    {
-        if (VolumePtr.IsValid())
-        {
-            VolumePtr->Destroy();
-        }
-    }
-    SpawnedNavVolumes.Empty(); // Clear the array for the new frame
-
     UMassNavigationSubsystem* NavSys = Context.GetWorld()->GetSubsystem<UMassNavigationSubsystem>();
     if (!ensure(NavSys != nullptr))
     {
         return;
     }
 
-    // Clear and re-initialize the grid for this frame.
-    NavSys->GetObstacleGridMutable().Initialize(InitialCellSize);
+    UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(Context.GetWorld());
+    if (!NavSystem) return;
+
+    // The grid is set up once per world. Afterwards entities are only added, moved and removed individually,
+    // so standing units cost a position compare per run instead of a navmesh projection and a grid insert.
+    if (RegisteredNavSys.Get() != NavSys)
+    {
+        NavSys->GetObstacleGridMutable().Initialize(InitialCellSize);
+        RegisteredObstacles.Reset();
+        RegisteredNavSys = NavSys;
+    }
+
+    ++RunStamp;
 
-    // Pass 1: Collect static obstacles and immediately process dynamic ones.
     auto ProcessQuery = [&](FMassEntityQuery& Query)
     {
-        CollectAndProcessObstacles(Context, Query, *NavSys);
+        CollectAndProcessObstacles(Context, Query, *NavSys, *NavSystem);
     };
 
     ProcessQuery(BuildObstacleQuery);
     ProcessQuery(RepairObstacleQuery);
     ProcessQuery(PauseObstacleQuery);
     ProcessQuery(IdleObstacleQuery);
+
+    // Not matched this run: left the stationary state, took off, died or was destroyed.
+    for (auto It = RegisteredObstacles.CreateIterator(); It; ++It)
+    {
+        if (It.Value().SeenStamp != RunStamp)
+        {
+            RemoveObstacleFromGrid(*NavSys, It.Key(), It.Value());
+            It.RemoveCurrent();
+        }
+        else if (Debug)
+        {
+            ForEachObstacleBounds(It.Value().Location, It.Value().Radius, [&](const FBox& Bounds, const bool bSubObstacle)
+            {
+                if (It.Value().CellLocations.Num() > 0)
+                {
+                    DrawDebugBox(NavSys->GetWorld(), Bounds.GetCenter(), Bounds.GetExtent(), bSubObstacle ? SubBoxColor_Circle : BoxColor_Single, false, ExecutionInterval, 0, 2.0f);
+                }
+            });
+        }
+    }
 }
 
-void UDynamicObstacleRegProcessor::CollectAndProcessObstacles(FMassExecutionContext& Context, FMassEntityQuery& Query, UMassNavigationSubsystem& NavSys)
+void UDynamicObstacleRegProcessor::CollectAndProcessObstacles(FMassExecutionContext& Context, FMassEntityQuery& Query, UMassNavigationSubsystem& NavSys, UNavigationSystemV1& NavSystem)
 {
-    UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(Context.GetWorld());
-    if (!NavSystem) return;
+    const float ToleranceSq = FMath::Square(UpdateTolerance);
 
     Query.ForEachEntityChunk(Context, [&](FMassExecutionContext& ChunkContext)
     {
@@ -123,48 +163,60 @@ void UDynamicObstacleRegProcessor::CollectAndProcessObstacles(FMassExecutionCont
 
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             const FVector Location = CharList[i].PositionedTransform.GetLocation();
-            
+            const float Radius = Colliders[i].GetCircleCollider().Radius;
+
+            FRegisteredObstacle* Obstacle = RegisteredObstacles.Find(Entity);
+            if (Obstacle)
+            {
+                // Already handled by an earlier query this run (e.g. Pause and Idle).
+                if (Obstacle->SeenStamp == RunStamp) continue;
+                Obstacle->SeenStamp = RunStamp;
+
+                if (FVector::DistSquared(Location, Obstacle->Location) <= ToleranceSq
+                    && FMath::Abs(Radius - Obstacle->Radius) <= UpdateTolerance)
+                {
+                    continue;
+                }
+                RemoveObstacleFromGrid(NavSys, Entity, *Obstacle);
+            }
+            else
+            {
+                Obstacle = &RegisteredObstacles.Add(Entity);
+                Obstacle->SeenStamp = RunStamp;
+            }
+
+            Obstacle->Location = Location;
+            Obstacle->Radius = Radius;
+
+            // Off the navmesh the entity stays registered without grid items, so it is only projected again after moving.
             FNavLocation NavLoc;
-            if (!NavSystem->ProjectPointToNavigation(Location, NavLoc, FVector(100.f, 100.f, 300.f)))
+            if (!NavSystem.ProjectPointToNavigation(Location, NavLoc, FVector(100.f, 100.f, 300.f)))
             {
                 continue;
             }
-
-            const float Radius = Colliders[i].GetCircleCollider().Radius;
             
             // Stationary units should always be obstacles
-            AddSingleObstacleToGrid(NavSys, Entity, Location, Radius);
+            AddSingleObstacleToGrid(NavSys, Entity, *Obstacle);
         }
     });
 }
 
-
-
-
-void UDynamicObstacleRegProcessor::AddSingleObstacleToGrid(UMassNavigationSubsystem& NavSys, const FMassEntityHandle Entity, const FVector& Location, const float Radius)
+void UDynamicObstacleRegProcessor::AddSingleObstacleToGrid(UMassNavigationSubsystem& NavSys, const FMassEntityHandle Entity, FRegisteredObstacle& Obstacle)
 {
-    // ... implementation is unchanged ...
-    UWorld* World = NavSys.GetWorld();
-    if (Radius > LargeRadiusThreshold)
+    FNavigationObstacleHashGrid2D& Grid = NavSys.GetObstacleGridMutable();
+    ForEachObstacleBounds(Obstacle.Location, Obstacle.Radius, [&](const FBox& Bounds, const bool /*bSubObstacle*/)
     {
-        const float SubObstacleDiameter = SubObstacleRadius * 2.0f;
-        const int32 NumSubObstacles = FMath::CeilToInt((2.0f * PI * Radius) / SubObstacleDiameter);
-
-        for (int32 j = 0; j < NumSubObstacles; ++j)
-        {
-            const float Angle = (static_cast<float>(j) / NumSubObstacles) * 2.0f * PI;
-            const FVector Offset(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f);
-            const FBox SubBounds(Location + Offset - FVector(SubObstacleRadius), Location + Offset + FVector(SubObstacleRadius));
-
-            if (Debug) DrawDebugBox(World, SubBounds.GetCenter(), SubBounds.GetExtent(), SubBoxColor_Circle, false, LifeTime, 0, 2.0f);
+        Obstacle.CellLocations.Add(Grid.Add(FMassNavigationObstacleItem(Entity, EMassNavigationObstacleFlags::HasColliderData), Bounds));
+    });
+}
 
-            NavSys.GetObstacleGridMutable().Add(FMassNavigationObstacleItem(Entity, EMassNavigationObstacleFlags::HasColliderData), SubBounds);
-        }
-    }
-    else
+void UDynamicObstacleRegProcessor::RemoveObstacleFromGrid(UMassNavigationSubsystem& NavSys, const FMassEntityHandle Entity, FRegisteredObstacle& Obstacle)
+{
+    FNavigationObstacleHashGrid2D& Grid = NavSys.GetObstacleGridMutable();
+    // Sub-obstacles of one entity may share a cell; each Remove takes out exactly one of its items there.
+    for (const FNavigationObstacleHashGrid2D::FCellLocation& CellLocation : Obstacle.CellLocations)
     {
-        const FBox Bounds(Location - FVector(Radius), Location + FVector(Radius));
-        if (Debug) DrawDebugBox(World, Bounds.GetCenter(), Bounds.GetExtent(), BoxColor_Single, false, LifeTime, 0, 2.0f);
-        NavSys.GetObstacleGridMutable().Add(FMassNavigationObstacleItem(Entity, EMassNavigationObstacleFlags::HasColliderData), Bounds);
+        Grid.Remove(FMassNavigationObstacleItem(Entity, EMassNavigationObstacleFlags::HasColliderData), CellLocation);
     }
+    Obstacle.CellLocations.Reset();
 }
@@ -11,6 +11,8 @@
 #include "NavigationSystem.h"
 #include "HAL/IConsoleManager.h"
 #include "Engine/World.h" // UWorld::IsNetMode / NM_Client
+#include "Mass/UnitCellGrid.h"
+#include "Async/ParallelFor.h"
 
 // CLIENT-ONLY multiplier for the separation (lateral unit-unit push) force. Separation's lateral shove is the
 // main residual client jitter source when many units funnel a tight curve (large Overlap -> strong sideways
@@ -52,6 +54,8 @@ UUnitSeparationProcessor::UUnitSeparationProcessor()
 	ProcessingPhase = EMassProcessingPhase::PrePhysics;
 	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Client | EProcessorExecutionFlags::Standalone);
 	bAutoRegisterWithProcessingPhases = true;
+	// The gather pass projects onto the navmesh, which is not safe off the game thread while it rebuilds.
+	// Only the pair loop runs in parallel (ParallelFor inside Execute).
 	bRequiresGameThreadExecution = true;
 }
 
@@ -87,9 +91,18 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 	TimeSinceLastRun -= ExecutionInterval;
 
 	TArray<FClumpUnitInfo> Units;
-	Units.Reserve(256);
+	Units.Reserve(EntityQuery.GetNumMatchingEntities());
 
-	auto GatherFromQuery = [this, &EntityManager, &Units, &Context](FMassExecutionContext& LocalContext)
+	// Dense slot per matched entity in query iteration order (INDEX_NONE = skipped), so the apply pass
+	// can read the push back without a map lookup. Both passes run on the same query with no structural
+	// change in between, so chunk order is identical.
+	TArray<int32> SlotByMatchIndex;
+	SlotByMatchIndex.Reserve(Units.Max());
+
+	float MaxCapsuleRadius = 0.f;
+	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(Context.GetWorld());
+
+	auto GatherFromQuery = [&EntityManager, &Units, &SlotByMatchIndex, &MaxCapsuleRadius, NavSystem](FMassExecutionContext& LocalContext)
 	{
 		const int32 Num = LocalContext.GetNumEntities();
 		const auto Transforms = LocalContext.GetFragmentView<FTransformFragment>();
@@ -98,7 +111,9 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 		const auto Targets = LocalContext.GetFragmentView<FMassAITargetFragment>();
 		const auto MoveTargets = LocalContext.GetFragmentView<FMassMoveTargetFragment>();
 
-		UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(Context.GetWorld());
+		// Tags are per archetype, so read them once per chunk instead of per entity.
+		const bool bChunkUsesWorkerStrength = LocalContext.DoesArchetypeHaveTag<FMassStateResourceExtractionTag>();
+		const bool bChunkIsBracingAgainstWall = LocalContext.DoesArchetypeHaveTag<FMassSoftAvoidanceTag>();
 
 		for (int32 i = 0; i < Num; ++i)
 		{
@@ -108,6 +123,7 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 				FNavLocation NavLoc;
 				if (!NavSystem->ProjectPointToNavigation(Location, NavLoc, FVector(100.f, 100.f, 300.f)))
 				{
+					SlotByMatchIndex.Add(INDEX_NONE);
 					continue;
 				}
 			}
@@ -131,55 +147,64 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 			Info.CapsuleRadius = Characs[i].CapsuleRadius;
 			Info.Target = Targets[i].TargetEntity;
 			Info.bIsFlying = Characs[i].bIsFlying;
-			
-			Info.bUseWorkerStrength = DoesEntityHaveTag(EntityManager, Info.Entity, FMassStateResourceExtractionTag::StaticStruct());
+			Info.bUseWorkerStrength = bChunkUsesWorkerStrength;
 
 			// NEU: Prüfe, ob die Einheit an der Wand steht
-			Info.bIsBracingAgainstWall = DoesEntityHaveTag(EntityManager, Info.Entity, FMassSoftAvoidanceTag::StaticStruct());
+			Info.bIsBracingAgainstWall = bChunkIsBracingAgainstWall;
 			Info.bIsFollowing = EntityManager.IsEntityActive(Targets[i].FriendlyTargetEntity);
 
-			/*DoesEntityHaveTag(EntityManager, Info.Entity, FMassStateGoToBaseTag::StaticStruct()) || 
-								   DoesEntityHaveTag(EntityManager, Info.Entity, FMassStateResourceExtractionTag::StaticStruct()) ||
-								   DoesEntityHaveTag(EntityManager, Info.Entity, FMassStateGoToResourceExtractionTag::StaticStruct());
-			*/
+			MaxCapsuleRadius = FMath::Max(MaxCapsuleRadius, Info.CapsuleRadius);
+			SlotByMatchIndex.Add(Units.Num());
 			Units.Add(Info);
 		}
 	};
 
 	EntityQuery.ForEachEntityChunk(Context, GatherFromQuery);
-	
-	if (Debug)
-	{
-		UWorld* World = Context.GetWorld();
-		if (Units.Num() > 0)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("UUnitSeparationProcessor: Processing %d units"), Units.Num());
-		}
-		for (const auto& Info : Units)
-		{
-			FVector DebugLocation = Info.Location + FVector(0, 0, 5.f);
-			DrawDebugCircle(World, DebugLocation, Info.CapsuleRadius, 16, FColor::Green, false, ExecutionInterval * 2.f, 0, 2.f, FVector(1, 0, 0), FVector(0, 1, 0));
-		}
-	}
 
 	if (Units.Num() <= 1)
 	{
 		return;
 	}
 
-	TMap<FMassEntityHandle, FVector> AccumPush;
-	AccumPush.Reserve(Units.Num());
+	// Largest distance at which any pair can still push: the desired spacing of the two biggest capsules,
+	// optionally capped by MaxCheckRadius. With that as cell size only the 3x3 neighbor cells can interact.
+	const float MaxDesired = FMath::Max(1.f, 2.f * MaxCapsuleRadius) * FMath::Max(DistanceMultiplierFriendly, DistanceMultiplierEnemy);
+	const float InteractionRadius = MaxCheckRadius > 0.f ? FMath::Min(MaxCheckRadius, MaxDesired) : MaxDesired;
 
-	for (int32 a = 0; a < Units.Num(); ++a)
+	FUnitCellGrid2D Grid;
+	Grid.Reset(InteractionRadius, Units.Num());
+	for (const FClumpUnitInfo& Info : Units)
+	{
+		Grid.AddItem(Info.Location);
+	}
+	Grid.Finalize();
+
+	// Each unit only accumulates its own push, so the per-unit loop writes a single dense slot and runs in parallel.
+	TArray<FVector> AccumPush;
+	AccumPush.SetNumZeroed(Units.Num());
+
+	ParallelFor(Units.Num(), [this, &Units, &Grid, &AccumPush](int32 a)
 	{
 		const FClumpUnitInfo& A = Units[a];
-		for (int32 b = a + 1; b < Units.Num(); ++b)
+
+		// Units bracing against a wall push the crowd back but are not pushed through the wall themselves.
+		if (A.bIsBracingAgainstWall)
 		{
+			return;
+		}
+
+		FVector Push = FVector::ZeroVector;
+		Grid.ForEachInNeighborhood(Grid.GetItemCell(a), [this, &Units, &A, &Push, a](const int32 b)
+		{
+			if (b == a)
+			{
+				return;
+			}
 			const FClumpUnitInfo& B = Units[b];
 
 			if (A.bIsFlying != B.bIsFlying)
 			{
-				continue;
+				return;
 			}
 
 			const bool bSameTeam = (A.TeamId == B.TeamId);
@@ -188,7 +213,7 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 			{
 				if (A.Target != B.Target || !A.Target.IsSet())
 				{
-					continue;
+					return;
 				}
 			}
 
@@ -199,7 +224,7 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 
 			if (MaxCheckRadius > 0.f && DistSq > FMath::Square(MaxCheckRadius))
 			{
-				continue;
+				return;
 			}
 
 			if (DistSq < Desired * Desired)
@@ -209,71 +234,56 @@ void UUnitSeparationProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 				const float Overlap = Desired - Dist;
 				
 				float StrengthA = A.bUseWorkerStrength ? RepulsionStrengthWorker : (bSameTeam ? RepulsionStrengthFriendly : RepulsionStrengthEnemy);
-				float StrengthB = B.bUseWorkerStrength ? RepulsionStrengthWorker : (bSameTeam ? RepulsionStrengthFriendly : RepulsionStrengthEnemy);
-
 				if (A.bIsFollowing) StrengthA *= 0.5f;
-				if (B.bIsFollowing) StrengthB *= 0.5f;
 
 				const FVector RightA = FVector(-A.Forward.Y, A.Forward.X, 0.f);
 				float LateralAmountA = DirAB | RightA;
 				if (FMath::Abs(LateralAmountA) < KINDA_SMALL_NUMBER)
 				{
-					LateralAmountA = (A.Entity.Index < B.Entity.Index) ? 1.0f : -1.0f;
-				}
-				FVector PushA = RightA * (-LateralAmountA * Overlap * StrengthA);
-
-				const FVector RightB = FVector(-B.Forward.Y, B.Forward.X, 0.f);
-				float LateralAmountB = DirAB | RightB;
-				if (FMath::Abs(LateralAmountB) < KINDA_SMALL_NUMBER)
-				{
-					LateralAmountB = (B.Entity.Index < A.Entity.Index) ? 1.0f : -1.0f;
-				}
-				FVector PushB = RightB * (LateralAmountB * Overlap * StrengthB);
-
-				// GEÄNDERT: Wende die Kraft NUR an, wenn die Einheit nicht an der Wand lehnt!
-				// So stoßen die Einheiten an der Wand die Crowd zurück, lassen sich aber nicht durch die Wand quetschen.
-				if (!A.bIsBracingAgainstWall)
-				{
-					AccumPush.FindOrAdd(A.Entity) += PushA;
+					// Head-on: same tie-break as the former pairwise loop. The lower slot of the pair takes the
+					// A role, the other one the B role with the mirrored sign, so each unit sidesteps along its
+					// own right vector and two units meeting head-on pass each other on opposite sides.
+					const float IndexSign = (A.Entity.Index < B.Entity.Index) ? 1.0f : -1.0f;
+					LateralAmountA = (a < b) ? IndexSign : -IndexSign;
 				}
+				Push += RightA * (-LateralAmountA * Overlap * StrengthA);
+			}
+		});
 
-				if (!B.bIsBracingAgainstWall)
-				{
-					AccumPush.FindOrAdd(B.Entity) += PushB;
-				}
+		AccumPush[a] = Push;
+	}, Units.Num() < 64 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-				if (Debug)
-				{
-					UWorld* World = Context.GetWorld();
-					FVector LineStartA = A.Location + FVector(0, 0, 5.f);
-					FVector LineStartB = B.Location + FVector(0, 0, 5.f);
-					DrawDebugLine(World, LineStartA, LineStartA + PushA * 0.1f, FColor::Red, false, ExecutionInterval * 2.f, 0, 2.f);
-					DrawDebugLine(World, LineStartB, LineStartB + PushB * 0.1f, FColor::Red, false, ExecutionInterval * 2.f, 0, 2.f);
-				}
+	if (Debug)
+	{
+		UWorld* World = Context.GetWorld();
+		UE_LOG(LogTemp, Warning, TEXT("UUnitSeparationProcessor: Processing %d units"), Units.Num());
+		for (int32 i = 0; i < Units.Num(); ++i)
+		{
+			const FVector DebugLocation = Units[i].Location + FVector(0, 0, 5.f);
+			DrawDebugCircle(World, DebugLocation, Units[i].CapsuleRadius, 16, FColor::Green, false, ExecutionInterval * 2.f, 0, 2.f, FVector(1, 0, 0), FVector(0, 1, 0));
+			if (!AccumPush[i].IsNearlyZero())
+			{
+				DrawDebugLine(World, DebugLocation, DebugLocation + AccumPush[i] * 0.1f, FColor::Red, false, ExecutionInterval * 2.f, 0, 2.f);
 			}
 		}
 	}
 
-	if (AccumPush.Num() == 0)
-	{
-		return;
-	}
-
 	// Weaken the separation push on the client only (server stays authoritative at full strength).
 	const UWorld* SepWorld = Context.GetWorld();
 	const float ClientSepScale = (SepWorld && SepWorld->IsNetMode(NM_Client))
 		? CVarRTS_ClientSeparationForceScale.GetValueOnAnyThread() : 1.f;
 
-	auto ApplyToQuery = [&AccumPush, ClientSepScale](FMassExecutionContext& LocalContext)
+	int32 MatchIndex = 0;
+	auto ApplyToQuery = [&AccumPush, &SlotByMatchIndex, &MatchIndex, ClientSepScale](FMassExecutionContext& LocalContext)
 	{
 		const int32 Num = LocalContext.GetNumEntities();
 		auto ForceList = LocalContext.GetMutableFragmentView<FMassForceFragment>();
-		for (int32 i = 0; i < Num; ++i)
+		for (int32 i = 0; i < Num; ++i, ++MatchIndex)
 		{
-			const FMassEntityHandle Entity = LocalContext.GetEntity(i);
-			if (const FVector* Push = AccumPush.Find(Entity))
+			const int32 Slot = SlotByMatchIndex.IsValidIndex(MatchIndex) ? SlotByMatchIndex[MatchIndex] : INDEX_NONE;
+			if (Slot != INDEX_NONE)
 			{
-				ForceList[i].Value += Horizontal(*Push) * ClientSepScale;
+				ForceList[i].Value += Horizontal(AccumPush[Slot]) * ClientSepScale;
 			}
 		}
 	};
@@ -12,6 +12,8 @@
 #include "MassNavigationFragments.h" // For FMassAgentCharacteristicsFragment
 #include "Async/Async.h"
 #include "Mass/Signals/UnitSignalingProcessor.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
+#include "Mass/UnitPresenceSubsystem.h"
 
 
 
@@ -31,19 +33,7 @@ void UDetectionProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FM
     {
         SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
         EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>();
-        
-        if (SignalSubsystem)
-        {
-
-            if (SignalDelegateHandle.IsValid())
-            {
-                SignalSubsystem->GetSignalDelegateByName(UnitSignals::UnitInDetectionRange).Remove(SignalDelegateHandle);
-            }
-
-            SignalDelegateHandle = SignalSubsystem->GetSignalDelegateByName(UnitSignals::UnitInDetectionRange)
-                                      .AddUObject(this, &UDetectionProcessor::HandleUnitPresenceSignal);
-
-        }
+        PresenceSubsystem = World->GetSubsystem<UUnitPresenceSubsystem>();
     }
 }
 
@@ -52,14 +42,8 @@ void UDetectionProcessor::BeginDestroy()
 	Super::BeginDestroy();
 }
 
-// Called by the Signal Subsystem when the corresponding signal is processed
-void UDetectionProcessor::HandleUnitPresenceSignal(FName SignalName, TConstArrayView<FMassEntityHandle> Entities)
-{
-    ReceivedSignalsBuffer.FindOrAdd(SignalName).Append(Entities.GetData(), Entities.Num());
-}
-
 void UDetectionProcessor::InjectCurrentTargetIfMissing(const FDetectorUnitInfo& DetectorInfo,
-    TArray<FTargetUnitInfo>& InOutTargetUnits, FMassEntityManager& EntityManager)
+    TArray<FUnitPresenceEntry>& InOutInjectedTargets, FMassEntityManager& EntityManager)
 {
     // 1. Check if the detector has a valid target stored.
     if (DetectorInfo.TargetFrag->bHasValidTarget && DetectorInfo.TargetFrag->TargetEntity.IsSet())
@@ -67,20 +51,18 @@ void UDetectionProcessor::InjectCurrentTargetIfMissing(const FDetectorUnitInfo&
         const FMassEntityHandle CurrentTargetEntity = DetectorInfo.TargetFrag->TargetEntity;
 
         // 2. Check if this target is already in our list of potential targets.
-        const bool bAlreadyInList = InOutTargetUnits.ContainsByPredicate(
-            [&CurrentTargetEntity](const FTargetUnitInfo& Info) {
-                return Info.Entity == CurrentTargetEntity;
-            });
+        const bool bAlreadyInList = PresenceSubsystem->FindEntryIndex(CurrentTargetEntity) != INDEX_NONE
+            || InOutInjectedTargets.ContainsByPredicate([CurrentTargetEntity](const FUnitPresenceEntry& Injected) { return Injected.Entity == CurrentTargetEntity; });
 
-        // 3. If it's NOT in the list, we need to add it.
+        // 3. If it's NOT in the list, we need to add it (e.g. spawned this frame or filtered out of the snapshot).
         if (!bAlreadyInList)
         {
-            // We must fetch its data directly from the EntityManager to build the FTargetUnitInfo struct.
+            // We must fetch its data directly from the EntityManager to build the snapshot row.
             if (EntityManager.IsEntityActive(CurrentTargetEntity) && !DoesEntityHaveTag(EntityManager, CurrentTargetEntity, FMassStopUnitDetectionTag::StaticStruct()))
             {
                 const FMassCombatStatsFragment* TgtStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(CurrentTargetEntity);
                 
-                // NEW: Allianz-Prüfung hier! Wenn das aktuelle Ziel alliiert ist, fügen wir es gar nicht erst zu TargetUnits hinzu.
+                // NEW: Allianz-Prüfung hier! Wenn das aktuelle Ziel alliiert ist, fügen wir es gar nicht erst zur Zielliste hinzu.
                 if (TgtStats && DetectorInfo.Alliance && (DetectorInfo.Alliance->AlliedTeamsMask & (1LL << TgtStats->TeamId)) && !DetectorInfo.TargetFrag->IsFocusedOnTarget)
                 {
                     return;
@@ -96,14 +78,29 @@ void UDetectionProcessor::InjectCurrentTargetIfMissing(const FDetectorUnitInfo&
                 {
                     if (TgtStats->Health > 0)
                     {
-                        InOutTargetUnits.Add({
-                            CurrentTargetEntity,
-                            TgtTransformFrag->GetTransform().GetLocation(),
-                            TgtState,
-                            TgtStats,
-                            TgtChar, // Optional
-                            SightFragment // Optional
-                            });
+                        FUnitPresenceEntry& Injected = InOutInjectedTargets.AddDefaulted_GetRef();
+                        Injected.Entity = CurrentTargetEntity;
+                        Injected.Location = TgtTransformFrag->GetTransform().GetLocation();
+                        Injected.TeamId = TgtStats->TeamId;
+                        Injected.Health = TgtStats->Health;
+                        Injected.BirthTime = TgtState->BirthTime;
+                        Injected.DeathTime = TgtState->DeathTime;
+                        Injected.bCanAttack = TgtState->CanAttack;
+                        // Optional
+                        Injected.bHasCharacteristics = TgtChar != nullptr;
+                        if (TgtChar)
+                        {
+                            Injected.CapsuleRadius = TgtChar->CapsuleRadius;
+                            Injected.bIsFlying = TgtChar->bIsFlying;
+                            Injected.bIsInvisible = TgtChar->bIsInvisible;
+                        }
+                        // Optional
+                        if (SightFragment)
+                        {
+                            Injected.SeenByTeamsMask = SightFragment->ConsistentTeamOverlapsPerTeam.GetNonZeroMask();
+                            Injected.DetectedByTeamsMask = SightFragment->ConsistentDetectorOverlapsPerTeam.GetNonZeroMask();
+                            Injected.AttackedByTeamsMask = SightFragment->ConsistentAttackerTeamOverlapsPerTeam.GetNonZeroMask();
+                        }
                     }
                 }
             }
@@ -135,65 +132,36 @@ void UDetectionProcessor::Execute(
     FMassEntityManager&   EntityManager,
     FMassExecutionContext& Context)
 {
-    // 1) Timer
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    // 1) Timer - only the phase buckets that came up this frame are evaluated below.
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun = 0.f;
     
-    TArray<FMassEntityHandle> PotentialTargets;
-    if (const TArray<FMassEntityHandle>* ReceivedEntities = ReceivedSignalsBuffer.Find(UnitSignals::UnitInDetectionRange))
+    if (!PresenceSubsystem)
     {
-        PotentialTargets = *ReceivedEntities;
+        return;
     }
-    
-    // NEW: Clear the buffer for the next frame.
-    ReceivedSignalsBuffer.Reset();
-
-    TArray<FTargetUnitInfo> TargetUnits;
-    TargetUnits.Reserve(256);
-    
-    for (const FMassEntityHandle& TgtEntity : PotentialTargets)
-    {
-        if (!EntityManager.IsEntityActive(TgtEntity) || DoesEntityHaveTag(EntityManager, TgtEntity, FMassStopUnitDetectionTag::StaticStruct()))
-        {
-             continue;
-        }
-
-        // Fetch all required fragments for this target
-        FTransformFragment* TgtTransformFrag = EntityManager.GetFragmentDataPtr<FTransformFragment>(TgtEntity);
-        FMassAIStateFragment* TgtState = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(TgtEntity);
-        const FMassCombatStatsFragment* TgtStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(TgtEntity);
-        const FMassAgentCharacteristicsFragment* TgtChar = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TgtEntity);
-        const FMassSightFragment* SightFragment = EntityManager.GetFragmentDataPtr<FMassSightFragment>(TgtEntity);
 
-        if (!TgtTransformFrag || !TgtState || !TgtStats)
-        {
-            continue;
-        }
-        
-        const float Age = World->GetTimeSeconds() - TgtState->BirthTime;
-        if (Age < 0.1f && Age >= 0.f) 
-        {
-            continue;
-        }
+    // Targets are the rows UUnitPresenceProcessor published this frame (time-sliced runs without a publish
+    // keep the last one), followed by current targets the snapshot did not contain.
+    const TArray<FUnitPresenceEntry>& PresentUnits = PresenceSubsystem->GetEntries();
+    TArray<FUnitPresenceEntry> InjectedTargets;
 
-        if (TgtStats->Health <= 0)
+    auto GetTarget = [&PresentUnits, &InjectedTargets](const int32 TargetIndex) -> const FUnitPresenceEntry&
+    {
+        return TargetIndex < PresentUnits.Num() ? PresentUnits[TargetIndex] : InjectedTargets[TargetIndex - PresentUnits.Num()];
+    };
+    auto FindTargetIndex = [this, &PresentUnits, &InjectedTargets](const FMassEntityHandle Entity) -> int32
+    {
+        const int32 EntryIndex = PresenceSubsystem->FindEntryIndex(Entity);
+        if (EntryIndex != INDEX_NONE)
         {
-            continue;
+            return EntryIndex;
         }
-        
-        TargetUnits.Add({
-                TgtEntity,
-                TgtTransformFrag->GetTransform().GetLocation(),
-                TgtState,
-                TgtStats,
-                TgtChar,
-                SightFragment
-            });
-    }
+        const int32 InjectedIndex = InjectedTargets.IndexOfByPredicate([Entity](const FUnitPresenceEntry& Injected) { return Injected.Entity == Entity; });
+        return InjectedIndex != INDEX_NONE ? PresentUnits.Num() + InjectedIndex : INDEX_NONE;
+    };
     
     TArray<FDetectorUnitInfo> DetectorUnits;
     DetectorUnits.Reserve(256);
@@ -231,12 +199,23 @@ void UDetectionProcessor::Execute(
         }
     });
 
-    // 3) For each detector, scan every other unit to pick BestEntity / CurrentStillViable
+    // 3) For each detector, scan nearby units to pick BestEntity / CurrentStillViable
     TArray<FMassSignalPayload> PendingSignals;
     PendingSignals.Reserve(DetectorUnits.Num());
 
+    // Candidates come from the shared spatial grid when it was rebuilt this frame, otherwise every target is a candidate.
+    const UUnitSpatialGridSubsystem* Grid = World->GetSubsystem<UUnitSpatialGridSubsystem>();
+    const bool bUseGrid = Grid && Grid->IsBuiltThisFrame();
+    TArray<int32> Candidates;
+    Candidates.Reserve(64);
+
+    // All detectors are gathered (squad sharing reads every mate), only the due buckets are re-evaluated.
     for (auto& Det : DetectorUnits)
     {
+        if (!TimeSlice.IsDue(Det.Entity))
+        {
+            continue;
+        }
 
         const float Now = World->GetTimeSeconds();
         const float DetCapsule = Det.Char ? Det.Char->CapsuleRadius : 0.f;
@@ -259,16 +238,19 @@ void UDetectionProcessor::Execute(
             continue;
         }
         
-        InjectCurrentTargetIfMissing(Det, TargetUnits, EntityManager);
+        InjectCurrentTargetIfMissing(Det, InjectedTargets, EntityManager);
 
         // Schutz vor Client-Flapping:
         if (World->GetNetMode() == NM_Client && Det.TargetFrag->bHasValidTarget && Det.TargetFrag->TargetEntity.IsSet())
         {
             if (EntityManager.IsEntityActive(Det.TargetFrag->TargetEntity))
             {
-                if (const FTransformFragment* TgtXf = EntityManager.GetFragmentDataPtr<FTransformFragment>(Det.TargetFrag->TargetEntity))
+                // Position and team from the target snapshot row when the grid was built this frame.
+                const FUnitSpatialGridEntry* TgtRow = bUseGrid ? Grid->FindEntry(Det.TargetFrag->TargetEntity) : nullptr;
+                const FTransformFragment* TgtXf = TgtRow ? nullptr : EntityManager.GetFragmentDataPtr<FTransformFragment>(Det.TargetFrag->TargetEntity);
+                if (TgtRow || TgtXf)
                 {
-                    const FVector TgtLoc = TgtXf->GetTransform().GetLocation();
+                    const FVector TgtLoc = TgtRow ? TgtRow->Location : TgtXf->GetTransform().GetLocation();
                     Det.TargetFrag->LastKnownLocation = TgtLoc;
 
                     // Prüfe, ob das Ziel noch grob in Sichtweite ist (mit Puffer für Replikations-Differenzen)
@@ -277,9 +259,11 @@ void UDetectionProcessor::Execute(
 
                     // NEW: Also check if target is allied. If so, don't protect it.
                     bool bIsAllied = false;
-                    if (const FMassCombatStatsFragment* TgtStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Det.TargetFrag->TargetEntity))
+                    const FMassCombatStatsFragment* TgtStats = TgtRow ? nullptr : EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(Det.TargetFrag->TargetEntity);
+                    if (TgtRow || TgtStats)
                     {
-                        bIsAllied = (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << TgtStats->TeamId))) && !Det.TargetFrag->IsFocusedOnTarget;
+                        const int32 TgtTeamId = TgtRow ? TgtRow->TeamId : TgtStats->TeamId;
+                        bIsAllied = (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << TgtTeamId))) && !Det.TargetFrag->IsFocusedOnTarget;
                     }
 
                     if (DistSq < LoseSightSq && !bIsAllied)
@@ -293,28 +277,25 @@ void UDetectionProcessor::Execute(
         // Add  Det.TargetFrag->TargetEntity to TargetUnits if it is not already inside
         if (Det.TargetFrag->IsFocusedOnTarget)
         {
-            bool bFoundInList = false;
-            for (auto& Tgt : TargetUnits)
+            const int32 FocusedIdx = FindTargetIndex(Det.TargetFrag->TargetEntity);
+            if (FocusedIdx != INDEX_NONE)
             {
-                if (Tgt.Entity != Det.TargetFrag->TargetEntity) 
-                    continue;
-                
-                bFoundInList = true;
-                const int32* SightCount = Tgt.Sight ? Tgt.Sight->ConsistentTeamOverlapsPerTeam.Find(DetectorTeamId) : nullptr;
-                const int32* DetectorSightCount = Tgt.Sight ? Tgt.Sight->ConsistentDetectorOverlapsPerTeam.Find(DetectorTeamId) : nullptr;
+                const FUnitPresenceEntry& Tgt = GetTarget(FocusedIdx);
+                const bool bSeen = Tgt.IsSeenByTeam(DetectorTeamId);
+                const bool bDetected = Tgt.IsDetectedByTeam(DetectorTeamId);
 
                 const float DistSq = FVector::DistSquared2D(Det.Location, Tgt.Location);
-                const float TgtCapsule = Tgt.Char ? Tgt.Char->CapsuleRadius : 0.f;
+                const float TgtCapsule = Tgt.CapsuleRadius;
                 const float EffectiveMinRangeSq = Det.Stats->MinRange > 0.f ? FMath::Square(Det.Stats->MinRange + DetCapsule + TgtCapsule) : 0.f;
       
-                const bool bIsAllied = (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << Tgt.Stats->TeamId)));
-                if (Tgt.Entity == Det.TargetFrag->TargetEntity && Tgt.Stats->Health > 0)
+                const bool bIsAllied = (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << Tgt.TeamId)));
+                if (Tgt.Entity == Det.TargetFrag->TargetEntity && Tgt.Health > 0)
                 {
                     bCurrentStillViable = true;
-                    bCurrentTargetCanAttack = Tgt.State->CanAttack;
+                    bCurrentTargetCanAttack = Tgt.bCanAttack;
                     
-                    const bool bIsAlliedOrSameTeam = (Tgt.Stats->TeamId == Det.Stats->TeamId || bIsAllied);
-                    const bool bInSight = ((Tgt.Char && !Tgt.Char->bIsInvisible && SightCount && *SightCount > 0) || (Tgt.Char && Tgt.Char->bIsInvisible && DetectorSightCount && *DetectorSightCount > 0) || !Tgt.Char);
+                    const bool bIsAlliedOrSameTeam = (Tgt.TeamId == Det.Stats->TeamId || bIsAllied);
+                    const bool bInSight = ((Tgt.bHasCharacteristics && !Tgt.bIsInvisible && bSeen) || (Tgt.bHasCharacteristics && Tgt.bIsInvisible && bDetected) || !Tgt.bHasCharacteristics);
 
                     if (bIsAlliedOrSameTeam || bInSight)
                     {
@@ -326,7 +307,6 @@ void UDetectionProcessor::Execute(
                         CurrentLocation = Det.TargetFrag->LastKnownLocation;
                     }
                 }
-                break;
             }
         }
 
@@ -346,24 +326,45 @@ void UDetectionProcessor::Execute(
 
                 // Validate basic target conditions (alive and enemy). Range does not matter here.
                 if (!EntityManager.IsEntityActive(SquadTarget)) continue;
-                const FMassCombatStatsFragment* SquadTgtStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(SquadTarget);
-                if (!SquadTgtStats || DoesEntityHaveTag(EntityManager, SquadTarget, FMassStopUnitDetectionTag::StaticStruct())) continue;
-                if (SquadTgtStats->TeamId == Det.Stats->TeamId && !Mate.TargetFrag->IsFocusedOnTarget) continue;
-                if (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << SquadTgtStats->TeamId)) && !Mate.TargetFrag->IsFocusedOnTarget) continue;
-                if (SquadTgtStats->Health <= 0) continue;
+                if (DoesEntityHaveTag(EntityManager, SquadTarget, FMassStopUnitDetectionTag::StaticStruct())) continue;
+
+                // Snapshot row when the grid was built this frame, the target's fragments otherwise.
+                int32 SquadTgtTeamId;
+                float SquadTgtHealth;
+                bool bSquadTgtCanAttack;
+                FVector SquadTgtLocation;
+                float TgtCapsule;
+                if (const FUnitSpatialGridEntry* SquadRow = bUseGrid ? Grid->FindEntry(SquadTarget) : nullptr)
+                {
+                    SquadTgtTeamId = SquadRow->TeamId;
+                    SquadTgtHealth = SquadRow->Health;
+                    bSquadTgtCanAttack = SquadRow->bCanAttack;
+                    SquadTgtLocation = SquadRow->Location;
+                    TgtCapsule = SquadRow->Radius;
+                }
+                else
+                {
+                    const FMassCombatStatsFragment* SquadTgtStats = EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(SquadTarget);
+                    const FMassAIStateFragment* SquadTgtState = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(SquadTarget);
+                    if (!SquadTgtStats || !SquadTgtState) continue;
+
+                    const FTransformFragment* SquadTgtTransform = EntityManager.GetFragmentDataPtr<FTransformFragment>(SquadTarget);
+                    const FMassAgentCharacteristicsFragment* SquadTgtChar = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(SquadTarget);
+                    SquadTgtTeamId = SquadTgtStats->TeamId;
+                    SquadTgtHealth = SquadTgtStats->Health;
+                    bSquadTgtCanAttack = SquadTgtState->CanAttack;
+                    SquadTgtLocation = SquadTgtTransform ? SquadTgtTransform->GetTransform().GetLocation() : FVector::ZeroVector;
+                    TgtCapsule = SquadTgtChar ? SquadTgtChar->CapsuleRadius : 0.f;
+                }
 
-                const FMassAIStateFragment* SquadTgtState = EntityManager.GetFragmentDataPtr<FMassAIStateFragment>(SquadTarget);
-                if (!SquadTgtState) continue;
+                if (SquadTgtTeamId == Det.Stats->TeamId && !Mate.TargetFrag->IsFocusedOnTarget) continue;
+                if (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << SquadTgtTeamId)) && !Mate.TargetFrag->IsFocusedOnTarget) continue;
+                if (SquadTgtHealth <= 0) continue;
 
                 // If current target can't attack, but squad target also can't attack, don't switch unless we have NO target
-                if (!bCurrentTargetCanAttack && !SquadTgtState->CanAttack && Det.TargetFrag->bHasValidTarget) continue;
-
-                FTransformFragment* SquadTgtTransform = EntityManager.GetFragmentDataPtr<FTransformFragment>(SquadTarget);
-                const FVector SquadTgtLocation = SquadTgtTransform ? SquadTgtTransform->GetTransform().GetLocation() : FVector::ZeroVector;
+                if (!bCurrentTargetCanAttack && !bSquadTgtCanAttack && Det.TargetFrag->bHasValidTarget) continue;
 
                 const float DistSq = FVector::DistSquared2D(Det.Location, SquadTgtLocation);
-                const FMassAgentCharacteristicsFragment* SquadTgtChar = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(SquadTarget);
-                const float TgtCapsule = SquadTgtChar ? SquadTgtChar->CapsuleRadius : 0.f;
                 const float EffectiveMinRangeSq = Det.Stats->MinRange > 0.f ? FMath::Square(Det.Stats->MinRange + DetCapsule + TgtCapsule) : 0.f;
                 if (DistSq < EffectiveMinRangeSq) continue;
 
@@ -371,45 +372,76 @@ void UDetectionProcessor::Execute(
                 BestEntity   = SquadTarget;
                 BestLocation = SquadTgtLocation;
                 bFoundNew    = true;
-                bCurrentTargetCanAttack = SquadTgtState->CanAttack; // Update for subsequent checks in this tick
+                bCurrentTargetCanAttack = bSquadTgtCanAttack; // Update for subsequent checks in this tick
                 break;
             }
         }
 
         if (!Det.TargetFrag->IsFocusedOnTarget)
         {
-            for (auto& Tgt : TargetUnits)
+            Candidates.Reset();
+            if (bUseGrid)
+            {
+                // Largest radius any check below uses: sight for new targets, lose-sight for the current one.
+                const float QueryRadius = FMath::Max(Det.Stats->SightRadius, Det.Stats->LoseSightRadius) + DetCapsule + Grid->GetMaxEntryRadius();
+                Grid->ForEachEntryInRadius2D(Det.Location, QueryRadius, [this, &Candidates](const FUnitSpatialGridEntry& Entry)
+                {
+                    const int32 Found = PresenceSubsystem->FindEntryIndex(Entry.Entity);
+                    if (Found != INDEX_NONE)
+                    {
+                        Candidates.Add(Found);
+                    }
+                });
+
+                // The current target may have been injected after the grid was built - keep it in the candidate set.
+                const int32 CurrentIdx = FindTargetIndex(Det.TargetFrag->TargetEntity);
+                if (CurrentIdx != INDEX_NONE)
+                {
+                    Candidates.AddUnique(CurrentIdx);
+                }
+            }
+            else
+            {
+                const int32 NumTargets = PresentUnits.Num() + InjectedTargets.Num();
+                for (int32 j = 0; j < NumTargets; ++j)
+                {
+                    Candidates.Add(j);
+                }
+            }
+
+            for (const int32 TgtIdx : Candidates)
             {
+                const FUnitPresenceEntry& Tgt = GetTarget(TgtIdx);
                 if (Tgt.Entity == Det.Entity) 
                     continue;
                 
                 // skip friendly
-                if (Tgt.Stats->TeamId == Det.Stats->TeamId)
+                if (Tgt.TeamId == Det.Stats->TeamId)
                     continue;
 
                 // skip allied
-                if (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << Tgt.Stats->TeamId)))
+                if (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << Tgt.TeamId)))
                 {
                     continue;
                 }
 
                 // skip too‐young / too‐old
-                const float TgtAge = Now - Tgt.State->BirthTime;
-                const float SinceDeath = Now - Tgt.State->DeathTime;
+                const float TgtAge = Now - Tgt.BirthTime;
+                const float SinceDeath = Now - Tgt.DeathTime;
                 if ((TgtAge < 1.f && TgtAge >= 0.f) || (SinceDeath > 4.f && SinceDeath >= 0.f))
                     continue;
 
                 const float DistSq = FVector::DistSquared2D(Det.Location, Tgt.Location);
 
                 // can I attack their type?
-                if ((Det.Char->bCanOnlyAttackGround && Tgt.Char->bIsFlying) ||
-                    (Det.Char->bCanOnlyAttackFlying && !Tgt.Char->bIsFlying) ||
-                    (Tgt.Char->bIsInvisible && !Det.Char->bCanDetectInvisible))
+                if ((Det.Char->bCanOnlyAttackGround && Tgt.bIsFlying) ||
+                    (Det.Char->bCanOnlyAttackFlying && !Tgt.bIsFlying) ||
+                    (Tgt.bIsInvisible && !Det.Char->bCanDetectInvisible))
                 {
                     continue;
                 }
 
-                const float TgtCapsule = Tgt.Char ? Tgt.Char->CapsuleRadius : 0.f;
+                const float TgtCapsule = Tgt.CapsuleRadius;
 
                 // Effective radii: add both capsule radii to base sight radii (2D)
                 const float EffectiveSight = Det.Stats->SightRadius + DetCapsule + TgtCapsule;
@@ -417,10 +449,10 @@ void UDetectionProcessor::Execute(
 
                 const float EffectiveMinRangeSq = Det.Stats->MinRange > 0.f ? FMath::Square(Det.Stats->MinRange + DetCapsule + TgtCapsule) : 0.f;
 
-                const bool bNewTargetCanAttack = Tgt.State->CanAttack;
+                const bool bNewTargetCanAttack = Tgt.bCanAttack;
 
                 // “new” target if within effective sight radius and closer than previous best, and alive
-                if (DistSq < EffectiveSightSq && DistSq >= EffectiveMinRangeSq && Tgt.Stats->Health > 0)
+                if (DistSq < EffectiveSightSq && DistSq >= EffectiveMinRangeSq && Tgt.Health > 0)
                 {
                     // NEU: Verhindere sofortiges Wiederfinden von vom Server verworfenen Zielen (Hysterese am Sichtrand)
                     if (World->GetNetMode() == NM_Client && !Det.TargetFrag->bHasValidTarget && Det.TargetFrag->TargetEntity == Tgt.Entity)
@@ -466,9 +498,9 @@ void UDetectionProcessor::Execute(
                 {
                     const float EffectiveLoseSight = Det.Stats->LoseSightRadius + DetCapsule + TgtCapsule;
                     const float EffectiveLoseSightSq = FMath::Square(EffectiveLoseSight);
-                    bool bIsAllied = (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << Tgt.Stats->TeamId)));
+                    bool bIsAllied = (Det.Alliance && (Det.Alliance->AlliedTeamsMask & (1LL << Tgt.TeamId)));
     
-                    if (Tgt.Entity == Det.TargetFrag->TargetEntity && DistSq < EffectiveLoseSightSq && DistSq >= EffectiveMinRangeSq && Tgt.Stats->Health > 0 && !bIsAllied)
+                    if (Tgt.Entity == Det.TargetFrag->TargetEntity && DistSq < EffectiveLoseSightSq && DistSq >= EffectiveMinRangeSq && Tgt.Health > 0 && !bIsAllied)
                     {
                         // NEU: Auf dem Client respektieren wir den Server-Verlust. 
                         // Wenn der Server das Ziel verworfen hat (bHasValidTarget == false), beleben wir es hier nicht lokal wieder.
@@ -485,10 +517,9 @@ void UDetectionProcessor::Execute(
                 // Fallback: use attacker sight counts if present AND within target’s effective lose-sight
                 if (!bFoundNew && !bCurrentStillViable)
                 {
-                    const int32* AttackingSightCount = Tgt.Sight->ConsistentAttackerTeamOverlapsPerTeam.Find(DetectorTeamId);
                     const float DetEffectiveLoseSight = Det.Stats->LoseSightRadius + DetCapsule + TgtCapsule;
                     const float DetEffectiveLoseSightSq = FMath::Square(DetEffectiveLoseSight);
-                    if (Tgt.Stats->Health > 0 && AttackingSightCount && *AttackingSightCount > 0 && DistSq < DetEffectiveLoseSightSq && DistSq >= EffectiveMinRangeSq)
+                    if (Tgt.Health > 0 && Tgt.IsAttackedByTeam(DetectorTeamId) && DistSq < DetEffectiveLoseSightSq && DistSq >= EffectiveMinRangeSq)
                     {
                         // Even for fallback, we should prioritize attack capability if we were to pick it
                         // But here we only reach if we haven't found anything else yet.
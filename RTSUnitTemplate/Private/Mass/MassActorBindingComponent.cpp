@@ -1879,8 +1879,8 @@ bool UMassActorBindingComponent::IsReadyForClientMassLink() const
 		return false;
 	}
 
-	// Wenn das Item in der Bubble-Liste ist, sind initiale Daten vorhanden
-	bool bInBubble = RegItem && Bubble->Agents.FindItemByNetID(RegItem->NetID) != nullptr;
+	// Wenn das Item in der Bubble-Liste ist, sind initiale Daten vorhanden (eigene oder geteilte Bubble)
+	bool bInBubble = RegItem && CacheSub->FindReplicatedItem(RegItem->NetID) != nullptr;
 	if (!bInBubble)
 	{
 		// NEU: Für EffectAreas ignorieren wir den Bubble-Check, 
@@ -6,6 +6,7 @@
 #include "MassCommonFragments.h"
 #include "MassActorSubsystem.h" // FMassActorFragment
 #include "Mass/UnitMassTag.h"
+#include "Mass/UnitPickingSubsystem.h"
 #include "Actors/EffectArea.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
 #include "Components/InstancedStaticMeshComponent.h"
@@ -40,6 +41,9 @@ void UMassEffectAreaHoverProcessor::Execute(FMassEntityManager& EntityManager, F
 	UWorld* World = EntityManager.GetWorld();
 	if (!World) return;
 
+	UUnitPickingSubsystem* PickingSubsystem = World->GetSubsystem<UUnitPickingSubsystem>();
+	if (!PickingSubsystem) return;
+
 
 	ACustomControllerBase* LocalPC = Cast<ACustomControllerBase>(World->GetFirstPlayerController());
 	if (!LocalPC || !LocalPC->IsLocalController()) return;
@@ -51,49 +55,43 @@ void UMassEffectAreaHoverProcessor::Execute(FMassEntityManager& EntityManager, F
 	FMassEntityHandle BestEntity;
 	float ClosestDistanceSq = FLT_MAX;
 
-	EntityQuery.ForEachEntityChunk(Context, ([&](FMassExecutionContext& ChunkContext)
-	{
-		const auto Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
-		const auto CharFrags = ChunkContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
-		const auto ActorFrags = ChunkContext.GetFragmentView<FMassActorFragment>();
-		const auto ImpactFrags = ChunkContext.GetFragmentView<FEffectAreaImpactFragment>();
+	// Picking entries of effect areas already carry the actor location and the impact radius.
+	PickingSubsystem->QueryRay(RayOrigin, RayDirection, 100000.f, CandidateEntries);
+	const TArray<FUnitPickEntry>& PickEntries = PickingSubsystem->GetEntries();
 
-		for (int32 i = 0; i < ChunkContext.GetNumEntities(); ++i)
+	for (const int32 EntryIndex : CandidateEntries)
+	{
+		const FUnitPickEntry& PickEntry = PickEntries[EntryIndex];
+		if (PickEntry.Kind != EUnitPickKind::EffectArea)
 		{
-			const FTransform& EntityTransform = Transforms[i].GetTransform();
-			const FMassAgentCharacteristicsFragment& CharFrag = CharFrags[i];
-			const FEffectAreaImpactFragment& ImpactFrag = ImpactFrags[i];
-
-			FVector BaseLocation = EntityTransform.GetLocation();
-			const AActor* Actor = ActorFrags[i].Get();
+			continue;
+		}
 
-			// Always prefer Actor location for debugging if available, as it's the "truth" for projectiles etc.
-			if (Actor)
-			{
-				BaseLocation = Actor->GetActorLocation();
-			}
+		const FVector BaseLocation = PickEntry.Base + FVector(0.f, 0.f, PickEntry.Height * 0.5f);
+		const float Radius = PickEntry.Radius;
 
-			// Prefer CurrentRadius from ImpactFragment, fallback to CapsuleRadius or default 100
-			float Radius = ImpactFrag.CurrentRadius > 0.f ? ImpactFrag.CurrentRadius : (CharFrag.CapsuleRadius > 0.f ? CharFrag.CapsuleRadius : 100.f);
-			
-			FVector OutP1, OutP2;
-			// Use a very long vertical segment to detect the area even if Z is wrong (2D Hover)
-			FMath::SegmentDistToSegmentSafe(RayOrigin, RayEnd, BaseLocation - FVector(0,0,100000.f), BaseLocation + FVector(0,0,100000.f), OutP1, OutP2);
-			float DistSq = FVector::DistSquared2D(OutP1, OutP2);
+		FVector OutP1, OutP2;
+		// Use a very long vertical segment to detect the area even if Z is wrong (2D Hover)
+		FMath::SegmentDistToSegmentSafe(RayOrigin, RayEnd, BaseLocation - FVector(0,0,100000.f), BaseLocation + FVector(0,0,100000.f), OutP1, OutP2);
+		float DistSq = FVector::DistSquared2D(OutP1, OutP2);
 
-			if (DistSq <= FMath::Square(Radius))
+		// Same population as EntityQuery; the logging below reads these fragments.
+		if (DistSq <= FMath::Square(Radius)
+			&& EntityManager.IsEntityValid(PickEntry.Entity)
+			&& EntityManager.GetFragmentDataPtr<FMassVisibilityFragment>(PickEntry.Entity)
+			&& EntityManager.GetFragmentDataPtr<FEffectAreaVisualFragment>(PickEntry.Entity)
+			&& EntityManager.GetFragmentDataPtr<FMassActorFragment>(PickEntry.Entity))
+		{
+			float DistToCamSq = FVector::DistSquared(RayOrigin, BaseLocation);
+			if (DistToCamSq < ClosestDistanceSq)
 			{
-				float DistToCamSq = FVector::DistSquared(RayOrigin, BaseLocation);
-				if (DistToCamSq < ClosestDistanceSq)
-				{
-					ClosestDistanceSq = DistToCamSq;
-					BestEntity = ChunkContext.GetEntity(i);
-				}
+				ClosestDistanceSq = DistToCamSq;
+				BestEntity = PickEntry.Entity;
 			}
 		}
-	}));
+	}
 
-	if (BestEntity.IsValid())
+	if (EntityManager.IsEntityValid(BestEntity))
 	{
 		FMassHoverFragment* HoverFrag = EntityManager.GetFragmentDataPtr<FMassHoverFragment>(BestEntity);
 		if (HoverFrag)
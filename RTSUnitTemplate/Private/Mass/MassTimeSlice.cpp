@@ -0,0 +1,42 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/MassTimeSlice.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_TimeSliceBuckets(
+	TEXT("RTS.TimeSlice.Buckets"),
+	4,
+	TEXT("Number of phase buckets interval-gated state and detection processors spread their entities over. 1 = whole population in one frame every interval."),
+	ECVF_Default);
+
+int32 FMassTimeSlice::GetConfiguredBuckets()
+{
+	return FMath::Clamp(CVarRTS_TimeSliceBuckets.GetValueOnGameThread(), 1, 64);
+}
+
+bool FMassTimeSlice::Advance(float DeltaSeconds, float Interval)
+{
+	const int32 Buckets = GetConfiguredBuckets();
+	if (Buckets != NumBuckets)
+	{
+		NumBuckets = Buckets;
+		Phase = 0.f;
+	}
+
+	if (Interval <= 0.f)
+	{
+		DueBegin = 0;
+		DueCount = NumBuckets;
+		return true;
+	}
+
+	// Bucket b is due whenever the phase crosses b. A frame longer than the interval crosses all of them.
+	const float PrevPhase = Phase;
+	Phase += DeltaSeconds / Interval * NumBuckets;
+	const int32 Crossed = FMath::FloorToInt(Phase) - FMath::FloorToInt(PrevPhase);
+
+	DueBegin = (FMath::FloorToInt(PrevPhase) + 1) % NumBuckets;
+	DueCount = FMath::Min(Crossed, NumBuckets);
+
+	Phase = FMath::Fmod(Phase, float(NumBuckets));
+	return DueCount > 0;
+}
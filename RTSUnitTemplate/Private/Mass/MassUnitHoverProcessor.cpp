@@ -9,6 +9,7 @@
 #include "MassActorSubsystem.h"
 #include "MassSignalSubsystem.h"
 #include "Mass/MassUnitVisualFragments.h"
+#include "Mass/UnitPickingSubsystem.h"
 #include "Mass/UnitMassTag.h"
 #include "Mass/Signals/MySignals.h"
 #include "Engine/World.h"
@@ -47,6 +48,7 @@ void UMassUnitHoverProcessor::InitializeInternal(UObject& Owner, const TSharedRe
 	if (UWorld* World = Owner.GetWorld())
 	{
 		SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
+		PickingSubsystem = World->GetSubsystem<UUnitPickingSubsystem>();
 	}
 
 	if (SignalSubsystem)
@@ -84,7 +86,7 @@ void UMassUnitHoverProcessor::BeginDestroy()
 void UMassUnitHoverProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	UWorld* World = EntityManager.GetWorld();
-	if (!World || !SignalSubsystem) return;
+	if (!World || !SignalSubsystem || !PickingSubsystem) return;
 
 	AccumulatedTime += Context.GetDeltaTimeSeconds();
 	if (AccumulatedTime < 0.1f) // 10 FPS
@@ -106,85 +108,86 @@ void UMassUnitHoverProcessor::Execute(FMassEntityManager& EntityManager, FMassEx
 	TWeakObjectPtr<UInstancedStaticMeshComponent> BestISM = nullptr;
 	TWeakObjectPtr<USkeletalMeshComponent> BestMesh = nullptr;
 
-	EntityQuery.ForEachEntityChunk(Context, ([&](FMassExecutionContext& ChunkContext)
+	// Only the entities whose pick volume the ray passes near get the exact test.
+	PickingSubsystem->QueryRay(RayOrigin, RayDirection, 100000.f, CandidateEntries);
+	const TArray<FUnitPickEntry>& PickEntries = PickingSubsystem->GetEntries();
+
+	for (const int32 EntryIndex : CandidateEntries)
 	{
-		const auto Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
-		const auto VisualFrags = ChunkContext.GetFragmentView<FMassUnitVisualFragment>();
-		const auto ActorFrags = ChunkContext.GetFragmentView<FMassActorFragment>();
-		const auto CharFrags = ChunkContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
+		const FUnitPickEntry& PickEntry = PickEntries[EntryIndex];
+		if (PickEntry.Kind != EUnitPickKind::Unit || !EntityManager.IsEntityValid(PickEntry.Entity))
+		{
+			continue;
+		}
 
-		for (int32 i = 0; i < ChunkContext.GetNumEntities(); ++i)
+		const FMassEntityHandle Entity = PickEntry.Entity;
+		const FTransformFragment* TransformFrag = EntityManager.GetFragmentDataPtr<FTransformFragment>(Entity);
+		const FMassAgentCharacteristicsFragment* CharFragPtr = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(Entity);
+		const FMassUnitVisualFragment* VisualFragPtr = EntityManager.GetFragmentDataPtr<FMassUnitVisualFragment>(Entity);
+		const FMassActorFragment* ActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entity);
+		if (!TransformFrag || !CharFragPtr || !VisualFragPtr || !ActorFragPtr)
 		{
-			const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-			bool bHit = false;
-			int32 CurrentInstanceIndex = INDEX_NONE;
-			TWeakObjectPtr<UInstancedStaticMeshComponent> CurrentISM = nullptr;
-			TWeakObjectPtr<USkeletalMeshComponent> CurrentMesh = nullptr;
+			continue;
+		}
 
-			const FTransform& EntityTransform = Transforms[i].GetTransform();
-			const FMassAgentCharacteristicsFragment& CharFrag = CharFrags[i];
+		int32 CurrentInstanceIndex = INDEX_NONE;
+		TWeakObjectPtr<UInstancedStaticMeshComponent> CurrentISM = nullptr;
+		TWeakObjectPtr<USkeletalMeshComponent> CurrentMesh = nullptr;
 
-			FVector BaseLocation = EntityTransform.GetLocation();
-			const float HalfHeight = CharFrag.bUseBoxComponent ? CharFrag.BoxExtent.Z : CharFrag.CapsuleHeight;
-			const float Height = HalfHeight * 2.0f;
+		const FTransform& EntityTransform = TransformFrag->GetTransform();
+		const FMassAgentCharacteristicsFragment& CharFrag = *CharFragPtr;
 
-			BaseLocation.Z = CharFrag.LastGroundLocation;
-			if (CharFrag.bIsFlying)
-			{
-				BaseLocation.Z += (CharFrag.FlyHeight - HalfHeight);
-			}
+		// Pick volume base and height as gathered by UUnitPickingProcessor this frame.
+		const FVector BaseLocation = PickEntry.Base;
+		const float Height = PickEntry.Height;
 
-			FVector OutP1, OutP2;
-			FMath::SegmentDistToSegmentSafe(RayOrigin, RayEnd, BaseLocation, BaseLocation + FVector(0,0,Height), OutP1, OutP2);
-			float DistSq = FVector::DistSquared(OutP1, OutP2);
+		FVector OutP1, OutP2;
+		FMath::SegmentDistToSegmentSafe(RayOrigin, RayEnd, BaseLocation, BaseLocation + FVector(0,0,Height), OutP1, OutP2);
+		float DistSq = FVector::DistSquared(OutP1, OutP2);
 
-			FVector DirToMouse = OutP1 - OutP2;
-			DirToMouse.Z = 0.f;
-			float Radius = CharFrag.GetRadiusInDirection(DirToMouse.GetSafeNormal2D(), EntityTransform.GetRotation().Rotator());
+		FVector DirToMouse = OutP1 - OutP2;
+		DirToMouse.Z = 0.f;
+		float Radius = CharFrag.GetRadiusInDirection(DirToMouse.GetSafeNormal2D(), EntityTransform.GetRotation().Rotator());
 
-			if (DistSq <= FMath::Square(Radius))
-			{
-				bHit = true;
+		if (DistSq > FMath::Square(Radius))
+		{
+			continue;
+		}
 
-				const FMassUnitVisualFragment& VisualFrag = VisualFrags[i];
-				if (VisualFrag.VisualInstances.Num() > 0)
-				{
-					CurrentInstanceIndex = VisualFrag.VisualInstances[0].InstanceIndex;
-					CurrentISM = VisualFrag.VisualInstances[0].TargetISM.Get();
-				}
+		const FMassUnitVisualFragment& VisualFrag = *VisualFragPtr;
+		if (VisualFrag.VisualInstances.Num() > 0)
+		{
+			CurrentInstanceIndex = VisualFrag.VisualInstances[0].InstanceIndex;
+			CurrentISM = VisualFrag.VisualInstances[0].TargetISM.Get();
+		}
 
-				if (const AActor* Actor = ActorFrags[i].Get())
+		if (const AActor* Actor = ActorFragPtr->Get())
+		{
+			if (CurrentInstanceIndex == INDEX_NONE)
+			{
+				if (const AMassUnitBase* Unit = Cast<AMassUnitBase>(Actor))
 				{
-					if (CurrentInstanceIndex == INDEX_NONE)
-					{
-						if (const AMassUnitBase* Unit = Cast<AMassUnitBase>(Actor))
-						{
-							CurrentInstanceIndex = Unit->InstanceIndex;
-							CurrentISM = Unit->ISMComponent;
-						}
-					}
-					
-					if (const ACharacter* Char = Cast<ACharacter>(Actor))
-					{
-						CurrentMesh = Char->GetMesh();
-					}
+					CurrentInstanceIndex = Unit->InstanceIndex;
+					CurrentISM = Unit->ISMComponent;
 				}
 			}
-
-			if (bHit)
+			
+			if (const ACharacter* Char = Cast<ACharacter>(Actor))
 			{
-				float DistToCamSq = FVector::DistSquared(RayOrigin, EntityTransform.GetLocation());
-				if (DistToCamSq < ClosestDistanceSq)
-				{
-					ClosestDistanceSq = DistToCamSq;
-					BestEntity = Entity;
-					BestInstanceIndex = CurrentInstanceIndex;
-					BestISM = CurrentISM;
-					BestMesh = CurrentMesh;
-				}
+				CurrentMesh = Char->GetMesh();
 			}
 		}
-	}));
+
+		float DistToCamSq = FVector::DistSquared(RayOrigin, EntityTransform.GetLocation());
+		if (DistToCamSq < ClosestDistanceSq)
+		{
+			ClosestDistanceSq = DistToCamSq;
+			BestEntity = Entity;
+			BestInstanceIndex = CurrentInstanceIndex;
+			BestISM = CurrentISM;
+			BestMesh = CurrentMesh;
+		}
+	}
 
 	// Detect if we changed entity OR instance index/mesh for the same entity
 	bool bInstanceChanged = false;
@@ -3,6 +3,7 @@
 #include "MassCommonFragments.h"
 #include "MassExecutionContext.h"
 #include "Mass/MassUnitVisualFragments.h"
+#include "Mass/MassVisualEffectCustomData.h"
 #include "Mass/UnitMassTag.h"
 #include "MassActorSubsystem.h"
 #include "Characters/Unit/ConstructionUnit.h"
@@ -42,7 +43,10 @@ void UMassUnitVisualTweenProcessor::Execute(FMassEntityManager& EntityManager, F
         LoggedThisFrame = 0;
     }
 
-    EntityQuery.ForEachEntityChunk(Context, ([this, &EntityManager, DeltaTime, bShouldLog](FMassExecutionContext& Context) {
+    const bool bGpuPeriodic = VisualEffectCustomData::IsGpuPeriodicEnabled();
+    const float WorldTime = Context.GetWorld()->GetTimeSeconds();
+
+    EntityQuery.ForEachEntityChunk(Context, ([this, &EntityManager, DeltaTime, bShouldLog, bGpuPeriodic, WorldTime](FMassExecutionContext& Context) {
         TConstArrayView<FTransformFragment> TransformList = Context.GetFragmentView<FTransformFragment>();
         TConstArrayView<FMassActorFragment> ActorList = Context.GetFragmentView<FMassActorFragment>();
         TArrayView<FMassUnitVisualFragment> VisualList = Context.GetMutableFragmentView<FMassUnitVisualFragment>();
@@ -364,6 +368,10 @@ void UMassUnitVisualTweenProcessor::Execute(FMassEntityManager& EntityManager, F
                 Effect.DroneTimer += DroneDeltaTime;
             }
 
+            // Periodic effects the material evaluates from custom data; they stay out of the transform below.
+            const uint8 GpuEffects = (bGpuPeriodic && VisualEffectCustomData::CanUseCustomData(Visual))
+                ? VisualEffectCustomData::GetActiveEffects(Effect) : 0;
+
             // 3. Apply everything to instances
             for (int32 InstanceIdx = 0; InstanceIdx < Visual.VisualInstances.Num(); ++InstanceIdx) {
                 FMassUnitVisualInstance& Instance = Visual.VisualInstances[InstanceIdx];
@@ -398,7 +406,7 @@ void UMassUnitVisualTweenProcessor::Execute(FMassEntityManager& EntityManager, F
 
                 // --- Apply Effects ---
                 // Pulsate (Pulsate values are usually absolute scales)
-                if (Effect.bPulsateEnabled) {
+                if (Effect.bPulsateEnabled && !(GpuEffects & VisualEffectCustomData::Pulsate)) {
                     bool bShouldApply = (!Effect.PulsateTargetISM.IsValid() || Effect.PulsateTargetISM == InstanceTemplate);
                     if (bShouldApply) {
                          NewTransform.SetScale3D(CurrentPulsateScale);
@@ -406,7 +414,7 @@ void UMassUnitVisualTweenProcessor::Execute(FMassEntityManager& EntityManager, F
                 }
 
                 // Continuous Rotation (Combine with base rotation)
-                if (Effect.bRotationEnabled) {
+                if (Effect.bRotationEnabled && !(GpuEffects & VisualEffectCustomData::Rotation)) {
                     bool bShouldApply = (!Effect.RotationTargetISM.IsValid() || Effect.RotationTargetISM == InstanceTemplate);
                     if (bShouldApply) {
                         NewTransform.SetRotation(TotalRotation * NewTransform.GetRotation());
@@ -414,7 +422,7 @@ void UMassUnitVisualTweenProcessor::Execute(FMassEntityManager& EntityManager, F
                 }
 
                 // Oscillation (Additively to location)
-                if (Effect.bOscillationEnabled) {
+                if (Effect.bOscillationEnabled && !(GpuEffects & VisualEffectCustomData::Oscillation)) {
                     bool bShouldApply = (!Effect.OscillationTargetISM.IsValid() || Effect.OscillationTargetISM == InstanceTemplate);
                     if (bShouldApply) {
                         NewTransform.AddToTranslation(CurrentOscOffset);
@@ -508,10 +516,18 @@ void UMassUnitVisualTweenProcessor::Execute(FMassEntityManager& EntityManager, F
                 Instance.CurrentRelativeTransform = NewTransform;
             }
 
-            // Set dirty flag when any tween or effect is active so PlacementProcessor updates the ISM
+            // Custom data is only written when the GPU effect set or its parameters change.
+            bool bGpuEffectsChanged = false;
+            if (GpuEffects != 0 || Effect.GpuWrittenEffects != 0) {
+                bGpuEffectsChanged = VisualEffectCustomData::SyncInstances(Visual, Effect, GpuEffects, WorldTime);
+            }
+
+            // Set dirty flag when any tween or effect is active so PlacementProcessor updates the ISM.
+            // Effects running on the GPU only need the one write when they start or stop.
+            const uint8 CpuEffects = VisualEffectCustomData::GetActiveEffects(Effect) & ~GpuEffects;
             const bool bHasActiveTweenOrEffect =
                 Tween.RotationTween.bActive || Tween.LocationTween.bActive || Tween.ScaleTween.bActive ||
-                Effect.bPulsateEnabled || Effect.bRotationEnabled || Effect.bOscillationEnabled ||
+                CpuEffects != 0 || bGpuEffectsChanged ||
                 Effect.bDishRotationEnabled || (Effect.bYawChaseEnabled && bHasYawChaseTarget) || Effect.bDroneEnabled;
 
             if (bHasActiveTweenOrEffect)
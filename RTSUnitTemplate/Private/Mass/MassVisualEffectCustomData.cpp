@@ -0,0 +1,209 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/MassVisualEffectCustomData.h"
+#include "Mass/MassUnitVisualFragments.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "HAL/IConsoleManager.h"
+
+// Read when unit ISMs are created (custom data size) and every frame by the tween processor.
+// Enable it together with a unit material that evaluates the effect block in World Position Offset.
+static TAutoConsoleVariable<int32> CVarRTS_VisualEffectsGpuPeriodic(
+	TEXT("RTS.VisualEffects.GpuPeriodic"),
+	0,
+	TEXT("1 = pulsate, continuous rotation and oscillation of ISM units are evaluated by the material from per-instance custom data.\n")
+	TEXT("0 = the tween processor applies them to the instance transform every frame."),
+	ECVF_Default);
+
+namespace VisualEffectCustomData
+{
+	namespace
+	{
+		// Number of custom-data floats the ISM animation uses (indices 1..12).
+		constexpr int32 AnimationCustomDataFloats = 13;
+
+		bool AppliesTo(const TWeakObjectPtr<UInstancedStaticMeshComponent>& EffectTarget, const FMassUnitVisualInstance& Instance)
+		{
+			// Same rule as UMassUnitVisualTweenProcessor: no target means every instance.
+			return !EffectTarget.IsValid() || EffectTarget == Instance.TemplateISM;
+		}
+
+		uint8 GetInstanceEffects(const FMassVisualEffectFragment& Effect, const FMassUnitVisualInstance& Instance, const uint8 GpuEffects)
+		{
+			uint8 Effects = 0;
+			if ((GpuEffects & Pulsate) && AppliesTo(Effect.PulsateTargetISM, Instance)) Effects |= Pulsate;
+			if ((GpuEffects & Rotation) && AppliesTo(Effect.RotationTargetISM, Instance)) Effects |= Rotation;
+			if ((GpuEffects & Oscillation) && AppliesTo(Effect.OscillationTargetISM, Instance)) Effects |= Oscillation;
+			return Effects;
+		}
+
+		uint32 HashParams(const FMassUnitVisualFragment& Visual, const FMassVisualEffectFragment& Effect, const uint8 GpuEffects)
+		{
+			uint32 Hash = GetTypeHash(GpuEffects);
+			if (GpuEffects & Pulsate)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.PulsateMinScale));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.PulsateMaxScale));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.PulsateHalfPeriod));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.PulsateTargetISM));
+			}
+			if (GpuEffects & Rotation)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.RotationAxis));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.RotationDegreesPerSecond));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.RotationTargetISM));
+			}
+			if (GpuEffects & Oscillation)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.OscillationOffsetA));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.OscillationOffsetB));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.OscillationCyclesPerSecond));
+				Hash = HashCombineFast(Hash, GetTypeHash(Effect.OscillationTargetISM));
+			}
+			// The block is written per instance slot and in the instance's local space.
+			for (const FMassUnitVisualInstance& Instance : Visual.VisualInstances)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Instance.TargetISM));
+				Hash = HashCombineFast(Hash, GetTypeHash(Instance.InstanceIndex));
+				if (GetInstanceEffects(Effect, Instance, GpuEffects) != 0)
+				{
+					const FQuat Rotation = Instance.CurrentRelativeTransform.GetRotation();
+					Hash = HashCombineFast(Hash, GetTypeHash(FVector4(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W)));
+					Hash = HashCombineFast(Hash, GetTypeHash(Instance.CurrentRelativeTransform.GetScale3D()));
+				}
+			}
+			return Hash;
+		}
+
+		void SetVector(UInstancedStaticMeshComponent& ISM, const int32 InstanceIndex, const int32 FirstIndex, const FVector& Value)
+		{
+			ISM.SetCustomDataValue(InstanceIndex, FirstIndex + 0, Value.X, false);
+			ISM.SetCustomDataValue(InstanceIndex, FirstIndex + 1, Value.Y, false);
+			ISM.SetCustomDataValue(InstanceIndex, FirstIndex + 2, Value.Z, false);
+		}
+
+		FVector SafeDivide(const FVector& A, const FVector& B)
+		{
+			return FVector(
+				FMath::IsNearlyZero(B.X) ? 1.f : A.X / B.X,
+				FMath::IsNearlyZero(B.Y) ? 1.f : A.Y / B.Y,
+				FMath::IsNearlyZero(B.Z) ? 1.f : A.Z / B.Z);
+		}
+
+		void WriteInstance(const FMassVisualEffectFragment& Effect, const FMassUnitVisualInstance& Instance, const uint8 Effects, const float WorldTime)
+		{
+			UInstancedStaticMeshComponent* ISM = Instance.TargetISM.Get();
+			if (!ISM || Instance.InstanceIndex == INDEX_NONE || ISM->NumCustomDataFloats < NumFloats)
+			{
+				return;
+			}
+
+			const int32 Index = Instance.InstanceIndex;
+			const FTransform& Static = Instance.CurrentRelativeTransform;
+
+			if (Effects & Pulsate)
+			{
+				// The CPU path replaces the scale; on the GPU it is a factor on the instance's own scale.
+				ISM->SetCustomDataValue(Index, PulsateStartTime, WorldTime - Effect.PulsateElapsed, false);
+				ISM->SetCustomDataValue(Index, PulsateHalfPeriod, FMath::Max(Effect.PulsateHalfPeriod, KINDA_SMALL_NUMBER), false);
+				SetVector(*ISM, Index, PulsateMinFactor, SafeDivide(Effect.PulsateMinScale, Static.GetScale3D()));
+				SetVector(*ISM, Index, PulsateMaxFactor, SafeDivide(Effect.PulsateMaxScale, Static.GetScale3D()));
+			}
+			else
+			{
+				ISM->SetCustomDataValue(Index, PulsateStartTime, 0.f, false);
+				ISM->SetCustomDataValue(Index, PulsateHalfPeriod, 0.f, false);
+				SetVector(*ISM, Index, PulsateMinFactor, FVector::ZeroVector);
+				SetVector(*ISM, Index, PulsateMaxFactor, FVector::ZeroVector);
+			}
+
+			if (Effects & Rotation)
+			{
+				// Rotating about the actor-local axis before the instance rotation equals rotating about the
+				// un-rotated axis in the instance's local space.
+				ISM->SetCustomDataValue(Index, RotationStartTime, WorldTime - Effect.RotationElapsed, false);
+				ISM->SetCustomDataValue(Index, RotationDegreesPerSecond, Effect.RotationDegreesPerSecond, false);
+				SetVector(*ISM, Index, RotationAxis, Static.GetRotation().UnrotateVector(Effect.RotationAxis).GetSafeNormal());
+				// The CPU path rotates after scaling; the material scales by this, rotates and scales back.
+				// Zero components would divide by zero in the material; they collapse the mesh anyway.
+				const FVector Scale = Static.GetScale3D();
+				SetVector(*ISM, Index, RotationScale, FVector(
+					FMath::IsNearlyZero(Scale.X) ? 1.f : Scale.X,
+					FMath::IsNearlyZero(Scale.Y) ? 1.f : Scale.Y,
+					FMath::IsNearlyZero(Scale.Z) ? 1.f : Scale.Z));
+			}
+			else
+			{
+				ISM->SetCustomDataValue(Index, RotationStartTime, 0.f, false);
+				ISM->SetCustomDataValue(Index, RotationDegreesPerSecond, 0.f, false);
+				SetVector(*ISM, Index, RotationAxis, FVector::ZeroVector);
+				SetVector(*ISM, Index, RotationScale, FVector::ZeroVector);
+			}
+
+			if (Effects & Oscillation)
+			{
+				ISM->SetCustomDataValue(Index, OscillationStartTime, WorldTime - Effect.OscillationElapsed, false);
+				ISM->SetCustomDataValue(Index, OscillationCyclesPerSecond, Effect.OscillationCyclesPerSecond, false);
+				SetVector(*ISM, Index, OscillationOffsetA, Static.InverseTransformVector(Effect.OscillationOffsetA));
+				SetVector(*ISM, Index, OscillationOffsetB, Static.InverseTransformVector(Effect.OscillationOffsetB));
+			}
+			else
+			{
+				ISM->SetCustomDataValue(Index, OscillationStartTime, 0.f, false);
+				ISM->SetCustomDataValue(Index, OscillationCyclesPerSecond, 0.f, false);
+				SetVector(*ISM, Index, OscillationOffsetA, FVector::ZeroVector);
+				SetVector(*ISM, Index, OscillationOffsetB, FVector::ZeroVector);
+			}
+
+			ISM->MarkRenderStateDirty();
+		}
+	}
+
+	bool IsGpuPeriodicEnabled()
+	{
+		return CVarRTS_VisualEffectsGpuPeriodic.GetValueOnGameThread() != 0;
+	}
+
+	int32 GetRequiredCustomDataFloats()
+	{
+		return IsGpuPeriodicEnabled() ? NumFloats : AnimationCustomDataFloats;
+	}
+
+	bool CanUseCustomData(const FMassUnitVisualFragment& Visual)
+	{
+		for (const FMassUnitVisualInstance& Instance : Visual.VisualInstances)
+		{
+			const UInstancedStaticMeshComponent* ISM = Instance.TargetISM.Get();
+			if (ISM && ISM->NumCustomDataFloats < NumFloats)
+			{
+				return false;
+			}
+		}
+		return Visual.VisualInstances.Num() > 0;
+	}
+
+	uint8 GetActiveEffects(const FMassVisualEffectFragment& Effect)
+	{
+		uint8 Effects = 0;
+		if (Effect.bPulsateEnabled) Effects |= Pulsate;
+		if (Effect.bRotationEnabled) Effects |= Rotation;
+		if (Effect.bOscillationEnabled) Effects |= Oscillation;
+		return Effects;
+	}
+
+	bool SyncInstances(const FMassUnitVisualFragment& Visual, FMassVisualEffectFragment& Effect, const uint8 GpuEffects, const float WorldTime)
+	{
+		const uint32 Hash = GpuEffects != 0 ? HashParams(Visual, Effect, GpuEffects) : 0;
+		if (GpuEffects == Effect.GpuWrittenEffects && Hash == Effect.GpuWrittenParamsHash)
+		{
+			return false;
+		}
+
+		for (const FMassUnitVisualInstance& Instance : Visual.VisualInstances)
+		{
+			WriteInstance(Effect, Instance, GetInstanceEffects(Effect, Instance, GpuEffects), WorldTime);
+		}
+
+		Effect.GpuWrittenEffects = GpuEffects;
+		Effect.GpuWrittenParamsHash = Hash;
+		return true;
+	}
+}
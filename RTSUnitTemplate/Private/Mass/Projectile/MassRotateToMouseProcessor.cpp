@@ -107,6 +107,8 @@ void UMassRotateToMouseProcessor::Execute(FMassEntityManager& EntityManager, FMa
 
 	if (bIsServerTick && bHasAuthority) LastServerTickTime = CurrentTime;
 
+	URTSWorldCacheSubsystem* CacheSub = bHasAuthority ? nullptr : World->GetSubsystem<URTSWorldCacheSubsystem>();
+
 	EntityQuery.ForEachEntityChunk(Context, ([&](FMassExecutionContext& ChunkContext)
 	{
 		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
@@ -139,22 +141,12 @@ void UMassRotateToMouseProcessor::Execute(FMassEntityManager& EntityManager, FMa
 				}
 			}
 			// 3. Remote Client: Use shared mouse data from BubbleInfo
-			else if (!bHasAuthority && RotatorId != -1 && RotatorId != LocalPlayerId)
+			else if (CacheSub && RotatorId != -1 && RotatorId != LocalPlayerId)
 			{
-				if (URTSWorldCacheSubsystem* CacheSub = World->GetSubsystem<URTSWorldCacheSubsystem>())
+				if (const FPlayerMouseData* Data = CacheSub->FindPlayerMouseData(RotatorId))
 				{
-					if (AUnitClientBubbleInfo* Bubble = CacheSub->GetBubble(false))
-					{
-						for (const FPlayerMouseData& Data : Bubble->PlayerMouseDatas)
-						{
-							if (Data.PlayerId == RotatorId)
-							{
-								TargetLocation = Data.MouseLocation;
-								bFoundTarget = true;
-								break;
-							}
-						}
-					}
+					TargetLocation = Data->MouseLocation;
+					bFoundTarget = true;
 				}
 			}
 
@@ -277,157 +277,155 @@ void UClientReplicationProcessor::Execute(FMassEntityManager& EntityManager, FMa
 
 			if (URTSWorldCacheSubsystem* CacheSub = World->GetSubsystem<URTSWorldCacheSubsystem>())
 			{
-				if (AUnitClientBubbleInfo* Bubble = CacheSub->GetBubble(false))
+				AUnitClientBubbleInfo* Bubble = nullptr;
+				if (const FUnitReplicationItem* UseItem = CacheSub->FindReplicatedItem(NetIDList[EntityIdx].NetID, &Bubble))
 				{
-					if (const FUnitReplicationItem* UseItem = Bubble->Agents.FindItemByNetID(NetIDList[EntityIdx].NetID))
-					{
-						const uint16 YQ = (uint16)(UseItem->PackedBits & 0xFFFF);
-						const uint16 PE = (uint16)(UseItem->PackedBits >> 16);
-						const float LYaw = (static_cast<float>(YQ) / 65535.0f) * 360.0f;
+					const uint16 YQ = (uint16)(UseItem->PackedBits & 0xFFFF);
+					const uint16 PE = (uint16)(UseItem->PackedBits >> 16);
+					const float LYaw = (static_cast<float>(YQ) / 65535.0f) * 360.0f;
 
-						FVector LocalScale = CharList.IsValidIndex(EntityIdx) ? CharList[EntityIdx].Scale : FVector::OneVector;
-						FinalXf = FTransform(FQuat(FRotator(0.f, LYaw, 0.f)), FVector(UseItem->Location), LocalScale);
-						bFromBubble = true;
+					FVector LocalScale = CharList.IsValidIndex(EntityIdx) ? CharList[EntityIdx].Scale : FVector::OneVector;
+					FinalXf = FTransform(FQuat(FRotator(0.f, LYaw, 0.f)), FVector(UseItem->Location), LocalScale);
+					bFromBubble = true;
 
-						// Apply TagBits
-						ApplyReplicatedTagBits(EntityManager, ChunkCtx.GetEntity(EntityIdx), UseItem->TagBits);
+					// Apply TagBits
+					ApplyReplicatedTagBits(EntityManager, ChunkCtx.GetEntity(EntityIdx), UseItem->TagBits);
 
-						// AI Target Slot 1
-						if (AITargetList.IsValidIndex(EntityIdx))
+					// AI Target Slot 1
+					if (AITargetList.IsValidIndex(EntityIdx))
+					{
+						FMassAITargetFragment& AIT = AITargetList[EntityIdx];
+						
+						// Synchronize Target Entity if server has one
+						// Note: We avoid resetting to zero here to prevent "flapping" with client-side detection.
+						const FMassEntityHandle* FoundTarget = (UseItem->TargetID != 0) ? GlobalNetToEntity.Find(UseItem->TargetID) : nullptr;
+						if (FoundTarget && EntityManager.IsEntityActive(*FoundTarget))
 						{
-							FMassAITargetFragment& AIT = AITargetList[EntityIdx];
-							
-							// Synchronize Target Entity if server has one
-							// Note: We avoid resetting to zero here to prevent "flapping" with client-side detection.
-							const FMassEntityHandle* FoundTarget = (UseItem->TargetID != 0) ? GlobalNetToEntity.Find(UseItem->TargetID) : nullptr;
-							if (FoundTarget && EntityManager.IsEntityActive(*FoundTarget))
+							if (!AIT.TargetEntity.IsSet() || AIT.TargetEntity != *FoundTarget)
 							{
-								if (!AIT.TargetEntity.IsSet() || AIT.TargetEntity != *FoundTarget)
-								{
-									AIT.TargetEntity = *FoundTarget;
-									AIT.bHasValidTarget = true;
-
-									// Sofort-Initialisierung der Location aus dem Entity-Transform
-									if (const FTransformFragment* TgtXf = EntityManager.GetFragmentDataPtr<FTransformFragment>(*FoundTarget))
-									{
-										AIT.LastKnownLocation = TgtXf->GetTransform().GetLocation();
-									}
-								}
-							}
-							else
-							{
-								// AIT.TargetEntity.Reset(); // Keep as memory for DetectionProcessor hysteresis
-							}
+								AIT.TargetEntity = *FoundTarget;
+								AIT.bHasValidTarget = true;
 
-							// Synchronize LastKnownLocation if provided and not a movement target
-							if (!(UseItem->TagBits & UnitReplicationBits::Slot_TargetIsMove))
-							{
-								if (!UseItem->TargetLoc.IsNearlyZero())
+								// Sofort-Initialisierung der Location aus dem Entity-Transform
+								if (const FTransformFragment* TgtXf = EntityManager.GetFragmentDataPtr<FTransformFragment>(*FoundTarget))
 								{
-									AIT.LastKnownLocation = FVector(UseItem->TargetLoc);
-									if (!AIT.TargetEntity.IsSet()) AIT.bHasValidTarget = true;
+									AIT.LastKnownLocation = TgtXf->GetTransform().GetLocation();
 								}
 							}
-
-							// Synchronize other flags from packed bits
-							AIT.IsFocusedOnTarget = (PE & UnitReplicationBits::Packed_IsFocusedOnTarget) != 0;
-							AIT.bHasValidTarget = (PE & UnitReplicationBits::Packed_HasValidTarget) != 0;
-							
-							// Action Slot 2 (Abilities only now). The FRIENDLY follow target is no longer carried in
-							// this contended slot Ã¢â‚¬â€ it is replicated via AUnitBase::FollowUnit and written into
-							// AIT.FriendlyTargetEntity / LastKnownFriendlyLocation by UnitActorToFragmentSyncProcessor::
-							// SyncAITarget. (Projectile target is handled in the AI State block below.)
-							if (UseItem->TagBits & UnitReplicationBits::Slot_ActionIsAbility)
-							{
-								AIT.AbilityTargetLocation = FVector(UseItem->ActionLoc);
-							}
+						}
+						else
+						{
+							// AIT.TargetEntity.Reset(); // Keep as memory for DetectionProcessor hysteresis
 						}
 
-						// AI State & Projectile
-						if (AIStateList.IsValidIndex(EntityIdx))
+						// Synchronize LastKnownLocation if provided and not a movement target
+						if (!(UseItem->TagBits & UnitReplicationBits::Slot_TargetIsMove))
 						{
-							FMassAIStateFragment& AIS = AIStateList[EntityIdx];
-							AIS.CanAttack = (UseItem->ReplicationBits & UnitReplicationBits::AIS_CanAttack) != 0;
-							AIS.CanMove = (UseItem->ReplicationBits & UnitReplicationBits::AIS_CanMove) != 0;
-							if (UseItem->TagBits & UnitReplicationBits::Slot_ActionIsProjectile)
+							if (!UseItem->TargetLoc.IsNearlyZero())
 							{
-								AIS.ProjectileFireCounter = (uint8)((UseItem->AuxData >> 16) & 0xFF);
-								AIS.LastProjectileTargetLocation = FVector(UseItem->ActionLoc);
-								AIS.LastTargetNetID = UseItem->ActionID;
-
-								// Resolve Projectile Style from Registry
-								uint8 StyleIdx = (uint8)((UseItem->ReplicationBits & UnitReplicationBits::AIS_StyleIndexMask) >> UnitReplicationBits::AIS_StyleIndexShift);
-								if (StyleIdx > 0 && Bubble && Bubble->ProjectileStyleRegistry.IsValidIndex(StyleIdx - 1))
-								{
-									AIS.LastProjectileClass = Bubble->ProjectileStyleRegistry[StyleIdx - 1].ProjectileClass;
-								}
-								else
-								{
-									AIS.LastProjectileClass = nullptr; // Fallback to unit default
-								}
+								AIT.LastKnownLocation = FVector(UseItem->TargetLoc);
+								if (!AIT.TargetEntity.IsSet()) AIT.bHasValidTarget = true;
 							}
 						}
 
-						// Effect Area Sync
-						if (EffectAreaImpactList.IsValidIndex(EntityIdx))
+						// Synchronize other flags from packed bits
+						AIT.IsFocusedOnTarget = (PE & UnitReplicationBits::Packed_IsFocusedOnTarget) != 0;
+						AIT.bHasValidTarget = (PE & UnitReplicationBits::Packed_HasValidTarget) != 0;
+						
+						// Action Slot 2 (Abilities only now). The FRIENDLY follow target is no longer carried in
+						// this contended slot Ã¢â‚¬â€ it is replicated via AUnitBase::FollowUnit and written into
+						// AIT.FriendlyTargetEntity / LastKnownFriendlyLocation by UnitActorToFragmentSyncProcessor::
+						// SyncAITarget. (Projectile target is handled in the AI State block below.)
+						if (UseItem->TagBits & UnitReplicationBits::Slot_ActionIsAbility)
 						{
-							FEffectAreaImpactFragment& Impact = EffectAreaImpactList[EntityIdx];
-							bool bWasScaling = Impact.bIsScalingAfterImpact;
-							Impact.bIsScalingAfterImpact = (UseItem->ReplicationBits & UnitReplicationBits::EA_bIsScalingAfterImpact) != 0;
-							Impact.bImpactScaleTriggered = (UseItem->ReplicationBits & UnitReplicationBits::EA_bImpactScaleTriggered) != 0;
-							Impact.bPendingDestruction = (UseItem->ReplicationBits & UnitReplicationBits::EA_bPendingDestruction) != 0;
-							Impact.bImpactVFXTriggered = (UseItem->ReplicationBits & UnitReplicationBits::EA_bImpactVFXTriggered) != 0;
-
+							AIT.AbilityTargetLocation = FVector(UseItem->ActionLoc);
 						}
+					}
 
-						// Animation
-						if (RunAnimList.IsValidIndex(EntityIdx))
+					// AI State & Projectile
+					if (AIStateList.IsValidIndex(EntityIdx))
+					{
+						FMassAIStateFragment& AIS = AIStateList[EntityIdx];
+						AIS.CanAttack = (UseItem->ReplicationBits & UnitReplicationBits::AIS_CanAttack) != 0;
+						AIS.CanMove = (UseItem->ReplicationBits & UnitReplicationBits::AIS_CanMove) != 0;
+						if (UseItem->TagBits & UnitReplicationBits::Slot_ActionIsProjectile)
 						{
-							RunAnimList[EntityIdx].Duration = (float)(UseItem->AuxData & 0xFFFF) / 100.f;
-							RunAnimList[EntityIdx].AnimationState = static_cast<UnitData::EState>((PE & UnitReplicationBits::Packed_AnimStateMask) >> UnitReplicationBits::Packed_AnimStateShift);
-						}
+							AIS.ProjectileFireCounter = (uint8)((UseItem->AuxData >> 16) & 0xFF);
+							AIS.LastProjectileTargetLocation = FVector(UseItem->ActionLoc);
+							AIS.LastTargetNetID = UseItem->ActionID;
 
-						// Visual Effects
-						if (EffectList.IsValidIndex(EntityIdx))
-						{
-							uint16 Active = (PE & UnitReplicationBits::Packed_ActiveEffectsMask) >> UnitReplicationBits::Packed_ActiveEffectsShift;
-							EffectList[EntityIdx].bPulsateEnabled = (Active & (1 << 0)) != 0;
-							EffectList[EntityIdx].bRotationEnabled = (Active & (1 << 1)) != 0;
-							EffectList[EntityIdx].bOscillationEnabled = (Active & (1 << 2)) != 0;
+							// Resolve Projectile Style from Registry
+							uint8 StyleIdx = (uint8)((UseItem->ReplicationBits & UnitReplicationBits::AIS_StyleIndexMask) >> UnitReplicationBits::AIS_StyleIndexShift);
+							if (StyleIdx > 0 && Bubble && Bubble->ProjectileStyleRegistry.IsValidIndex(StyleIdx - 1))
+							{
+								AIS.LastProjectileClass = Bubble->ProjectileStyleRegistry[StyleIdx - 1].ProjectileClass;
+							}
+							else
+							{
+								AIS.LastProjectileClass = nullptr; // Fallback to unit default
+							}
 						}
+					}
+
+					// Effect Area Sync
+					if (EffectAreaImpactList.IsValidIndex(EntityIdx))
+					{
+						FEffectAreaImpactFragment& Impact = EffectAreaImpactList[EntityIdx];
+						bool bWasScaling = Impact.bIsScalingAfterImpact;
+						Impact.bIsScalingAfterImpact = (UseItem->ReplicationBits & UnitReplicationBits::EA_bIsScalingAfterImpact) != 0;
+						Impact.bImpactScaleTriggered = (UseItem->ReplicationBits & UnitReplicationBits::EA_bImpactScaleTriggered) != 0;
+						Impact.bPendingDestruction = (UseItem->ReplicationBits & UnitReplicationBits::EA_bPendingDestruction) != 0;
+						Impact.bImpactVFXTriggered = (UseItem->ReplicationBits & UnitReplicationBits::EA_bImpactVFXTriggered) != 0;
+
+					}
+
+					// Animation
+					if (RunAnimList.IsValidIndex(EntityIdx))
+					{
+						RunAnimList[EntityIdx].Duration = (float)(UseItem->AuxData & 0xFFFF) / 100.f;
+						RunAnimList[EntityIdx].AnimationState = static_cast<UnitData::EState>((PE & UnitReplicationBits::Packed_AnimStateMask) >> UnitReplicationBits::Packed_AnimStateShift);
+					}
 
-						// Move Target
-						if (MoveTargetList.IsValidIndex(EntityIdx))
+					// Visual Effects
+					if (EffectList.IsValidIndex(EntityIdx))
+					{
+						uint16 Active = (PE & UnitReplicationBits::Packed_ActiveEffectsMask) >> UnitReplicationBits::Packed_ActiveEffectsShift;
+						EffectList[EntityIdx].bPulsateEnabled = (Active & (1 << 0)) != 0;
+						EffectList[EntityIdx].bRotationEnabled = (Active & (1 << 1)) != 0;
+						EffectList[EntityIdx].bOscillationEnabled = (Active & (1 << 2)) != 0;
+					}
+
+					// Move Target
+					if (MoveTargetList.IsValidIndex(EntityIdx))
+					{
+						FMassMoveTargetFragment& MT = MoveTargetList[EntityIdx];
+						if (UseItem->TagBits & UnitReplicationBits::Slot_TargetIsMove)
 						{
-							FMassMoveTargetFragment& MT = MoveTargetList[EntityIdx];
-							if (UseItem->TagBits & UnitReplicationBits::Slot_TargetIsMove)
+							MT.Center = FVector(UseItem->TargetLoc);
+							MT.SlackRadius = (float)(UseItem->MoveData & 0xFF);
+							MT.DesiredSpeed.Set((float)((UseItem->MoveData >> 8) & 0xFFF));
+							MT.IntentAtGoal = static_cast<EMassMovementAction>((PE & UnitReplicationBits::Packed_MoveIntentMask) >> UnitReplicationBits::Packed_MoveIntentShift);
+							MT.DistanceToGoal = (float)((UseItem->AuxData >> 24) & 0xFF) * 4.f;
+
+							const uint32 ActionID = (UseItem->MoveData >> 20) & 0xFFF;
+							if (AActor* OA = ActorList[EntityIdx].GetMutable())
 							{
-								MT.Center = FVector(UseItem->TargetLoc);
-								MT.SlackRadius = (float)(UseItem->MoveData & 0xFF);
-								MT.DesiredSpeed.Set((float)((UseItem->MoveData >> 8) & 0xFFF));
-								MT.IntentAtGoal = static_cast<EMassMovementAction>((PE & UnitReplicationBits::Packed_MoveIntentMask) >> UnitReplicationBits::Packed_MoveIntentShift);
-								MT.DistanceToGoal = (float)((UseItem->AuxData >> 24) & 0xFF) * 4.f;
-
-								const uint32 ActionID = (UseItem->MoveData >> 20) & 0xFFF;
-								if (AActor* OA = ActorList[EntityIdx].GetMutable())
-								{
-									MT.CreateReplicatedAction(MT.IntentAtGoal, ActionID, World->GetTimeSeconds(), (double)UseItem->Move_ServerStartTime);
-								}
+								MT.CreateReplicatedAction(MT.IntentAtGoal, ActionID, World->GetTimeSeconds(), (double)UseItem->Move_ServerStartTime);
 							}
-							else
+						}
+						else
+						{
+							// NEU: Wenn der Server keine Bewegung mehr signalisiert, muss der Client lokal stoppen.
+							// Dies verhindert, dass der lokale MovementProcessor die Einheit gegen die Replikation schiebt.
+							// Zusaetzlich: MoveTarget.Center auf die AUTORITATIVE Position re-ankern. Sonst bleibt Center
+							// auf dem letzten Bewegungsziel "stale" stehen, der Konvergenz-Clear im UnitMovementProcessor
+							// (Dist2D(MoveTarget.Center, Pred.Location) <= r^2) feuert nie, Pred.bHasData bleibt ewig true
+							// und der lokale Mover kaempft gegen den Reconciler -> End-Position-Jitter.
+							MT.Center = FVector(UseItem->Location);
+							if (MT.DesiredSpeed.Get() > 0.f)
 							{
-								// NEU: Wenn der Server keine Bewegung mehr signalisiert, muss der Client lokal stoppen.
-								// Dies verhindert, dass der lokale MovementProcessor die Einheit gegen die Replikation schiebt.
-								// Zusaetzlich: MoveTarget.Center auf die AUTORITATIVE Position re-ankern. Sonst bleibt Center
-								// auf dem letzten Bewegungsziel "stale" stehen, der Konvergenz-Clear im UnitMovementProcessor
-								// (Dist2D(MoveTarget.Center, Pred.Location) <= r^2) feuert nie, Pred.bHasData bleibt ewig true
-								// und der lokale Mover kaempft gegen den Reconciler -> End-Position-Jitter.
-								MT.Center = FVector(UseItem->Location);
-								if (MT.DesiredSpeed.Get() > 0.f)
-								{
-									MT.DesiredSpeed.Set(0.f);
-									MT.IntentAtGoal = EMassMovementAction::Stand;
-								}
+								MT.DesiredSpeed.Set(0.f);
+								MT.IntentAtGoal = EMassMovementAction::Stand;
 							}
 						}
 					}
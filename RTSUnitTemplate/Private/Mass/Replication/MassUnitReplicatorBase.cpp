@@ -96,6 +96,24 @@ static TAutoConsoleVariable<int32> CVarRTS_ServerRep_NewUnitsBudgetPerFrame(
 	TEXT("Maximum number of new units to add to the replication bubble per frame to avoid oversized packets."),
 	ECVF_Default);
 
+// Per-team relevancy: connection-owned bubbles only carry units their team (and allies) can see,
+// the unowned shared bubble carries units that are never fog-filtered.
+static TAutoConsoleVariable<int32> CVarRTS_Relevancy_Enable(
+	TEXT("net.RTS.Relevancy.Enable"),
+	0,
+	TEXT("1 = filter each connection's bubble by its team's sight (fog of war), 0 = every bubble replicates every unit."),
+	ECVF_Default);
+static TAutoConsoleVariable<float> CVarRTS_Relevancy_EnterDelay(
+	TEXT("net.RTS.Relevancy.EnterDelay"),
+	0.0f,
+	TEXT("Seconds a unit must stay visible to a team before it is added to that team's bubble."),
+	ECVF_Default);
+static TAutoConsoleVariable<float> CVarRTS_Relevancy_LeaveDelay(
+	TEXT("net.RTS.Relevancy.LeaveDelay"),
+	2.0f,
+	TEXT("Seconds a unit stays in a team's bubble after it was last visible, so units at the fog edge do not churn."),
+	ECVF_Default);
+
 static int32 GNewUnitsAddedThisFrame = 0;
 
 namespace { inline int32 RepLogLevel(){ return CVarRTS_ServerReplicator_LogLevel.GetValueOnGameThread(); } }
@@ -134,6 +152,123 @@ static AUnitClientBubbleInfo* GetOrSpawnBubble(UWorld& World)
     return Bubble;
 }
 
+// Helper: find or spawn the unowned bubble that carries always-relevant units while relevancy filtering is on
+static AUnitClientBubbleInfo* GetOrSpawnSharedBubble(UWorld& World)
+{
+	AUnitClientBubbleInfo* Bubble = nullptr;
+	for (TActorIterator<AUnitClientBubbleInfo> It(&World); It; ++It)
+	{
+		if (It->IsSharedBubble())
+		{
+			Bubble = *It;
+			break;
+		}
+	}
+	if (!Bubble && World.GetNetMode() != NM_Client)
+	{
+		FActorSpawnParameters Params;
+		Bubble = World.SpawnActor<AUnitClientBubbleInfo>(AUnitClientBubbleInfo::StaticClass(), FTransform::Identity, Params);
+		if (Bubble)
+		{
+			Bubble->SetReplicates(true);
+			Bubble->SetNetUpdateFrequency(GetBubbleNetUpdateHz());
+		}
+	}
+	if (Bubble && (!Bubble->bAlwaysRelevant || Bubble->bOnlyRelevantToOwner))
+	{
+		// Every client needs the shared items, whichever connection owns the team bubbles
+		Bubble->bAlwaysRelevant = true;
+		Bubble->bOnlyRelevantToOwner = false;
+		Bubble->ForceNetUpdate();
+	}
+	return Bubble;
+}
+
+namespace UnitRelevancy
+{
+	// Units that fog of war never hides (no sight data or explicitly not fog-affected) go to the shared bubble.
+	static bool IsAlwaysRelevant(const FMassEntityManager& EM, const FMassEntityHandle EH)
+	{
+		if (!EM.GetFragmentDataPtr<FMassSightFragment>(EH) || !EM.GetFragmentDataPtr<FMassCombatStatsFragment>(EH))
+		{
+			return true;
+		}
+		const FMassVisibilityFragment* Vis = EM.GetFragmentDataPtr<FMassVisibilityFragment>(EH);
+		return Vis && !Vis->bAffectedByFogOfWar;
+	}
+
+	// Same rule UUnitVisibilityProcessor applies on the client: own/allied unit, seen by the alliance, or attacking it.
+	static bool IsVisibleToMask(const FMassEntityManager& EM, const FMassEntityHandle EH, const int64 ViewerMask)
+	{
+		const FMassCombatStatsFragment* Stats = EM.GetFragmentDataPtr<FMassCombatStatsFragment>(EH);
+		const FMassSightFragment* Sight = EM.GetFragmentDataPtr<FMassSightFragment>(EH);
+		if (!Stats || !Sight)
+		{
+			return true;
+		}
+
+		if (Stats->TeamId >= 0 && Stats->TeamId < 64 && (ViewerMask & (1LL << Stats->TeamId)) != 0)
+		{
+			return true;
+		}
+
+		if (Sight->ConsistentTeamOverlapsPerTeam.AnyInMask(ViewerMask) || Sight->ConsistentAttackerTeamOverlapsPerTeam.AnyInMask(ViewerMask))
+		{
+			return true;
+		}
+
+		if (const FMassAITargetFragment* AIT = EM.GetFragmentDataPtr<FMassAITargetFragment>(EH))
+		{
+			if (AIT->bHasValidTarget && AIT->TargetEntity.IsSet() && EM.IsEntityActive(AIT->TargetEntity))
+			{
+				if (const FMassCombatStatsFragment* TgtStats = EM.GetFragmentDataPtr<FMassCombatStatsFragment>(AIT->TargetEntity))
+				{
+					return TgtStats->Health > 0.f && TgtStats->TeamId >= 0 && TgtStats->TeamId < 64
+						&& (ViewerMask & (1LL << TgtStats->TeamId)) != 0;
+				}
+			}
+		}
+		return false;
+	}
+
+	// Enter/leave hysteresis. Returns whether the unit should be in the bubble this frame.
+	static bool UpdateState(FUnitRelevancyState& State, const bool bVisible, const bool bPresent, const double Now)
+	{
+		if (bVisible)
+		{
+			if (State.VisibleSince < 0.0)
+			{
+				State.VisibleSince = Now;
+			}
+			State.LastVisible = Now;
+			return bPresent || (Now - State.VisibleSince) >= CVarRTS_Relevancy_EnterDelay.GetValueOnGameThread();
+		}
+
+		State.VisibleSince = -1.0;
+		return bPresent && State.LastVisible >= 0.0 && (Now - State.LastVisible) <= CVarRTS_Relevancy_LeaveDelay.GetValueOnGameThread();
+	}
+
+	// Drops bookkeeping of units that have not been visible for a while (destroyed or long gone into the fog).
+	static void SweepStates(AUnitClientBubbleInfo& Bubble, const double Now)
+	{
+		constexpr double SweepInterval = 5.0;
+		if (Now - Bubble.LastRelevancySweepTime < SweepInterval)
+		{
+			return;
+		}
+		Bubble.LastRelevancySweepTime = Now;
+
+		const double MaxAge = CVarRTS_Relevancy_LeaveDelay.GetValueOnGameThread() + SweepInterval;
+		for (auto It = Bubble.RelevancyStates.CreateIterator(); It; ++It)
+		{
+			if (It->Value.VisibleSince < 0.0 && Now - It->Value.LastVisible > MaxAge)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
 bool UMassUnitReplicatorBase::UpdateReplicationBits(FUnitReplicationItem& Item, FMassEntityManager& EM, FMassEntityHandle EH, AUnitClientBubbleInfo* BubbleInfo)
 {
     uint32 NewBits = 0u;
@@ -314,9 +449,11 @@ void UMassUnitReplicatorBase::AddEntity(FMassEntityHandle Entity, FMassReplicati
     const FMassAgentCharacteristicsFragment* CharFrag = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(Entity);
     const FTransform& VisualXf = (CharFrag && !CharFrag->PositionedTransform.Equals(FTransform::Identity)) ? CharFrag->PositionedTransform : Xf;
 
-    // 1) Ensure presence/update in replicated bubble array for clients
+    // 1) Ensure presence/update in replicated bubble array for clients.
+    // With relevancy filtering ProcessClientReplication decides which bubbles receive the unit.
+    const bool bRelevancyFilter = CVarRTS_Relevancy_Enable.GetValueOnGameThread() != 0;
     FUnitReplicationItem* Item = BubbleInfo->Agents.FindItemByNetID(NetID);
-    if (!Item)
+    if (!Item && !bRelevancyFilter)
     {
         // Batching: Limit new units per frame to avoid LogNetPartialBunch (64KB limit)
         if (GNewUnitsAddedThisFrame >= CVarRTS_ServerRep_NewUnitsBudgetPerFrame.GetValueOnGameThread())
@@ -454,13 +591,13 @@ void UMassUnitReplicatorBase::AddEntity(FMassEntityHandle Entity, FMassReplicati
             //    NewItem.AIS_StateTimer, NewItem.AIS_CanAttack?1:0, NewItem.AIS_CanMove?1:0, NewItem.AIS_HoldPosition?1:0);
         }
 
-        const int32 NewIdx = BubbleInfo->Agents.Items.Add(NewItem);
+        const int32 NewIdx = BubbleInfo->Agents.AddItem(NewItem);
         GNewUnitsAddedThisFrame++;
         BubbleInfo->Agents.MarkItemDirty(BubbleInfo->Agents.Items[NewIdx]);
         BubbleInfo->Agents.MarkArrayDirty();
         BubbleInfo->ForceNetUpdate();
     }
-    else
+    else if (Item)
     {
         // Update initial values just in case and mark dirty using configurable thresholds
         const float LocThresh = FMath::Max(0.01f, CVarRTS_ServerRep_LocThresholdCm.GetValueOnGameThread());
@@ -588,6 +725,20 @@ void UMassUnitReplicatorBase::RemoveEntity(FMassEntityHandle Entity, FMassReplic
         BubbleInfo->ForceNetUpdate();
     }
 
+    // Team-filtered bubbles each hold their own subset
+    if (CVarRTS_Relevancy_Enable.GetValueOnGameThread() != 0)
+    {
+        for (TActorIterator<AUnitClientBubbleInfo> It(World); It; ++It)
+        {
+            It->RelevancyStates.Remove(NetID);
+            if (*It != BubbleInfo && It->Agents.RemoveItemByNetID(NetID))
+            {
+                It->Agents.MarkArrayDirty();
+                It->ForceNetUpdate();
+            }
+        }
+    }
+
     // Remove from authoritative Unit Registry as well
     if (AUnitRegistryReplicator* Reg = AUnitRegistryReplicator::GetOrSpawn(*World))
     {
@@ -650,11 +801,21 @@ void UMassUnitReplicatorBase::ProcessClientReplication(FMassExecutionContext& Co
                 Bubbles.Add(Fallback);
             }
         }
+        const bool bRelevancyFilter = CVarRTS_Relevancy_Enable.GetValueOnGameThread() != 0;
+        if (bRelevancyFilter)
+        {
+            // Always-relevant units need a bubble every connection receives
+            if (AUnitClientBubbleInfo* Shared = GetOrSpawnSharedBubble(*World))
+            {
+                Bubbles.AddUnique(Shared);
+            }
+        }
         if (Bubbles.Num() == 0)
         {
             UE_LOG(LogTemp, Warning, TEXT("MassUnitReplicatorBase: No AUnitClientBubbleInfo available in world to populate Agents."));
             return;
         }
+        const double Now = World->GetTimeSeconds();
 
         const TConstArrayView<FTransformFragment> TransformList = Context.GetFragmentView<FTransformFragment>();
         const TConstArrayView<FMassNetworkIDFragment> NetIDList = Context.GetFragmentView<FMassNetworkIDFragment>();
@@ -713,11 +874,54 @@ void UMassUnitReplicatorBase::ProcessClientReplication(FMassExecutionContext& Co
                 }
             }
 
+            // Relevancy role of this bubble: shared (always-relevant units only) or team view (ViewerMask != 0).
+            // Owned bubbles without a team (spectators) keep every fog-affected unit.
+            const bool bSharedBubble = bRelevancyFilter && BubbleInfo->IsSharedBubble();
+            const int64 ViewerMask = (bRelevancyFilter && !bSharedBubble) ? BubbleInfo->GetViewerAllianceMask() : 0;
+            if (ViewerMask != 0)
+            {
+                UnitRelevancy::SweepStates(*BubbleInfo, Now);
+            }
+
             bool bAnyDirty = false;
             for (int32 Idx = LoopStart; Idx < LoopEnd; ++Idx)
             {
                 const FMassNetworkID& NetID = NetIDList[Idx].NetID;
 
+                if (bRelevancyFilter && EM)
+                {
+                    const FMassEntityHandle RelevancyEH = Context.GetEntity(Idx);
+                    const bool bPresent = BubbleInfo->Agents.FindIndexByNetID(NetID) != INDEX_NONE;
+                    const bool bAlwaysRelevant = UnitRelevancy::IsAlwaysRelevant(*EM, RelevancyEH);
+
+                    bool bRelevant = bSharedBubble ? bAlwaysRelevant : !bAlwaysRelevant;
+                    if (bRelevant && ViewerMask != 0)
+                    {
+                        const bool bVisible = UnitRelevancy::IsVisibleToMask(*EM, RelevancyEH, ViewerMask);
+                        FUnitRelevancyState& State = BubbleInfo->RelevancyStates.FindOrAdd(NetID);
+                        bRelevant = UnitRelevancy::UpdateState(State, bVisible, bPresent, Now);
+                        if (!bRelevant && !bVisible)
+                        {
+                            BubbleInfo->RelevancyStates.Remove(NetID);
+                        }
+                    }
+
+                    if (!bRelevant)
+                    {
+                        if (bPresent && BubbleInfo->Agents.RemoveItemByNetID(NetID))
+                        {
+                            bAnyDirty = true;
+                        }
+                        continue;
+                    }
+
+                    // Units entering relevancy share the per-frame add budget with newly spawned ones
+                    if (!bPresent && GNewUnitsAddedThisFrame >= CVarRTS_ServerRep_NewUnitsBudgetPerFrame.GetValueOnGameThread())
+                    {
+                        continue;
+                    }
+                }
+
                 // We now replicate dead entities as well. Do not remove them from the bubble here.
                 // Dead state will be carried in TagBits and consumers can react accordingly.
 
@@ -863,7 +1067,7 @@ void UMassUnitReplicatorBase::ProcessClientReplication(FMassExecutionContext& Co
                         }
                     }
                     
-                    const int32 NewIdx = BubbleInfo->Agents.Items.Add(NewItem);
+                    const int32 NewIdx = BubbleInfo->Agents.AddItem(NewItem);
                     GNewUnitsAddedThisFrame++;
                     BubbleInfo->Agents.MarkItemDirty(BubbleInfo->Agents.Items[NewIdx]);
                     bAnyDirty = true;
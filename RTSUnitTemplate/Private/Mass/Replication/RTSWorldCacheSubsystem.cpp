@@ -38,6 +38,9 @@ void URTSWorldCacheSubsystem::ClearAll()
 {
 	CachedRegistry.Reset();
 	CachedBubble.Reset();
+	CachedSharedBubble.Reset();
+	LastBubbleScanTime = -1000.0;
+	LastSharedBubbleScanTime = -1000.0;
 	BindingByOwnerName.Reset();
 	BindingByUnitIndex.Reset();
 	BindingByMassNetID.Reset();
@@ -74,19 +77,36 @@ AUnitRegistryReplicator* URTSWorldCacheSubsystem::GetRegistry(bool bAllowSpawnOn
 
 AUnitClientBubbleInfo* URTSWorldCacheSubsystem::GetBubble(bool bAllowSpawnOnServer)
 {
+	UWorld* World = GetWorld();
 	if (CachedBubble.IsValid())
 	{
-		return CachedBubble.Get();
+		if (!CachedBubble->IsSharedBubble() || !World || (World->GetTimeSeconds() - LastBubbleScanTime) < 1.0)
+		{
+			return CachedBubble.Get();
+		}
 	}
-	UWorld* World = GetWorld();
 	if (!World)
 	{
 		return nullptr;
 	}
+	LastBubbleScanTime = World->GetTimeSeconds();
+	AUnitClientBubbleInfo* Found = nullptr;
 	for (TActorIterator<AUnitClientBubbleInfo> It(World); It; ++It)
 	{
-		CachedBubble = *It;
-		return *It;
+		if (!It->IsSharedBubble())
+		{
+			Found = *It;
+			break;
+		}
+		if (!Found)
+		{
+			Found = *It;
+		}
+	}
+	if (Found)
+	{
+		CachedBubble = Found;
+		return Found;
 	}
 	if (bAllowSpawnOnServer && World->GetNetMode() != NM_Client)
 	{
@@ -109,6 +129,65 @@ AUnitClientBubbleInfo* URTSWorldCacheSubsystem::GetBubble(bool bAllowSpawnOnServ
 	return nullptr;
 }
 
+AUnitClientBubbleInfo* URTSWorldCacheSubsystem::GetSharedBubble()
+{
+	if (CachedSharedBubble.IsValid())
+	{
+		return CachedSharedBubble.Get();
+	}
+	UWorld* World = GetWorld();
+	if (!World || (World->GetTimeSeconds() - LastSharedBubbleScanTime) < 1.0)
+	{
+		return nullptr;
+	}
+	LastSharedBubbleScanTime = World->GetTimeSeconds();
+	for (TActorIterator<AUnitClientBubbleInfo> It(World); It; ++It)
+	{
+		if (It->IsSharedBubble())
+		{
+			CachedSharedBubble = *It;
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+FUnitReplicationItem* URTSWorldCacheSubsystem::FindReplicatedItem(const FMassNetworkID& NetID, AUnitClientBubbleInfo** OutBubble)
+{
+	AUnitClientBubbleInfo* Bubble = GetBubble(false);
+	FUnitReplicationItem* Item = Bubble ? Bubble->Agents.FindItemByNetID(NetID) : nullptr;
+	if (!Item)
+	{
+		AUnitClientBubbleInfo* Shared = GetSharedBubble();
+		if (Shared && Shared != Bubble)
+		{
+			Bubble = Shared;
+			Item = Shared->Agents.FindItemByNetID(NetID);
+		}
+	}
+	if (OutBubble)
+	{
+		*OutBubble = Item ? Bubble : nullptr;
+	}
+	return Item;
+}
+
+const FPlayerMouseData* URTSWorldCacheSubsystem::FindPlayerMouseData(int32 PlayerId)
+{
+	auto FindIn = [PlayerId](const AUnitClientBubbleInfo* Bubble) -> const FPlayerMouseData*
+	{
+		return Bubble ? Bubble->PlayerMouseDatas.FindByPredicate([PlayerId](const FPlayerMouseData& Data) { return Data.PlayerId == PlayerId; }) : nullptr;
+	};
+
+	AUnitClientBubbleInfo* Bubble = GetBubble(false);
+	if (const FPlayerMouseData* Data = FindIn(Bubble))
+	{
+		return Data;
+	}
+	AUnitClientBubbleInfo* Shared = GetSharedBubble();
+	return Shared != Bubble ? FindIn(Shared) : nullptr;
+}
+
 void URTSWorldCacheSubsystem::RebuildBindingCacheIfNeeded(float IntervalSeconds)
 {
 	UWorld* World = GetWorld();
@@ -80,6 +80,8 @@ void UUnitActorToFragmentSyncProcessor::Execute(FMassEntityManager& EntityManage
 		const TArrayView<FMassAITargetFragment> AITargetList = ChunkContext.GetMutableFragmentView<FMassAITargetFragment>();
 		const TArrayView<FMassAllianceFragment> AllianceList = ChunkContext.GetMutableFragmentView<FMassAllianceFragment>();
 		const TArrayView<FTransformFragment> TransformList = ChunkContext.GetMutableFragmentView<FTransformFragment>();
+		// Attack and Pause run off the game thread and only read the cached follow slot.
+		const bool bChunkNeedsFollowPosition = ChunkContext.DoesArchetypeHaveTag<FMassStateAttackTag>() || ChunkContext.DoesArchetypeHaveTag<FMassStatePauseTag>();
 
 		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
 		{
@@ -93,6 +95,12 @@ void UUnitActorToFragmentSyncProcessor::Execute(FMassEntityManager& EntityManage
 				if (AIStateList.Num() > 0 && CombatStatsList.Num() > 0) SyncAIState(*Unit, AIStateList[EntityIndex], CombatStatsList[EntityIndex]);
 				if (MoveTargetList.Num() > 0) SyncMoveTarget(*Unit, MoveTargetList[EntityIndex]);
 				if (AITargetList.Num() > 0) SyncAITarget(*Unit, AITargetList[EntityIndex], EntityManager);
+				if (AITargetList.Num() > 0 && TransformList.Num() > 0)
+				{
+					UpdateFollowPosition(EntityManager, ChunkContext.GetEntity(EntityIndex), AITargetList[EntityIndex],
+						CharacteristicsList.Num() > 0 ? &CharacteristicsList[EntityIndex] : nullptr,
+						TransformList[EntityIndex].GetTransform().GetLocation(), bChunkNeedsFollowPosition, ChunkContext.GetWorld());
+				}
 				if (VisibilityList.Num() > 0) SyncVisibility(*Unit, VisibilityList[EntityIndex]);
 				if (VisualEffectList.Num() > 0) SyncVisualEffect(*Unit, VisualEffectList[EntityIndex]);
 				if (AllianceList.Num() > 0) AllianceList[EntityIndex].AlliedTeamsMask = Unit->AlliedTeamsMask;
@@ -277,6 +285,17 @@ void UUnitActorToFragmentSyncProcessor::SyncAITarget(const AUnitBase& Unit, FMas
 	}
 }
 
+void UUnitActorToFragmentSyncProcessor::UpdateFollowPosition(FMassEntityManager& EntityManager, const FMassEntityHandle Entity, FMassAITargetFragment& AITarget,
+	const FMassAgentCharacteristicsFragment* Characteristics, const FVector& CurrentLocation, bool bNeedsFollowPosition, UWorld* World)
+{
+	// Cleared outside Attack/Pause so a unit entering those states never reads a slot from an earlier episode.
+	AITarget.bHasCachedFollowPosition = bNeedsFollowPosition && EntityManager.IsEntityActive(AITarget.FriendlyTargetEntity);
+	if (AITarget.bHasCachedFollowPosition)
+	{
+		AITarget.CachedFollowPosition = CalculateFollowPositionForTarget(EntityManager, Entity, AITarget, Characteristics, CurrentLocation, World);
+	}
+}
+
 void UUnitActorToFragmentSyncProcessor::SyncVisibility(const AUnitBase& Unit, FMassVisibilityFragment& Visibility)
 {
 	if (Unit.Attributes)
@@ -13,6 +13,7 @@
 #include "Mass/MassActorBindingComponent.h"
 #include "Characters/Unit/UnitBase.h"
 #include "Actors/Projectile.h"
+#include "Controller/PlayerController/ControllerBase.h"
 
 // 0=Off, 1=Warn, 2=Verbose
 static TAutoConsoleVariable<int32> CVarRTS_Bubble_LogLevel(
@@ -40,6 +41,8 @@ static FTransform BuildTransformFromItem(const FUnitReplicationItem& Item)
 
 void FUnitReplicationItem::PostReplicatedAdd(const FUnitReplicationArray& InArraySerializer)
 {
+	InArraySerializer.MarkNetIDIndexDirty();
+
 	if (InArraySerializer.OwnerBubble && InArraySerializer.OwnerBubble->GetNetMode() == NM_Client)
 	{
 		const FTransform Xf = BuildTransformFromItem(*this);
@@ -57,6 +60,8 @@ void FUnitReplicationItem::PostReplicatedAdd(const FUnitReplicationArray& InArra
 
 void FUnitReplicationItem::PostReplicatedChange(const FUnitReplicationArray& InArraySerializer)
 {
+	InArraySerializer.MarkNetIDIndexDirty();
+
 	if (InArraySerializer.OwnerBubble && InArraySerializer.OwnerBubble->GetNetMode() == NM_Client)
 	{
 		UnitReplicationCache::SetLatest(NetID, BuildTransformFromItem(*this));
@@ -381,6 +386,8 @@ void FUnitReplicationItem::PostReplicatedChange(const FUnitReplicationArray& InA
 
 void FUnitReplicationItem::PreReplicatedRemove(const FUnitReplicationArray& InArraySerializer)
 {
+	InArraySerializer.MarkNetIDIndexDirty();
+
 	if (InArraySerializer.OwnerBubble && InArraySerializer.OwnerBubble->GetNetMode() == NM_Client)
 	{
 		UnitReplicationCache::Remove(NetID);
@@ -425,9 +432,22 @@ void AUnitClientBubbleInfo::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 	DOREPLIFETIME(AUnitClientBubbleInfo, PlayerMouseDatas);
 }
 
+int64 AUnitClientBubbleInfo::GetViewerAllianceMask() const
+{
+	const AControllerBase* PC = Cast<AControllerBase>(GetOwner());
+	if (!PC || PC->SelectableTeamId <= 0 || PC->SelectableTeamId >= 64)
+	{
+		// Shared bubble, spectator (team 0) or team not assigned yet: unfiltered
+		return 0;
+	}
+	return PC->AlliedTeamsMask | (1LL << PC->SelectableTeamId);
+}
+
 void AUnitClientBubbleInfo::OnRep_Agents()
 {
 	Agents.OwnerBubble = this;
+	// PostReplicatedReceive normally rebuilds it already; this also covers receive paths that skip it.
+	Agents.EnsureNetIDIndex();
 	const int32 Level = CVarRTS_Bubble_LogLevel.GetValueOnGameThread();
 	if (Level >= 1)
 	{
@@ -18,6 +18,7 @@
 #include "MassEntitySubsystem.h"
 #include "MassReplicationFragments.h"
 #include "HAL/IConsoleManager.h"
+#include "System/UnitIndexSubsystem.h"
 
 // 0=Off, 1=Warn, 2=Verbose
 static TAutoConsoleVariable<int32> CVarRTS_Registry_LogLevel(
@@ -173,30 +174,32 @@ void AUnitRegistryReplicator::OnRep_Registry()
 					if (It.UnitIndex != INDEX_NONE) { RegIndices.Add(It.UnitIndex); }
 				}
 				int32 Cleaned = 0;
-				for (TActorIterator<AUnitBase> It(World); It; ++It)
+				if (UUnitIndexSubsystem* UnitIndexSubsystem = World->GetSubsystem<UUnitIndexSubsystem>())
 				{
-					AUnitBase* Unit = *It;
-					if (!IsValid(Unit)) { continue; }
-					// Do NOT destroy units simply because they are Dead; keep them until actor/entity despawns.
-					// Use ONLY UnitIndex for registry check on client. OwnerName (GetFName) is unstable.
-					const bool bInReg = (Unit->UnitIndex != INDEX_NONE && RegIndices.Contains(Unit->UnitIndex));
-					bool bHasValidBinding = false;
-					if (UMassActorBindingComponent* Bind = Unit->FindComponentByClass<UMassActorBindingComponent>())
+					UnitIndexSubsystem->ForEachUnit([&](AUnitBase* Unit)
 					{
-						bHasValidBinding = Bind->GetEntityHandle().IsSet();
-					}
-					if (!bInReg || !bHasValidBinding)
-					{
-						// Final sanity check: if it's dead, we might be keeping it for visuals, but if it's not in registry at all, it's a ghost.
-						// If it's not dead but also not in registry, it's definitely a ghost.
-						if (RegLogLevel() >= 1)
+						if (!IsValid(Unit)) { return; }
+						// Do NOT destroy units simply because they are Dead; keep them until actor/entity despawns.
+						// Use ONLY UnitIndex for registry check on client. OwnerName (GetFName) is unstable.
+						const bool bInReg = (Unit->UnitIndex != INDEX_NONE && RegIndices.Contains(Unit->UnitIndex));
+						bool bHasValidBinding = false;
+						if (UMassActorBindingComponent* Bind = Unit->FindComponentByClass<UMassActorBindingComponent>())
 						{
-							UE_LOG(LogTemp, Warning, TEXT("[RTS.Registry] Client reconcile destroying zombie Unit %s (Index=%d, HasBinding=%d)"), 
-								*Unit->GetName(), Unit->UnitIndex, bHasValidBinding ? 1 : 0);
+							bHasValidBinding = Bind->GetEntityHandle().IsSet();
 						}
-						Unit->Destroy();
-						++Cleaned;
-					}
+						if (!bInReg || !bHasValidBinding)
+						{
+							// Final sanity check: if it's dead, we might be keeping it for visuals, but if it's not in registry at all, it's a ghost.
+							// If it's not dead but also not in registry, it's definitely a ghost.
+							if (RegLogLevel() >= 1)
+							{
+								UE_LOG(LogTemp, Warning, TEXT("[RTS.Registry] Client reconcile destroying zombie Unit %s (Index=%d, HasBinding=%d)"), 
+									*Unit->GetName(), Unit->UnitIndex, bHasValidBinding ? 1 : 0);
+							}
+							Unit->Destroy();
+							++Cleaned;
+						}
+					});
 				}
 				if (Cleaned > 0)
 				{
@@ -269,14 +272,16 @@ static void RunDiagnosticsForWorld(UWorld& World, const FUnitRegistryArray& Regi
 	TSet<int32> LiveIndices;
 	TSet<FName> LiveOwners;
 	int32 LiveUnits = 0;
- for (TActorIterator<AUnitBase> It(&World); It; ++It)
+	if (UUnitIndexSubsystem* UnitIndexSubsystem = World.GetSubsystem<UUnitIndexSubsystem>())
 	{
-		AUnitBase* Unit = *It;
-		if (!IsValid(Unit)) continue;
-		// Ignore units that are dead; they should not be in the registry and shouldn't count as live
-		LiveUnits++;
-		LiveOwners.Add(Unit->GetFName());
-		LiveIndices.Add(Unit->UnitIndex);
+		UnitIndexSubsystem->ForEachUnit([&](AUnitBase* Unit)
+		{
+			if (!IsValid(Unit)) return;
+			// Ignore units that are dead; they should not be in the registry and shouldn't count as live
+			LiveUnits++;
+			LiveOwners.Add(Unit->GetFName());
+			LiveIndices.Add(Unit->UnitIndex);
+		});
 	}
 
 	// Detect unregistered live units (by UnitIndex primarily)
@@ -375,15 +380,19 @@ void AUnitRegistryReplicator::ServerDiagnosticsTick()
 		{
 			// Build sets of currently live actors' keys
 			TSet<int32> LiveIndices;
-			for (TActorIterator<AUnitBase> It(W); It; ++It)
+			TMap<FName, int32> LiveIndexByName;
+			if (UUnitIndexSubsystem* UnitIndexSubsystem = W->GetSubsystem<UUnitIndexSubsystem>())
 			{
-				AUnitBase* Unit = *It;
-				if (!IsValid(Unit)) continue;
-				// Include dead units as live for replication/registry until they despawn
-				if (Unit->UnitIndex != INDEX_NONE)
+				UnitIndexSubsystem->ForEachUnit([&](AUnitBase* Unit)
 				{
-					LiveIndices.Add(Unit->UnitIndex);
-				}
+					if (!IsValid(Unit)) return;
+					LiveIndexByName.Add(Unit->GetFName(), Unit->UnitIndex);
+					// Include dead units as live for replication/registry until they despawn
+					if (Unit->UnitIndex != INDEX_NONE)
+					{
+						LiveIndices.Add(Unit->UnitIndex);
+					}
+				});
 			}
 
 			// Build sets of registry keys for quick lookup
@@ -398,56 +407,58 @@ void AUnitRegistryReplicator::ServerDiagnosticsTick()
 			int32 Inserted = 0;
 			UMassEntitySubsystem* EntitySubsystem = W->GetSubsystem<UMassEntitySubsystem>();
 			FMassEntityManager* EM = EntitySubsystem ? &EntitySubsystem->GetMutableEntityManager() : nullptr;
-			for (TActorIterator<AUnitBase> It2(W); It2; ++It2)
+			if (UUnitIndexSubsystem* UnitIndexSubsystem = W->GetSubsystem<UUnitIndexSubsystem>())
 			{
-				AUnitBase* Unit = *It2;
-				if (!IsValid(Unit)) continue;
-				if (Unit->UnitState == UnitData::Dead) continue;
-				// Do not register units that are not supposed to have Mass
-				if (!Unit->FindComponentByClass<UMassActorBindingComponent>()) continue;
-
-				const bool bMissing = (Unit->UnitIndex == INDEX_NONE || !RegIndices.Contains(Unit->UnitIndex));
-				if (bMissing)
+				UnitIndexSubsystem->ForEachUnit([&](AUnitBase* Unit)
 				{
-					FMassNetworkID NetIDValue;
-					bool bHaveNetID = false;
-					if (EM)
+					if (!IsValid(Unit)) return;
+					if (Unit->UnitState == UnitData::Dead) return;
+					// Do not register units that are not supposed to have Mass
+					if (!Unit->FindComponentByClass<UMassActorBindingComponent>()) return;
+
+					const bool bMissing = (Unit->UnitIndex == INDEX_NONE || !RegIndices.Contains(Unit->UnitIndex));
+					if (bMissing)
 					{
-						if (UMassActorBindingComponent* Bind = Unit->FindComponentByClass<UMassActorBindingComponent>())
+						FMassNetworkID NetIDValue;
+						bool bHaveNetID = false;
+						if (EM)
 						{
-							const FMassEntityHandle EHandle = Bind->GetMassEntityHandle();
-							if (EHandle.IsSet() && EM->IsEntityValid(EHandle))
+							if (UMassActorBindingComponent* Bind = Unit->FindComponentByClass<UMassActorBindingComponent>())
 							{
-								if (FMassNetworkIDFragment* NetFrag = EM->GetFragmentDataPtr<FMassNetworkIDFragment>(EHandle))
+								const FMassEntityHandle EHandle = Bind->GetMassEntityHandle();
+								if (EHandle.IsSet() && EM->IsEntityValid(EHandle))
 								{
-									if (NetFrag->NetID.GetValue() != 0)
-									{
-										NetIDValue = NetFrag->NetID;
-										bHaveNetID = true;
-									}
-									else
+									if (FMassNetworkIDFragment* NetFrag = EM->GetFragmentDataPtr<FMassNetworkIDFragment>(EHandle))
 									{
-										// Assign new NetID if missing
-										NetIDValue = FMassNetworkID(GetNextNetID());
-										NetFrag->NetID = NetIDValue;
-										bHaveNetID = true;
+										if (NetFrag->NetID.GetValue() != 0)
+										{
+											NetIDValue = NetFrag->NetID;
+											bHaveNetID = true;
+										}
+										else
+										{
+											// Assign new NetID if missing
+											NetIDValue = FMassNetworkID(GetNextNetID());
+											NetFrag->NetID = NetIDValue;
+											bHaveNetID = true;
+										}
 									}
 								}
 							}
 						}
+						if (!bHaveNetID)
+						{
+							// As a last resort, allocate a NetID to keep registry consistent
+							NetIDValue = FMassNetworkID(GetNextNetID());
+						}
+						const int32 NewIdx = Registry.Items.AddDefaulted();
+						Registry.Items[NewIdx].OwnerName = Unit->GetFName();
+						Registry.Items[NewIdx].UnitIndex = Unit->UnitIndex;
+						Registry.Items[NewIdx].NetID = NetIDValue;
+						Registry.MarkItemDirty(Registry.Items[NewIdx]);
+						Inserted++;
 					}
-					if (!bHaveNetID)
-					{
-						// As a last resort, allocate a NetID to keep registry consistent
-						NetIDValue = FMassNetworkID(GetNextNetID());
-					}
-					const int32 NewIdx = Registry.Items.AddDefaulted();
-					Registry.Items[NewIdx].OwnerName = Unit->GetFName();
-					Registry.Items[NewIdx].UnitIndex = Unit->UnitIndex;
-					Registry.Items[NewIdx].NetID = NetIDValue;
-					Registry.MarkItemDirty(Registry.Items[NewIdx]);
-					Inserted++;
-				}
+				});
 			}
 
 			int32 Removed = 0;
@@ -460,17 +471,10 @@ void AUnitRegistryReplicator::ServerDiagnosticsTick()
 				bool bOwnerReused = false;
 				if (Itm.OwnerName != NAME_None)
 				{
-					// Use a cheap search for the actor by name
-					for (TActorIterator<AUnitBase> It(W); It; ++It)
+					const int32* LiveIndex = LiveIndexByName.Find(Itm.OwnerName);
+					if (LiveIndex && *LiveIndex != Itm.UnitIndex)
 					{
-						if (It->GetFName() == Itm.OwnerName)
-						{
-							if (It->UnitIndex != Itm.UnitIndex)
-							{
-								bOwnerReused = true;
-							}
-							break;
-						}
+						bOwnerReused = true;
 					}
 				}
 
@@ -595,32 +599,34 @@ void AUnitRegistryReplicator::GetRegistrationCounts(int32& OutRegistered, int32&
 	}
 	
 	// Count live units and check if they're registered
-	for (TActorIterator<AUnitBase> It(World); It; ++It)
+	if (UUnitIndexSubsystem* UnitIndexSubsystem = World->GetSubsystem<UUnitIndexSubsystem>())
 	{
-		AUnitBase* Unit = *It;
-		if (!IsValid(Unit))
+		UnitIndexSubsystem->ForEachUnit([&](AUnitBase* Unit)
 		{
-			continue;
-		}
-		// Skip dead units - they don't need to be registered
-		if (Unit->UnitState == UnitData::Dead)
-		{
-			continue;
-		}
+			if (!IsValid(Unit))
+			{
+				return;
+			}
+			// Skip dead units - they don't need to be registered
+			if (Unit->UnitState == UnitData::Dead)
+			{
+				return;
+			}
 		
-		// Only count units that are supposed to have Mass (to avoid blocking on props/actors that don't register)
-		if (!Unit->FindComponentByClass<UMassActorBindingComponent>())
-		{
-			continue;
-		}
+			// Only count units that are supposed to have Mass (to avoid blocking on props/actors that don't register)
+			if (!Unit->FindComponentByClass<UMassActorBindingComponent>())
+			{
+				return;
+			}
 
-		OutTotal++;
+			OutTotal++;
 		
-		// Check if this unit is in the registry (by UnitIndex ONLY)
-		const bool bInRegistry = (Unit->UnitIndex != INDEX_NONE && RegIndices.Contains(Unit->UnitIndex));
-		if (bInRegistry)
-		{
-			OutRegistered++;
-		}
+			// Check if this unit is in the registry (by UnitIndex ONLY)
+			const bool bInRegistry = (Unit->UnitIndex != INDEX_NONE && RegIndices.Contains(Unit->UnitIndex));
+			if (bInRegistry)
+			{
+				OutRegistered++;
+			}
+		});
 	}
 }
\ No newline at end of file
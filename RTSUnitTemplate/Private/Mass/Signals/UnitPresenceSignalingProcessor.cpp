@@ -1,71 +0,0 @@
-// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
-#include "Mass/Signals/UnitPresenceSignalingProcessor.h"
-#include "MassSignalSubsystem.h"
-#include "MassCommonFragments.h"
-#include "MassExecutionContext.h"
-#include "Mass/Signals/MySignals.h" // Your signal definitions
-
-UUnitPresenceSignalingProcessor::UUnitPresenceSignalingProcessor()
-{
-    // Run early in the frame, before detection.
-    ProcessingPhase = EMassProcessingPhase::PrePhysics;
-    bAutoRegisterWithProcessingPhases = true;
-    ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
-}
-
-void UUnitPresenceSignalingProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
-{
-    EntityQuery.Initialize(EntityManager);
-    // Query for all entities that can be detected.
-    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
-    EntityQuery.AddRequirement<FMassCombatStatsFragment>(EMassFragmentAccess::ReadOnly);
-    EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly);
-    EntityQuery.AddRequirement<FMassAIStateFragment>(EMassFragmentAccess::ReadOnly);
-    EntityQuery.AddRequirement<FMassSightFragment>(EMassFragmentAccess::ReadOnly);
-    EntityQuery.AddTagRequirement<FMassStopUnitDetectionTag>(EMassFragmentPresence::None);
-    
-    EntityQuery.RegisterWithProcessor(*this);
-}
-
-void UUnitPresenceSignalingProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
-{
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
-    {
-        return; 
-    }
-    TimeSinceLastRun -= ExecutionInterval;
-
-    UWorld* World = GetWorld();
-
-    if (!World) return;
-    
-    if (!SignalSubsystem)
-    {
-        SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
-        if (!SignalSubsystem) return;
-    }
-
-    TArray<FMassEntityHandle> AllUnits;
-    AllUnits.Reserve(256); 
-
-    EntityQuery.ForEachEntityChunk(Context, 
-        [&AllUnits](FMassExecutionContext& ChunkContext)
-    {
-        const auto Entities = ChunkContext.GetEntities();
-        const auto StatsList = ChunkContext.GetFragmentView<FMassCombatStatsFragment>();
-
-        for (int32 i = 0; i < Entities.Num(); ++i)
-        {
-            if (StatsList[i].Health > 0.f)
-            {
-                AllUnits.Add(Entities[i]);
-            }
-        }
-    });
-
-    if (!AllUnits.IsEmpty())
-    {
-        SignalSubsystem->SignalEntities(UnitSignals::UnitInDetectionRange, AllUnits);
-    }
-}
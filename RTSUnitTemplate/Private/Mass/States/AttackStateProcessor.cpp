@@ -18,6 +18,7 @@
 #include "Characters/Unit/UnitBase.h"
 #include "Mass/Signals/MySignals.h"
 #include "Core/RTSUnitUtils.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
 #include "Async/Async.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
 
@@ -28,13 +29,15 @@ UAttackStateProcessor::UAttackStateProcessor(): EntityQuery()
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
-    bRequiresGameThreadExecution = true;
+    // Decision logic is fragment-only; actor and bubble writes go through GameThreadBatch.
+    bRequiresGameThreadExecution = false;
 }
 
 void UAttackStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
 {
     Super::InitializeInternal(Owner, EntityManager);
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
+    SpatialGrid = UWorld::GetSubsystem<UUnitSpatialGridSubsystem>(Owner.GetWorld());
 }
 
 
@@ -78,12 +81,10 @@ void UAttackStateProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager
 
 void UAttackStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     // Ensure the member SignalSubsystem is valid (initialized in Initialize)
     if (!SignalSubsystem) return;
 
@@ -106,6 +107,10 @@ void UAttackStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             const FMassCombatStatsFragment& Stats = StatsList[i];
@@ -125,6 +130,8 @@ void UAttackStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
             }
         }
     }); // End ForEachEntityChunk
+
+    GameThreadBatch.Flush(Context);
 }
 
 void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMassExecutionContext& Context, 
@@ -142,19 +149,9 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
 
     StateFrag.StateTimerClient += ExecutionInterval;
 
-    FUnitReplicationItem* Item = nullptr;
-    if (URTSWorldCacheSubsystem* CacheSubsystem = World->GetSubsystem<URTSWorldCacheSubsystem>())
-    {
-        if (AUnitClientBubbleInfo* Bubble = CacheSubsystem->GetBubble())
-        {
-            const auto NetIDList = Context.GetFragmentView<FMassNetworkIDFragment>();
-            Item = Bubble->Agents.FindItemByNetID(NetIDList[EntityIdx].NetID);
-            if (Item)
-            {
-                Item->PredictionTimer += ExecutionInterval;
-            }
-        }
-    }
+    // The bubble item lives on a replicated actor: its PredictionTimer is updated by the game-thread batch.
+    const FMassNetworkID NetID = Context.GetFragmentView<FMassNetworkIDFragment>()[EntityIdx].NetID;
+    GameThreadBatch.AddPredictionTime(NetID, ExecutionInterval);
 
     auto TransformList = Context.GetFragmentView<FTransformFragment>();
     const FTransform& Transform = TransformList[EntityIdx].GetTransform();
@@ -186,19 +183,16 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
     const FMassAgentCharacteristicsFragment* CharFragPtr = CharList.IsValidIndex(EntityIdx) ? &CharList[EntityIdx] : nullptr;
     const bool bIsFriendlyActive = EntityManager.IsEntityActive(TargetFrag.FriendlyTargetEntity);
 
-    if (bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, Entity, TargetFrag, CharFragPtr, Transform.GetLocation(), MoveTarget, EntityManager.GetWorld(), FollowAcceptanceMultiplier))
+    if (bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, TargetFrag, Transform.GetLocation(), MoveTarget, FollowAcceptanceMultiplier))
     {
         if (!StateFrag.SwitchingStateClient)
         {
             StateFrag.SwitchingStateClient = true;
             StateFrag.StateTimerClient = 0.f;
-            if (Item) Item->PredictionTimer = 0.f;
+            GameThreadBatch.ResetPredictionTimer(NetID);
 
             StateFrag.PlaceholderSignal = UnitSignals::Idle;
-            if (AUnitBase* UnitBase = Cast<AUnitBase>(Actor))
-            {
-                UnitBase->UnitStatePlaceholder = UnitData::Idle;
-            }
+            GameThreadBatch.SetPlaceholder(Actor, UnitData::Idle);
 
             auto& Defer = Context.Defer();
             Defer.RemoveTag<FMassStateAttackTag>(Entity);
@@ -207,8 +201,9 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
         return;
     }
 
-    FMassCombatStatsFragment* TgtStatsPtr = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(TargetFrag.TargetEntity) : nullptr;
-    const bool bIsTargetDead = TgtStatsPtr && TgtStatsPtr->Health <= 0.f;
+    const FUnitSpatialGridEntry* TargetRow = (bIsTargetActive && SpatialGrid) ? SpatialGrid->FindEntry(TargetFrag.TargetEntity) : nullptr;
+    float TargetHealth = 0.f;
+    const bool bIsTargetDead = bIsTargetActive && RTSUnitUtils::GetTargetHealth(EntityManager, TargetFrag.TargetEntity, TargetRow, TargetHealth) && TargetHealth <= 0.f;
 
     if (!bIsTargetActive || !TargetFrag.bHasValidTarget || bIsTargetDead)
     {
@@ -216,13 +211,10 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
         {
             StateFrag.SwitchingStateClient = true;
             StateFrag.StateTimerClient = 0.f;
-            if (Item) Item->PredictionTimer = 0.f;
+            GameThreadBatch.ResetPredictionTimer(NetID);
 
             StateFrag.PlaceholderSignal = UnitSignals::Idle;
-            if (AUnitBase* UnitBase = Cast<AUnitBase>(Actor))
-            {
-                UnitBase->UnitStatePlaceholder = UnitData::Idle;
-            }
+            GameThreadBatch.SetPlaceholder(Actor, UnitData::Idle);
 
             auto& Defer = Context.Defer();
             if (StateFrag.CanAttack && StateFrag.IsInitialized)
@@ -237,11 +229,8 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
 
     const float Dist = FVector::Dist2D(Transform.GetLocation(), TargetFrag.LastKnownLocation);
     const FMassAgentCharacteristicsFragment& CharFrag = *CharFragPtr;
-    FMassAgentCharacteristicsFragment* TargetCharFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity) : nullptr;
-    FTransformFragment* TargetTransformFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.TargetEntity) : nullptr;
-    const FTransform* TargetTransform = TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr;
 
-    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(CharFrag, Transform, TargetCharFrag, TargetTransform, TargetFrag.LastKnownLocation);
+    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(EntityManager, CharFrag, Transform, TargetFrag.TargetEntity, TargetRow, TargetFrag.LastKnownLocation);
     const float AttackRange = Stats.AttackRange + CombinedRadii;
 
     if (Dist <= AttackRange)
@@ -252,7 +241,7 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
             {
                 StateFrag.SwitchingStateClient = true;
                 StateFrag.StateTimerClient = 0.f;
-                if (Item) Item->PredictionTimer = 0.f;
+                GameThreadBatch.ResetPredictionTimer(NetID);
 
                 auto& Defer = Context.Defer();
                 if (PredictionList.Num() > 0)
@@ -274,7 +263,7 @@ void UAttackStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMa
     {
         StateFrag.SwitchingStateClient = true;
         StateFrag.StateTimerClient = 0.f;
-        if (Item) Item->PredictionTimer = 0.f;
+        GameThreadBatch.ResetPredictionTimer(NetID);
 
         auto& Defer = Context.Defer();
         if (PredictionList.Num() > 0)
@@ -329,15 +318,12 @@ void UAttackStateProcessor::ServerExecute(FMassEntityManager& EntityManager, FMa
     const FMassAgentCharacteristicsFragment* CharFragPtr = CharList.IsValidIndex(EntityIdx) ? &CharList[EntityIdx] : nullptr;
     const bool bIsFriendlyActive = EntityManager.IsEntityActive(TargetFrag.FriendlyTargetEntity);
 
-    if (bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, Entity, TargetFrag, CharFragPtr, Transform.GetLocation(), MoveTarget, EntityManager.GetWorld(), FollowAcceptanceMultiplier))
+    if (bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, TargetFrag, Transform.GetLocation(), MoveTarget, FollowAcceptanceMultiplier))
     {
         StateFrag.SwitchingState = true;
         StateFrag.PlaceholderSignal = UnitSignals::Idle;
 
-        if (AUnitBase* UnitBase = Cast<AUnitBase>(Actor))
-        {
-            UnitBase->UnitStatePlaceholder = UnitData::Idle;
-        }
+        GameThreadBatch.SetPlaceholder(Actor, UnitData::Idle);
 
         if (SignalSubsystem)
         {
@@ -346,18 +332,16 @@ void UAttackStateProcessor::ServerExecute(FMassEntityManager& EntityManager, FMa
         return;
     }
 
-    FMassCombatStatsFragment* TgtStatsPtr = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(TargetFrag.TargetEntity) : nullptr;
-    const bool bIsTargetDead = TgtStatsPtr && TgtStatsPtr->Health <= 0.f;
+    const FUnitSpatialGridEntry* TargetRow = (bIsTargetActive && SpatialGrid) ? SpatialGrid->FindEntry(TargetFrag.TargetEntity) : nullptr;
+    float TargetHealth = 0.f;
+    const bool bIsTargetDead = bIsTargetActive && RTSUnitUtils::GetTargetHealth(EntityManager, TargetFrag.TargetEntity, TargetRow, TargetHealth) && TargetHealth <= 0.f;
 
     if (!bIsTargetActive || !TargetFrag.bHasValidTarget || bIsTargetDead)
     {
         StateFrag.SwitchingState = true;
         StateFrag.PlaceholderSignal = UnitSignals::Idle;
 
-        if (AUnitBase* UnitBase = Cast<AUnitBase>(Actor))
-        {
-            UnitBase->UnitStatePlaceholder = UnitData::Idle;
-        }
+        GameThreadBatch.SetPlaceholder(Actor, UnitData::Idle);
 
         if (SignalSubsystem)
         {
@@ -368,11 +352,8 @@ void UAttackStateProcessor::ServerExecute(FMassEntityManager& EntityManager, FMa
 
     const float Dist = FVector::Dist2D(Transform.GetLocation(), TargetFrag.LastKnownLocation);
     const FMassAgentCharacteristicsFragment& CharFrag = *CharFragPtr;
-    FMassAgentCharacteristicsFragment* TargetCharFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity) : nullptr;
-    FTransformFragment* TargetTransformFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.TargetEntity) : nullptr;
-    const FTransform* TargetTransform = TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr;
 
-    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(CharFrag, Transform, TargetCharFrag, TargetTransform, TargetFrag.LastKnownLocation);
+    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(EntityManager, CharFrag, Transform, TargetFrag.TargetEntity, TargetRow, TargetFrag.LastKnownLocation);
     const float AttackRange = Stats.AttackRange + CombinedRadii;
 
     if (Dist <= AttackRange)
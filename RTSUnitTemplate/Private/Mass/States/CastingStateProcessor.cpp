@@ -75,12 +75,10 @@ void UCastingStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExe
 {
     // QUICK_SCOPE_CYCLE_COUNTER(STAT_UCastingStateProcessor_Execute);
 
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     UWorld* World = Context.GetWorld();
     if (!World)
@@ -116,6 +114,10 @@ void UCastingStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FM
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassCombatStatsFragment& StatsFrag = StatsList[i];
             FMassAITargetFragment& TargetFrag = TargetList[i];
@@ -259,6 +261,10 @@ void UCastingStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FM
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassCombatStatsFragment& StatsFrag = StatsList[i];
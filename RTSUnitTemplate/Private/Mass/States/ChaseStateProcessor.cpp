@@ -14,6 +14,7 @@
 #include "MassSignalSubsystem.h"
 #include "Characters/Unit/UnitBase.h"
 #include "Core/RTSUnitUtils.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
 
 #include "Mass/UnitMassTag.h"
 #include "Mass/Signals/MySignals.h"
@@ -30,7 +31,8 @@ UChaseStateProcessor::UChaseStateProcessor(): EntityQuery()
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
-    bRequiresGameThreadExecution = true;
+    // Decision logic is fragment-only; actor and bubble writes go through GameThreadBatch.
+    bRequiresGameThreadExecution = false;
 }
 
 void UChaseStateProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
@@ -73,6 +75,7 @@ void UChaseStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<F
 {
     Super::InitializeInternal(Owner, EntityManager);
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
+    SpatialGrid = UWorld::GetSubsystem<UUnitSpatialGridSubsystem>(Owner.GetWorld());
 }
 
 
@@ -105,12 +108,10 @@ FVector CalculateChaseOffset(const FMassEntityHandle& Entity, float MinRadius =
 
 void UChaseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -120,6 +121,8 @@ void UChaseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
     {
         ExecuteServer(EntityManager, Context);
     }
+
+    GameThreadBatch.Flush(Context);
 }
 
 void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
@@ -143,6 +146,10 @@ void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             const FMassCombatStatsFragment& Stats = StatsList[i];
@@ -217,11 +224,9 @@ void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
             {
                 const float DistSq = FVector::DistSquared2D(Transform.GetLocation(), TargetFrag.LastKnownLocation);
 
-                const FMassAgentCharacteristicsFragment* TargetCharFrag = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity);
-                const FTransformFragment* TargetTransformFrag = EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.TargetEntity);
-                const FTransform* TargetTransform = TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr;
+                const FUnitSpatialGridEntry* TargetRow = SpatialGrid ? SpatialGrid->FindEntry(TargetFrag.TargetEntity) : nullptr;
 
-                const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(CharFrag, Transform, TargetCharFrag, TargetTransform, TargetFrag.LastKnownLocation);
+                const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(EntityManager, CharFrag, Transform, TargetFrag.TargetEntity, TargetRow, TargetFrag.LastKnownLocation);
                 
                 const float Tolerance = 10.f; // Client-Side Prediction Bias
                 const float EffectiveAttackRange = Stats.AttackRange + CombinedRadii;
@@ -239,20 +244,7 @@ void UChaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
                         Defer.RemoveTag<FMassStateChaseTag>(Entity);
                         Defer.AddTag<FMassStatePauseTag>(Entity);
 
-                        if (World)
-                        {
-                            if (URTSWorldCacheSubsystem* Cache = World->GetSubsystem<URTSWorldCacheSubsystem>())
-                            {
-                                if (AUnitClientBubbleInfo* Bubble = Cache->GetBubble(false))
-                                {
-                                    if (FUnitReplicationItem* Item = Bubble->Agents.FindItemByNetID(NetIDList[i].NetID))
-                                    {
-                                        Item->PredictionTimer = 0.f;
-                                        Item->bPredictedLatch = false;
-                                    }
-                                }
-                            }
-                        }
+                        GameThreadBatch.ResetPredictionTimer(NetIDList[i].NetID, true);
                     }
                 }
                 else
@@ -300,6 +292,10 @@ void UChaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
             
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i]; // Keep reference if State needs updates
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             const FTransform& Transform = TransformList[i].GetTransform();
@@ -381,11 +377,9 @@ void UChaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
     
             const float DistSq = FVector::DistSquared2D(Transform.GetLocation(), TargetFrag.LastKnownLocation);
 
-            const FMassAgentCharacteristicsFragment* TargetCharFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity) : nullptr;
-            const FTransformFragment* TargetTransformFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.TargetEntity) : nullptr;
-            const FTransform* TargetTransform = TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr;
+            const FUnitSpatialGridEntry* TargetRow = SpatialGrid ? SpatialGrid->FindEntry(TargetFrag.TargetEntity) : nullptr;
 
-            const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(CharFrag, Transform, TargetCharFrag, TargetTransform, TargetFrag.LastKnownLocation);
+            const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(EntityManager, CharFrag, Transform, TargetFrag.TargetEntity, TargetRow, TargetFrag.LastKnownLocation);
             const float EffectiveAttackRange = Stats.AttackRange + CombinedRadii;
             const float AttackRangeSq = FMath::Square(EffectiveAttackRange);
 
@@ -407,10 +401,16 @@ void UChaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
             
            FVector TargetLocation = TargetFrag.LastKnownLocation;
 
-           const FMassAgentCharacteristicsFragment* TargetCharFragPtr = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity) : nullptr;
-           if (TargetCharFragPtr  && !Stats.bCanMoveWhileAttacking) //  && !Stats.bCanMoveWhileAttacking
+           if (TargetRow && !Stats.bCanMoveWhileAttacking)
+           {
+               TargetLocation.Z = TargetRow->GroundZ;
+           }
+           else if (!TargetRow && bIsTargetActive && !Stats.bCanMoveWhileAttacking)
            {
-               TargetLocation.Z = TargetCharFragPtr->LastGroundLocation;
+               if (const FMassAgentCharacteristicsFragment* TargetCharFragPtr = EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity))
+               {
+                   TargetLocation.Z = TargetCharFragPtr->LastGroundLocation;
+               }
            }
 
            if (bHasMoveTarget)
@@ -481,14 +481,11 @@ void UChaseStateProcessor::SwitchToPlaceholderState(FMassEntityManager& EntityMa
             Defer.AddTag<FMassStateIdleTag>(Entity);
         }
         
-        // Lokale Actor-Synchronisation (UnitStatePlaceholder)
-        if (AUnitBase* UnitBase = Cast<AUnitBase>(UnitActor))
-        {
-            if (StateFrag.PlaceholderSignal == UnitSignals::PatrolRandom) UnitBase->UnitStatePlaceholder = UnitData::Patrol;
-            else if (StateFrag.PlaceholderSignal == UnitSignals::PatrolIdle) UnitBase->UnitStatePlaceholder = UnitData::PatrolIdle;
-            else if (StateFrag.PlaceholderSignal == UnitSignals::Run) UnitBase->UnitStatePlaceholder = UnitData::Run;
-            else UnitBase->UnitStatePlaceholder = UnitData::Idle;
-        }
+        // Lokale Actor-Synchronisation (UnitStatePlaceholder), applied on the game thread
+        if (StateFrag.PlaceholderSignal == UnitSignals::PatrolRandom) GameThreadBatch.SetPlaceholder(UnitActor, UnitData::Patrol);
+        else if (StateFrag.PlaceholderSignal == UnitSignals::PatrolIdle) GameThreadBatch.SetPlaceholder(UnitActor, UnitData::PatrolIdle);
+        else if (StateFrag.PlaceholderSignal == UnitSignals::Run) GameThreadBatch.SetPlaceholder(UnitActor, UnitData::Run);
+        else GameThreadBatch.SetPlaceholder(UnitActor, UnitData::Idle);
     }
     else
     {
@@ -266,12 +266,10 @@ void UDeathStateProcessor::HandleSwitchToRuin(FName SignalName, TArray<FMassEnti
 
 void UDeathStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -296,6 +294,10 @@ void UDeathStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMas
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             const FMassAgentCharacteristicsFragment CharacteristicsFragment = AgentFragList[i];
@@ -351,6 +353,10 @@ void UDeathStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMas
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassVelocityFragment& Velocity = VelocityList[i];
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
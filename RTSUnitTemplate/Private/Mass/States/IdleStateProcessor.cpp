@@ -73,12 +73,10 @@ void UIdleStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FM
 
 void UIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     const bool bIsClient = Context.GetWorld() && Context.GetWorld()->IsNetMode(NM_Client);
     
@@ -112,6 +110,10 @@ void UIdleStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMass
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassAITargetFragment& TargetFrag = TargetList[i];
@@ -271,6 +273,10 @@ void UIdleStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMass
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassAITargetFragment& TargetFrag = TargetList[i];
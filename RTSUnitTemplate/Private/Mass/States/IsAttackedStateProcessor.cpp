@@ -40,12 +40,10 @@ void UIsAttackedStateProcessor::InitializeInternal(UObject& Owner, const TShared
 
 void UIsAttackedStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     UWorld* World = GetWorld();
     if (!World) return;
@@ -63,6 +61,10 @@ void UIsAttackedStateProcessor::Execute(FMassEntityManager& EntityManager, FMass
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i]; // Mutable for timer
             const FMassCombatStatsFragment& StatsFrag = StatsList[i];
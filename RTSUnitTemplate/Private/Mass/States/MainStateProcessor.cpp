@@ -43,14 +43,10 @@ void UMainStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FM
 void UMainStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
     // --- Throttling Check ---
-    TimeSinceLastRunA += Context.GetDeltaTimeSeconds();
-
-    if (TimeSinceLastRunA < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; // Skip execution this frame
+        return;
     }
-    // Interval reached, reset timer
-    TimeSinceLastRunA -= ExecutionInterval; // Or TimeSinceLastRun = 0.0f;
 
     // Branch by net mode
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
@@ -82,6 +78,10 @@ void UMainStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMass
         
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i]; // Mutable ref needed
             FMassCombatStatsFragment& StatsFrag = StatsList[i];
@@ -154,6 +154,10 @@ void UMainStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMass
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassCombatStatsFragment& StatsFrag = StatsList[i];
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
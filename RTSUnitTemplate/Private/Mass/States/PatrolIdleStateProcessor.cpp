@@ -53,12 +53,10 @@ void UPatrolIdleStateProcessor::InitializeInternal(UObject& Owner, const TShared
 void UPatrolIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
     // --- Throttling Check ---
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     UWorld* World = EntityManager.GetWorld();
     if (!World) return;
@@ -80,6 +78,10 @@ void UPatrolIdleStateProcessor::Execute(FMassEntityManager& EntityManager, FMass
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i]; // Mutable for timer update
             const FMassAITargetFragment& TargetFrag = TargetList[i];
             FMassPatrolFragment& PatrolFrag = PatrolList[i]; // Keep reference if needed
@@ -60,14 +60,11 @@ void UPatrolRandomStateProcessor::InitializeInternal(UObject& Owner, const TShar
 void UPatrolRandomStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
     // --- Throttling Check ---
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
        return;
     }
 
-    TimeSinceLastRun -= ExecutionInterval;
-
 
     UWorld* World = Context.GetWorld();
     if (!World) return;
@@ -87,6 +84,10 @@ void UPatrolRandomStateProcessor::Execute(FMassEntityManager& EntityManager, FMa
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i]; // Mutable for timer reset
             
@@ -13,6 +13,7 @@
 #include "Characters/Unit/UnitBase.h"
 #include "Mass/Signals/MySignals.h"
 #include "Core/RTSUnitUtils.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
 #include "Async/Async.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
 #include "Mass/Projectile/ProjectileVisualManager.h"
@@ -30,7 +31,8 @@ UPauseStateProcessor::UPauseStateProcessor(): EntityQuery()
     ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Behavior;
     ProcessingPhase = EMassProcessingPhase::PostPhysics;
     bAutoRegisterWithProcessingPhases = true;
-    bRequiresGameThreadExecution = true;
+    // Decision logic is fragment-only; actor writes go through GameThreadBatch.
+    bRequiresGameThreadExecution = false;
 }
 
 void UPauseStateProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
@@ -75,6 +77,7 @@ void UPauseStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<F
 {
     Super::InitializeInternal(Owner, EntityManager);
     SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
+    SpatialGrid = UWorld::GetSubsystem<UUnitSpatialGridSubsystem>(Owner.GetWorld());
     EntitySubsystem = UWorld::GetSubsystem<UMassEntitySubsystem>(Owner.GetWorld());
 
     if (SignalSubsystem)
@@ -87,12 +90,10 @@ void UPauseStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<F
 
 void UPauseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     UWorld* World = EntityManager.GetWorld();
     if (!World || !SignalSubsystem) return;
@@ -114,6 +115,10 @@ void UPauseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             if (bIsClient)
             {
                 ClientExecute(EntityManager, ChunkContext, StateList[i], TargetList[i], StatsList[i], ChunkContext.GetEntity(i), i, ActorList[i].GetMutable());
@@ -124,6 +129,8 @@ void UPauseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
             }
         }
     });
+
+    GameThreadBatch.Flush(Context);
 }
 
 void UPauseStateProcessor::ServerExecute(FMassEntityManager& EntityManager, FMassExecutionContext& Context, 
@@ -148,23 +155,21 @@ void UPauseStateProcessor::ServerExecute(FMassEntityManager& EntityManager, FMas
     const auto CharList = Context.GetFragmentView<FMassAgentCharacteristicsFragment>();
     const FMassAgentCharacteristicsFragment* CharFragPtr = CharList.IsValidIndex(EntityIdx) ? &CharList[EntityIdx] : nullptr;
 
-    FMassCombatStatsFragment* TgtStatsPtr = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(MutableTargetFrag.TargetEntity) : nullptr;
-    const bool bIsTargetDead = TgtStatsPtr && TgtStatsPtr->Health <= 0.f;
+    const FUnitSpatialGridEntry* TargetRow = (bIsTargetActive && SpatialGrid) ? SpatialGrid->FindEntry(MutableTargetFrag.TargetEntity) : nullptr;
+    float TargetHealth = 0.f;
+    const bool bIsTargetDead = bIsTargetActive && RTSUnitUtils::GetTargetHealth(EntityManager, MutableTargetFrag.TargetEntity, TargetRow, TargetHealth) && TargetHealth <= 0.f;
 
     auto MoveTargetList = Context.GetMutableFragmentView<FMassMoveTargetFragment>();
     FMassMoveTargetFragment& MoveTarget = MoveTargetList[EntityIdx];
     
-    if ((bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, Entity, MutableTargetFrag, CharFragPtr, Transform.GetLocation(), MoveTarget, World, FollowAcceptanceMultiplier)) || !bIsTargetActive || !MutableTargetFrag.bHasValidTarget || bIsTargetDead)
+    if ((bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, MutableTargetFrag, Transform.GetLocation(), MoveTarget, FollowAcceptanceMultiplier)) || !bIsTargetActive || !MutableTargetFrag.bHasValidTarget || bIsTargetDead)
     {
         if (!StateFrag.SwitchingState)
         {
             StateFrag.SwitchingState = true;
             
             StateFrag.PlaceholderSignal = UnitSignals::Idle;
-            if (AUnitBase* UnitBase = Cast<AUnitBase>(Actor))
-            {
-                UnitBase->UnitStatePlaceholder = UnitData::Idle;
-            }
+            GameThreadBatch.SetPlaceholder(Actor, UnitData::Idle);
 
             auto& Defer = Context.Defer();
             if (StateFrag.CanAttack && StateFrag.IsInitialized)
@@ -182,14 +187,11 @@ void UPauseStateProcessor::ServerExecute(FMassEntityManager& EntityManager, FMas
 
     StateFrag.StateTimer += ExecutionInterval;
 
-    FMassAgentCharacteristicsFragment* TargetCharFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(MutableTargetFrag.TargetEntity) : nullptr;
     const FMassAgentCharacteristicsFragment& CharFrag = *CharFragPtr;
-    FTransformFragment* TargetTransformFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FTransformFragment>(MutableTargetFrag.TargetEntity) : nullptr;
-    const FTransform* TargetTransform = TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr;
 
     const float Dist = FVector::Dist2D(Transform.GetLocation(), MutableTargetFrag.LastKnownLocation);
     
-    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(CharFrag, Transform, TargetCharFrag, TargetTransform, MutableTargetFrag.LastKnownLocation);
+    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(EntityManager, CharFrag, Transform, MutableTargetFrag.TargetEntity, TargetRow, MutableTargetFrag.LastKnownLocation);
     const float AttackRange = Stats.AttackRange + CombinedRadii;
 
     if (Dist <= AttackRange)
@@ -264,7 +266,7 @@ void UPauseStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMas
     auto MoveTargetList = Context.GetMutableFragmentView<FMassMoveTargetFragment>();
     FMassMoveTargetFragment& MoveTarget = MoveTargetList[EntityIdx];
 
-    if (bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, Entity, TargetFrag, &CharFrag, Transform.GetLocation(), MoveTarget, EntityManager.GetWorld(), FollowAcceptanceMultiplier))
+    if (bIsFriendlyActive && !RTSUnitUtils::IsWithinFollowThreshold(EntityManager, TargetFrag, Transform.GetLocation(), MoveTarget, FollowAcceptanceMultiplier))
     {
         if (!StateFrag.SwitchingStateClient)
         {
@@ -273,10 +275,7 @@ void UPauseStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMas
             auto& Defer = Context.Defer();
 
             StateFrag.PlaceholderSignal = UnitSignals::Idle;
-            if (AUnitBase* UnitBase = Cast<AUnitBase>(Actor))
-            {
-                UnitBase->UnitStatePlaceholder = UnitData::Idle;
-            }
+            GameThreadBatch.SetPlaceholder(Actor, UnitData::Idle);
 
             if (StateFrag.CanAttack && StateFrag.IsInitialized)
             {
@@ -288,13 +287,11 @@ void UPauseStateProcessor::ClientExecute(FMassEntityManager& EntityManager, FMas
         return;
     }
 
-    FMassAgentCharacteristicsFragment* TargetCharFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetFrag.TargetEntity) : nullptr;
-    FTransformFragment* TargetTransformFrag = bIsTargetActive ? EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.TargetEntity) : nullptr;
-    const FTransform* TargetTransform = TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr;
+    const FUnitSpatialGridEntry* TargetRow = SpatialGrid ? SpatialGrid->FindEntry(TargetFrag.TargetEntity) : nullptr;
 
     const float Dist = FVector::Dist2D(Transform.GetLocation(), TargetFrag.LastKnownLocation);
     
-    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(CharFrag, Transform, TargetCharFrag, TargetTransform, TargetFrag.LastKnownLocation);
+    const float CombinedRadii = RTSUnitUtils::GetCombinedRadii(EntityManager, CharFrag, Transform, TargetFrag.TargetEntity, TargetRow, TargetFrag.LastKnownLocation);
     const float AttackRange = Stats.AttackRange + CombinedRadii;
 
     if (bIsTargetActive)
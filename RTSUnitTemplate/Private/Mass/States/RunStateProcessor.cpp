@@ -64,12 +64,10 @@ void URunStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMa
 
 void URunStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
- TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -107,6 +105,10 @@ void URunStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, FMassE
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
@@ -257,6 +259,10 @@ void URunStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, FMassE
             
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             if (!DoesEntityHaveTag(EntityManager, Entity, FMassStateRunTag::StaticStruct()))
             {
@@ -0,0 +1,84 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/States/StateGameThreadBatch.h"
+
+#include "MassExecutionContext.h"
+#include "MassCommandBuffer.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Mass/Replication/RTSWorldCacheSubsystem.h"
+#include "Mass/Replication/UnitReplicationPayload.h"
+
+void FMassStateGameThreadBatch::SetPlaceholder(AActor* Actor, UnitData::EState State)
+{
+	// Cast only reads the class, which is fixed for the actor's lifetime.
+	if (AUnitBase* Unit = Cast<AUnitBase>(Actor))
+	{
+		Placeholders.Add({ Unit, State });
+	}
+}
+
+void FMassStateGameThreadBatch::AddPredictionTime(const FMassNetworkID& NetID, float Seconds)
+{
+	FPredictionTimerOp& Op = PredictionOps.AddDefaulted_GetRef();
+	Op.NetID = NetID;
+	Op.AddSeconds = Seconds;
+}
+
+void FMassStateGameThreadBatch::ResetPredictionTimer(const FMassNetworkID& NetID, bool bClearPredictedLatch)
+{
+	FPredictionTimerOp& Op = PredictionOps.AddDefaulted_GetRef();
+	Op.NetID = NetID;
+	Op.bReset = true;
+	Op.bClearPredictedLatch = bClearPredictedLatch;
+}
+
+void FMassStateGameThreadBatch::Flush(FMassExecutionContext& Context)
+{
+	if (IsEmpty())
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UWorld> WeakWorld = Context.GetWorld();
+	Context.Defer().PushCommand<FMassDeferredSetCommand>(
+		[WeakWorld, Placeholders = MoveTemp(Placeholders), PredictionOps = MoveTemp(PredictionOps)](FMassEntityManager&)
+	{
+		for (const FPlaceholderWrite& Write : Placeholders)
+		{
+			if (AUnitBase* Unit = Write.Unit.Get())
+			{
+				Unit->UnitStatePlaceholder = Write.State;
+			}
+		}
+
+		UWorld* World = WeakWorld.Get();
+		URTSWorldCacheSubsystem* Cache = World ? World->GetSubsystem<URTSWorldCacheSubsystem>() : nullptr;
+		if (!Cache || PredictionOps.IsEmpty())
+		{
+			return;
+		}
+
+		for (const FPredictionTimerOp& Op : PredictionOps)
+		{
+			FUnitReplicationItem* Item = Cache->FindReplicatedItem(Op.NetID);
+			if (!Item)
+			{
+				continue;
+			}
+			if (Op.bReset)
+			{
+				Item->PredictionTimer = 0.f;
+				if (Op.bClearPredictedLatch)
+				{
+					Item->bPredictedLatch = false;
+				}
+			}
+			else
+			{
+				Item->PredictionTimer += Op.AddSeconds;
+			}
+		}
+	});
+
+	Placeholders.Reset();
+	PredictionOps.Reset();
+}
@@ -83,12 +83,10 @@ void UBuildStateProcessor::BeginDestroy()
 
 void UBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
     
     const UWorld* World = EntityManager.GetWorld();
 
@@ -107,6 +105,10 @@ void UBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecu
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             if (bIsClient)
             {
                 ClientExecute(EntityManager, ChunkContext, AIStateList[i], WorkerStatsList[i], ChunkContext.GetEntity(i), i);
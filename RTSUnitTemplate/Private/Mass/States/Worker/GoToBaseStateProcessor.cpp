@@ -70,12 +70,10 @@ void UGoToBaseStateProcessor::InitializeInternal(UObject& Owner, const TSharedRe
 
 void UGoToBaseStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -114,6 +112,10 @@ void UGoToBaseStateProcessor::ExecuteServer(FMassEntityManager& EntityManager, F
         const int32 NumEntities = ChunkContext.GetNumEntities();
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             const FTransform& CurrentTransform = TransformList[i].GetTransform();
             const FMassWorkerStatsFragment& WorkerStats = WorkerStatsList[i];
@@ -210,6 +212,10 @@ void UGoToBaseStateProcessor::ExecuteClient(FMassEntityManager& EntityManager, F
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FVector CurrentLocation = TransformList[i].GetTransform().GetLocation();
             const FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
 
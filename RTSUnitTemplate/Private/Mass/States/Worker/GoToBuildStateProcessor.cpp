@@ -68,12 +68,10 @@ void UGoToBuildStateProcessor::InitializeInternal(UObject& Owner, const TSharedR
 
 void UGoToBuildStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -104,6 +102,10 @@ void UGoToBuildStateProcessor::ExecuteClient(FMassEntityManager& EntityManager,
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FVector CurrentLocation = TransformList[i].GetTransform().GetLocation();
             const FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
 
@@ -147,6 +149,10 @@ void UGoToBuildStateProcessor::ExecuteServer(FMassEntityManager& EntityManager,
             
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(Context.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = Context.GetEntity(i);
             const FTransform& CurrentTransform = TransformList[i].GetTransform();
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
@@ -64,12 +64,10 @@ void UGoToRepairStateProcessor::InitializeInternal(UObject& Owner, const TShared
 
 void UGoToRepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -99,6 +97,10 @@ void UGoToRepairStateProcessor::ExecuteClient(FMassEntityManager& EntityManager,
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FVector CurrentLocation = TransformList[i].GetTransform().GetLocation();
             const FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
             PredictWorkerStop(PredList[i], CurrentLocation, MoveTarget.Center, MoveTarget.DesiredSpeed.Get(), 0.f);
@@ -129,6 +131,10 @@ void UGoToRepairStateProcessor::ExecuteServer(FMassEntityManager& EntityManager,
         const auto CharList = ChunkContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             FMassAIStateFragment& StateFrag = StateList[i];
             FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
             const FMassCombatStatsFragment& StatsFrag = StatsList[i];
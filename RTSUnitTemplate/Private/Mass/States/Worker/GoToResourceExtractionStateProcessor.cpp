@@ -75,12 +75,10 @@ void UGoToResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityMa
     //QUICK_SCOPE_CYCLE_COUNTER(STAT_UGoToResourceExtractionStateProcessor_Execute);
     //TRACE_CPUPROFILER_EVENT_SCOPE(UGoToResourceExtractionStateProcessor_Execute);
     
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (GetWorld() && GetWorld()->IsNetMode(NM_Client))
     {
@@ -113,6 +111,10 @@ void UGoToResourceExtractionStateProcessor::ExecuteClient(FMassEntityManager& En
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FVector CurrentLocation = TransformList[i].GetTransform().GetLocation();
             const FMassMoveTargetFragment& MoveTarget = MoveTargetList[i];
 
@@ -155,6 +157,10 @@ void UGoToResourceExtractionStateProcessor::ExecuteServer(FMassEntityManager& En
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
 
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& AIState = AIStateList[i];
@@ -54,12 +54,10 @@ void URepairStateProcessor::InitializeInternal(UObject& Owner, const TSharedRef<
 
 void URepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
         return;
     }
-    TimeSinceLastRun -= ExecutionInterval;
 
     if (!SignalSubsystem)
     {
@@ -81,6 +79,10 @@ void URepairStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             if (bIsClient)
             {
                 ClientExecute(EntityManager, ChunkContext, StateList[i], TargetList[i], StatsList[i], ChunkContext.GetEntity(i), i);
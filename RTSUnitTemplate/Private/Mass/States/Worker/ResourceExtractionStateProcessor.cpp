@@ -84,10 +84,9 @@ void UResourceExtractionStateProcessor::InitializeInternal(UObject& Owner, const
 
 void UResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-    TimeSinceLastRun += Context.GetDeltaTimeSeconds();
-    if (TimeSinceLastRun < ExecutionInterval)
+    if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval))
     {
-        return; 
+        return;
     }
     
     if (!SignalSubsystem) return;
@@ -103,8 +102,6 @@ void UResourceExtractionStateProcessor::Execute(FMassEntityManager& EntityManage
     {
         ServerExecute(Context);
     }
-
-    TimeSinceLastRun -= ExecutionInterval;
 }
 
 void UResourceExtractionStateProcessor::ServerExecute(FMassExecutionContext& Context)
@@ -120,6 +117,10 @@ void UResourceExtractionStateProcessor::ServerExecute(FMassExecutionContext& Con
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
             FMassAIStateFragment& StateFrag = StateList[i];
             const FMassWorkerStatsFragment& WorkerStatsFrag = WorkerStatsList[i];
@@ -195,6 +196,10 @@ void UResourceExtractionStateProcessor::ClientExecute(FMassExecutionContext& Con
 
         for (int32 i = 0; i < NumEntities; ++i)
         {
+            if (!TimeSlice.IsDue(ChunkContext.GetEntity(i)))
+            {
+                continue;
+            }
             const FMassVisibilityFragment& Vis = VisibilityList[i];
 
             if (Vis.bIsOnViewport)
@@ -0,0 +1,125 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitPickingProcessor.h"
+#include "Mass/UnitPickingSubsystem.h"
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+#include "MassActorSubsystem.h"
+#include "Mass/UnitMassTag.h"
+#include "Mass/MassUnitVisualFragments.h"
+#include "HAL/IConsoleManager.h"
+
+// Cell edge length of the picking grid. A few unit diameters, so a ray or click touches only a handful of cells.
+static TAutoConsoleVariable<float> CVarRTS_PickingCellSize(
+	TEXT("RTS.Picking.CellSize"),
+	500.f,
+	TEXT("Cell size (cm) of the grid used for hover, click and marquee picking."),
+	ECVF_Default);
+
+UUnitPickingProcessor::UUnitPickingProcessor()
+{
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bAutoRegisterWithProcessingPhases = true;
+	// Effect areas are picked at their actor location.
+	bRequiresGameThreadExecution = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ExecutionOrder.ExecuteBefore.Add(TEXT("MassUnitHoverProcessor"));
+	ExecutionOrder.ExecuteBefore.Add(TEXT("MassEffectAreaHoverProcessor"));
+}
+
+void UUnitPickingProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	Super::InitializeInternal(Owner, EntityManager);
+	if (UWorld* World = Owner.GetWorld())
+	{
+		// Null on dedicated servers.
+		PickingSubsystem = World->GetSubsystem<UUnitPickingSubsystem>();
+	}
+}
+
+void UUnitPickingProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	// Everything the hover processors consider: units, buildings and effect areas.
+	EntityQuery.Initialize(EntityManager);
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassHoverFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FEffectAreaImpactFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassUnitVisualFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddTagRequirement<FUnitMassTag>(EMassFragmentPresence::Any);
+	EntityQuery.AddTagRequirement<FMassIsEffectAreaTag>(EMassFragmentPresence::Any);
+	EntityQuery.RegisterWithProcessor(*this);
+}
+
+void UUnitPickingProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (!PickingSubsystem)
+	{
+		return;
+	}
+
+	PickingSubsystem->BeginRebuild(CVarRTS_PickingCellSize.GetValueOnGameThread(), EntityQuery.GetNumMatchingEntities());
+
+	EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& ChunkCtx)
+	{
+		const int32 N = ChunkCtx.GetNumEntities();
+		const auto Transforms = ChunkCtx.GetFragmentView<FTransformFragment>();
+		const auto CharList = ChunkCtx.GetFragmentView<FMassAgentCharacteristicsFragment>();
+		const auto ActorList = ChunkCtx.GetFragmentView<FMassActorFragment>();
+		const auto ImpactList = ChunkCtx.GetFragmentView<FEffectAreaImpactFragment>();
+		const auto VisualList = ChunkCtx.GetFragmentView<FMassUnitVisualFragment>();
+		const bool bIsEffectAreaChunk = ChunkCtx.DoesArchetypeHaveTag<FMassIsEffectAreaTag>() && ImpactList.Num() > 0;
+
+		FUnitPickEntry Entry;
+		for (int32 i = 0; i < N; ++i)
+		{
+			const FMassAgentCharacteristicsFragment& Char = CharList[i];
+			Entry.Entity = ChunkCtx.GetEntity(i);
+			Entry.Base = Transforms[i].GetTransform().GetLocation();
+			Entry.VisualRadius = 0.f;
+			Entry.VisualMinZ = MAX_flt;
+			Entry.VisualMaxZ = -MAX_flt;
+
+			if (bIsEffectAreaChunk)
+			{
+				// Same location and radius UMassEffectAreaHoverProcessor tests against.
+				if (ActorList.Num() > 0)
+				{
+					if (const AActor* Actor = ActorList[i].Get())
+					{
+						Entry.Base = Actor->GetActorLocation();
+					}
+				}
+				Entry.Kind = EUnitPickKind::EffectArea;
+				Entry.Radius = ImpactList[i].CurrentRadius > 0.f ? ImpactList[i].CurrentRadius : (Char.CapsuleRadius > 0.f ? Char.CapsuleRadius : 100.f);
+				// Areas are flat discs; a band around them keeps the ray clip meaningful.
+				Entry.Base.Z -= Entry.Radius;
+				Entry.Height = 2.f * Entry.Radius;
+			}
+			else
+			{
+				// Same cylinder UMassUnitHoverProcessor tests against.
+				const float HalfHeight = Char.bUseBoxComponent ? Char.BoxExtent.Z : Char.CapsuleHeight;
+				Entry.Kind = EUnitPickKind::Unit;
+				Entry.Base.Z = Char.LastGroundLocation + (Char.bIsFlying ? Char.FlyHeight - HalfHeight : 0.f);
+				Entry.Height = 2.f * HalfHeight;
+				Entry.Radius = Char.bUseBoxComponent ? FVector2D(Char.BoxExtent).Size() : Char.CapsuleRadius;
+
+				// The marquee projects the rendered instances, placed like UMassUnitPlacementProcessor does.
+				if (VisualList.Num() > 0)
+				{
+					for (const FMassUnitVisualInstance& Instance : VisualList[i].VisualInstances)
+					{
+						const FVector InstanceLocation = Char.PositionedTransform.TransformPosition(Instance.CurrentRelativeTransform.GetLocation());
+						Entry.VisualRadius = FMath::Max(Entry.VisualRadius, FVector::Dist2D(Entry.Base, InstanceLocation));
+						Entry.VisualMinZ = FMath::Min(Entry.VisualMinZ, InstanceLocation.Z);
+						Entry.VisualMaxZ = FMath::Max(Entry.VisualMaxZ, InstanceLocation.Z);
+					}
+				}
+			}
+			PickingSubsystem->AddEntry(Entry);
+		}
+	});
+
+	PickingSubsystem->FinishRebuild();
+}
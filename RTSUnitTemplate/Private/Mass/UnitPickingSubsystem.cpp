@@ -0,0 +1,195 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitPickingSubsystem.h"
+#include "GameFramework/PlayerController.h"
+
+bool UUnitPickingSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+void UUnitPickingSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	Grid = FUnitCellGrid2D();
+	LastBuildFrame = MAX_uint64;
+	Super::Deinitialize();
+}
+
+void UUnitPickingSubsystem::BeginRebuild(float InCellSize, int32 ExpectedNum)
+{
+	MaxRadius = 0.f;
+	MinZ = MAX_flt;
+	MaxZ = -MAX_flt;
+	Entries.Reset(ExpectedNum);
+	Grid.Reset(InCellSize, ExpectedNum);
+}
+
+void UUnitPickingSubsystem::AddEntry(const FUnitPickEntry& Entry)
+{
+	Entries.Add(Entry);
+	Grid.AddItem(Entry.Base);
+	MaxRadius = FMath::Max3(MaxRadius, Entry.Radius, Entry.VisualRadius);
+	MinZ = FMath::Min3(MinZ, Entry.Base.Z, Entry.VisualMinZ);
+	MaxZ = FMath::Max3(MaxZ, Entry.Base.Z + Entry.Height, Entry.VisualMaxZ);
+}
+
+void UUnitPickingSubsystem::FinishRebuild()
+{
+	Grid.Finalize();
+	LastBuildFrame = GFrameCounter;
+}
+
+void UUnitPickingSubsystem::QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, TArray<int32>& OutEntryIndices) const
+{
+	OutEntryIndices.Reset();
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	// Only the part of the ray inside the height band of all entries can touch a pick volume.
+	float T0 = 0.f;
+	float T1 = MaxDistance;
+	if (FMath::Abs(Direction.Z) > KINDA_SMALL_NUMBER)
+	{
+		float TA = (MinZ - Origin.Z) / Direction.Z;
+		float TB = (MaxZ - Origin.Z) / Direction.Z;
+		if (TA > TB)
+		{
+			Swap(TA, TB);
+		}
+		T0 = FMath::Max(T0, TA);
+		T1 = FMath::Min(T1, TB);
+		if (T0 > T1)
+		{
+			return;
+		}
+	}
+	else if (Origin.Z < MinZ || Origin.Z > MaxZ)
+	{
+		return;
+	}
+
+	// Walk the clipped segment in XY with half-cell steps. Every point of it lies within half a step of a
+	// sample, so visiting the cells within MaxRadius + Step of each sample covers all candidate volumes.
+	const FVector2D A(Origin + Direction * T0);
+	const FVector2D B(Origin + Direction * T1);
+	const float Step = Grid.GetCellSize() * 0.5f;
+	const float Reach = MaxRadius + Step;
+	const int32 NumSteps = FMath::Max(1, FMath::CeilToInt(FVector2D::Distance(A, B) / Step));
+
+	TSet<FIntPoint, DefaultKeyFuncs<FIntPoint>, TInlineSetAllocator<64>> VisitedCells;
+	for (int32 s = 0; s <= NumSteps; ++s)
+	{
+		const FVector2D P = FMath::Lerp(A, B, static_cast<float>(s) / NumSteps);
+		const FIntPoint Min = Grid.GetCellCoord(FVector(P - FVector2D(Reach), 0.f));
+		const FIntPoint Max = Grid.GetCellCoord(FVector(P + FVector2D(Reach), 0.f));
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				bool bAlreadyVisited = false;
+				VisitedCells.Add(FIntPoint(X, Y), &bAlreadyVisited);
+				if (!bAlreadyVisited)
+				{
+					Grid.ForEachInCell(FIntPoint(X, Y), [&OutEntryIndices](const int32 EntryIndex)
+					{
+						OutEntryIndices.Add(EntryIndex);
+					});
+				}
+			}
+		}
+	}
+}
+
+void UUnitPickingSubsystem::QueryScreenRect(const APlayerController& PC, const FVector2D& RectA, const FVector2D& RectB, TArray<int32>& OutEntryIndices) const
+{
+	OutEntryIndices.Reset();
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	const FVector2D Corners[4] = { RectA, FVector2D(RectB.X, RectA.Y), RectB, FVector2D(RectA.X, RectB.Y) };
+	FVector Origins[4];
+	FVector Directions[4];
+	for (int32 c = 0; c < 4; ++c)
+	{
+		if (!PC.DeprojectScreenPositionToWorld(Corners[c].X, Corners[c].Y, Origins[c], Directions[c]))
+		{
+			// No view to bound the marquee with: a zero direction makes every entry a candidate.
+			Origins[c] = FVector::ZeroVector;
+			Directions[c] = FVector::ZeroVector;
+		}
+	}
+	QueryCornerRays(Origins, Directions, OutEntryIndices);
+}
+
+void UUnitPickingSubsystem::QueryCornerRays(const FVector (&Origins)[4], const FVector (&Directions)[4], TArray<int32>& OutEntryIndices) const
+{
+	OutEntryIndices.Reset();
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	// The frustum of the rectangle between the two Z planes of the height band is the convex hull of its
+	// corner rays hitting both planes, so the XY bounds of those hits bound every entry it can contain.
+	const float PlaneZ[2] = { MinZ, MaxZ };
+
+	FBox2D Footprint(ForceInit);
+	bool bBounded = true;
+	for (int32 c = 0; c < 4; ++c)
+	{
+		const FVector& WorldOrigin = Origins[c];
+		const FVector& WorldDirection = Directions[c];
+		if (FMath::Abs(WorldDirection.Z) <= KINDA_SMALL_NUMBER)
+		{
+			bBounded = false;
+			break;
+		}
+
+		bool bReachesBand = false;
+		for (const float Z : PlaneZ)
+		{
+			const float T = (Z - WorldOrigin.Z) / WorldDirection.Z;
+			bReachesBand |= T >= 0.f;
+			// A plane behind the camera (camera inside the band) is replaced by the camera position.
+			Footprint += FVector2D(WorldOrigin + WorldDirection * FMath::Max(T, 0.f));
+		}
+
+		// Corner ray at or above the horizon: the marquee reaches arbitrarily far.
+		if (!bReachesBand)
+		{
+			bBounded = false;
+			break;
+		}
+	}
+
+	if (!bBounded)
+	{
+		OutEntryIndices.SetNumUninitialized(Entries.Num());
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			OutEntryIndices[i] = i;
+		}
+		return;
+	}
+
+	QueryBox2D(Footprint.Min - FVector2D(MaxRadius), Footprint.Max + FVector2D(MaxRadius), OutEntryIndices);
+}
+
+void UUnitPickingSubsystem::QueryRadius2D(const FVector& Center, float Radius, TArray<int32>& OutEntryIndices) const
+{
+	OutEntryIndices.Reset();
+	const float Reach = Radius + MaxRadius;
+	QueryBox2D(FVector2D(Center) - FVector2D(Reach), FVector2D(Center) + FVector2D(Reach), OutEntryIndices);
+}
+
+void UUnitPickingSubsystem::QueryBox2D(const FVector2D& BoxMin, const FVector2D& BoxMax, TArray<int32>& OutEntryIndices) const
+{
+	Grid.ForEachInBox2D(BoxMin, BoxMax, [&OutEntryIndices](const int32 EntryIndex)
+	{
+		OutEntryIndices.Add(EntryIndex);
+	});
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitPresenceProcessor.h"
+#include "Mass/UnitPresenceSubsystem.h"
+#include "Mass/UnitMassTag.h"
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+
+UUnitPresenceProcessor::UUnitPresenceProcessor()
+{
+    // Same phase as detection so it sees this frame's movement, published right before it.
+    ProcessingPhase = EMassProcessingPhase::PostPhysics;
+    bAutoRegisterWithProcessingPhases = true;
+    ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+    ExecutionOrder.ExecuteBefore.Add(TEXT("DetectionProcessor"));
+}
+
+void UUnitPresenceProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+    Super::InitializeInternal(Owner, EntityManager);
+    if (UWorld* World = Owner.GetWorld())
+    {
+        PresenceSubsystem = World->GetSubsystem<UUnitPresenceSubsystem>();
+    }
+}
+
+void UUnitPresenceProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+    EntityQuery.Initialize(EntityManager);
+    // Query for all entities that can be detected.
+    EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FMassCombatStatsFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FMassAIStateFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddRequirement<FMassSightFragment>(EMassFragmentAccess::ReadOnly);
+    EntityQuery.AddTagRequirement<FMassStopUnitDetectionTag>(EMassFragmentPresence::None);
+
+    EntityQuery.RegisterWithProcessor(*this);
+}
+
+void UUnitPresenceProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+    if (!PresenceSubsystem)
+    {
+        return;
+    }
+
+    PresenceSubsystem->BeginWrite(EntityQuery.GetNumMatchingEntities());
+
+    EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& ChunkContext)
+    {
+        const int32 N = ChunkContext.GetNumEntities();
+        const auto Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+        const auto StatsList = ChunkContext.GetFragmentView<FMassCombatStatsFragment>();
+        const auto CharList = ChunkContext.GetFragmentView<FMassAgentCharacteristicsFragment>();
+        const auto StateList = ChunkContext.GetFragmentView<FMassAIStateFragment>();
+        const auto SightList = ChunkContext.GetFragmentView<FMassSightFragment>();
+
+        FUnitPresenceEntry Entry;
+        for (int32 i = 0; i < N; ++i)
+        {
+            if (StatsList[i].Health <= 0.f)
+            {
+                continue;
+            }
+
+            Entry.Entity = ChunkContext.GetEntity(i);
+            Entry.Location = Transforms[i].GetTransform().GetLocation();
+            Entry.TeamId = StatsList[i].TeamId;
+            Entry.Health = StatsList[i].Health;
+            Entry.CapsuleRadius = CharList[i].CapsuleRadius;
+            Entry.BirthTime = StateList[i].BirthTime;
+            Entry.DeathTime = StateList[i].DeathTime;
+            Entry.SeenByTeamsMask = SightList[i].ConsistentTeamOverlapsPerTeam.GetNonZeroMask();
+            Entry.DetectedByTeamsMask = SightList[i].ConsistentDetectorOverlapsPerTeam.GetNonZeroMask();
+            Entry.AttackedByTeamsMask = SightList[i].ConsistentAttackerTeamOverlapsPerTeam.GetNonZeroMask();
+            Entry.bCanAttack = StateList[i].CanAttack;
+            Entry.bIsFlying = CharList[i].bIsFlying;
+            Entry.bIsInvisible = CharList[i].bIsInvisible;
+            PresenceSubsystem->AddEntry(Entry);
+        }
+    });
+
+    PresenceSubsystem->Publish();
+}
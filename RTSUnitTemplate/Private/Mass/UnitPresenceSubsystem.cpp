@@ -0,0 +1,41 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitPresenceSubsystem.h"
+
+void UUnitPresenceSubsystem::Deinitialize()
+{
+	for (FBuffer& Buffer : Buffers)
+	{
+		Buffer.Entries.Empty();
+		Buffer.EntryIndexByEntityIndex.Empty();
+	}
+	FrontIndex = 0;
+	LastPublishFrame = MAX_uint64;
+	Super::Deinitialize();
+}
+
+void UUnitPresenceSubsystem::BeginWrite(int32 ExpectedNum)
+{
+	Buffers[1 - FrontIndex].Entries.Reset(ExpectedNum);
+}
+
+void UUnitPresenceSubsystem::AddEntry(const FUnitPresenceEntry& Entry)
+{
+	FBuffer& Back = Buffers[1 - FrontIndex];
+	const int32 EntryIndex = Back.Entries.Add(Entry);
+	if (Entry.Entity.Index >= Back.EntryIndexByEntityIndex.Num())
+	{
+		const int32 OldNum = Back.EntryIndexByEntityIndex.Num();
+		Back.EntryIndexByEntityIndex.AddUninitialized(Entry.Entity.Index + 1 - OldNum);
+		for (int32 Slot = OldNum; Slot < Back.EntryIndexByEntityIndex.Num(); ++Slot)
+		{
+			Back.EntryIndexByEntityIndex[Slot] = INDEX_NONE;
+		}
+	}
+	Back.EntryIndexByEntityIndex[Entry.Entity.Index] = EntryIndex;
+}
+
+void UUnitPresenceSubsystem::Publish()
+{
+	FrontIndex = 1 - FrontIndex;
+	LastPublishFrame = GFrameCounter;
+}
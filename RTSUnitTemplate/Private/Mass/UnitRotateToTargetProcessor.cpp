@@ -4,12 +4,26 @@
 #include "MassExecutionContext.h"
 #include "Mass/UnitMassTag.h"
 #include "MassActorSubsystem.h"
-#include "Characters/Unit/UnitBase.h"
-#include "Characters/Unit/MassUnitBase.h"
-#include "Mass/MassActorBindingComponent.h"
 #include "MassRepresentationFragments.h"
 #include "MassRepresentationTypes.h"
+#include "GameFramework/Actor.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	struct FRotateToTargetInfo
+	{
+		FMassEntityHandle TargetEntity;
+		FVector LastKnownLocation = FVector::ZeroVector;
+		FVector Location = FVector::ZeroVector;
+		FQuat CurrentQuat = FQuat::Identity;
+		float MaxRange = 2500.f;
+		float OffsetDegrees = 0.f;
+		float InterpSpeed = 10.f;
+		bool bHasValidTarget = false;
+	};
+}
 
 UUnitRotateToTargetProcessor::UUnitRotateToTargetProcessor()
 {
@@ -17,7 +31,8 @@ UUnitRotateToTargetProcessor::UUnitRotateToTargetProcessor()
 	ExecutionFlags = (int32)(EProcessorExecutionFlags::Standalone | EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Client);
 	ProcessingPhase = EMassProcessingPhase::PostPhysics;
 	ExecutionOrder.ExecuteBefore.Add(TEXT("ActorTransformSyncProcessor"));
-	bRequiresGameThreadExecution = true;
+	// Only fragment data is read; skeletal actors are rotated in one batched game-thread commit.
+	bRequiresGameThreadExecution = false;
 }
 
 void UUnitRotateToTargetProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
@@ -26,6 +41,7 @@ void UUnitRotateToTargetProcessor::ConfigureQueries(const TSharedRef<FMassEntity
 	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddRequirement<FMassAITargetFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.AddRequirement<FMassUnitYawFollowFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassCombatStatsFragment>(EMassFragmentAccess::ReadOnly);
 	EntityQuery.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddRequirement<FMassRepresentationLODFragment>(EMassFragmentAccess::ReadOnly);
@@ -43,131 +59,170 @@ void UUnitRotateToTargetProcessor::ConfigureQueries(const TSharedRef<FMassEntity
 
 void UUnitRotateToTargetProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	EntityQuery.ForEachEntityChunk(Context, [this, &EntityManager](FMassExecutionContext& ChunkContext)
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+	TArray<FRotateToTargetInfo> Units;
+	Units.Reserve(EntityQuery.GetNumMatchingEntities());
+
+	// Dense slot per matched entity in query iteration order (INDEX_NONE = skipped), same scheme as
+	// UUnitSeparationProcessor: gather, solve in parallel, then write back on the same query.
+	TArray<int32> SlotByMatchIndex;
+	SlotByMatchIndex.Reserve(Units.Max());
+
+	EntityQuery.ForEachEntityChunk(Context, [&Units, &SlotByMatchIndex](FMassExecutionContext& ChunkContext)
 	{
 		const int32 NumEntities = ChunkContext.GetNumEntities();
-		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
-
-		TArrayView<FTransformFragment> TransformList = ChunkContext.GetMutableFragmentView<FTransformFragment>();
-		TConstArrayView<FMassAITargetFragment> TargetList = ChunkContext.GetFragmentView<FMassAITargetFragment>();
-		TConstArrayView<FMassUnitYawFollowFragment> FollowList = ChunkContext.GetFragmentView<FMassUnitYawFollowFragment>();
-		TArrayView<FMassActorFragment> ActorList = ChunkContext.GetMutableFragmentView<FMassActorFragment>();
-		TArrayView<FMassAgentCharacteristicsFragment> CharList = ChunkContext.GetMutableFragmentView<FMassAgentCharacteristicsFragment>();
-		TConstArrayView<FMassRepresentationLODFragment> LODList = ChunkContext.GetFragmentView<FMassRepresentationLODFragment>();
-		
+		const TConstArrayView<FTransformFragment> TransformList = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TConstArrayView<FMassAITargetFragment> TargetList = ChunkContext.GetFragmentView<FMassAITargetFragment>();
+		const TConstArrayView<FMassUnitYawFollowFragment> FollowList = ChunkContext.GetFragmentView<FMassUnitYawFollowFragment>();
+		const TConstArrayView<FMassCombatStatsFragment> StatsList = ChunkContext.GetFragmentView<FMassCombatStatsFragment>();
+		const TConstArrayView<FMassActorFragment> ActorList = ChunkContext.GetFragmentView<FMassActorFragment>();
+		const TConstArrayView<FMassRepresentationLODFragment> LODList = ChunkContext.GetFragmentView<FMassRepresentationLODFragment>();
 
 		for (int32 i = 0; i < NumEntities; ++i)
 		{
-			if (LODList[i].LOD == EMassLOD::Off) continue;
+			if (LODList[i].LOD == EMassLOD::Off || !ActorList[i].IsValid())
+			{
+				SlotByMatchIndex.Add(INDEX_NONE);
+				continue;
+			}
 
-			AActor* Actor = ActorList[i].GetMutable();
-			AUnitBase* UnitBase = Cast<AUnitBase>(Actor);
-			if (!UnitBase) continue;
+			const FTransform& MassTransform = TransformList[i].GetTransform();
+			const FMassUnitYawFollowFragment& FollowFrag = FollowList[i];
 
-			FTransform& MassTransform = TransformList[i].GetMutableTransform();
+			FRotateToTargetInfo Info;
+			Info.TargetEntity = TargetList[i].TargetEntity;
+			Info.LastKnownLocation = TargetList[i].LastKnownLocation;
+			Info.bHasValidTarget = TargetList[i].bHasValidTarget;
+			Info.Location = MassTransform.GetLocation();
+			Info.CurrentQuat = MassTransform.GetRotation();
+			// Mirrors MassActorBindingComponent->LoseSightRadius (UUnitActorToFragmentSyncProcessor keeps it in sync).
+			Info.MaxRange = StatsList[i].LoseSightRadius;
+			Info.OffsetDegrees = FollowFrag.OffsetDegrees;
+			Info.InterpSpeed = (FollowFrag.Duration > 0.f) ? (1.0f / FollowFrag.Duration) : 10.0f;
+
+			SlotByMatchIndex.Add(Units.Num());
+			Units.Add(Info);
+		}
+	});
 
-			const FVector PreviousLocation = MassTransform.GetLocation();
-			const FQuat PreviousQuat = MassTransform.GetRotation();
-			
-			// Authoritatively update Mass transform location from Actor ONLY if skeletal movement is used
-			if (UnitBase->bUseSkeletalMovement)
-			{
-				const FVector CurrentActorLocation = UnitBase->GetMassActorLocation();
-				MassTransform.SetLocation(CurrentActorLocation);
-			}
+	if (Units.IsEmpty())
+	{
+		return;
+	}
 
-			const FVector CurrentLocation = MassTransform.GetLocation();
-			const FQuat CurrentQuat = MassTransform.GetRotation();
+	// Each unit only reads other entities (target transform and dead tag) and writes its own slot.
+	// Nothing is written to fragments before the apply pass, so the lookups are race-free.
+	TArray<FQuat> NewQuats;
+	NewQuats.SetNumUninitialized(Units.Num());
 
-			const FMassAITargetFragment& TargetFrag = TargetList[i];
-			const FMassUnitYawFollowFragment& FollowFrag = FollowList[i];
+	ParallelFor(Units.Num(), [&EntityManager, &Units, &NewQuats, DeltaTime](int32 Index)
+	{
+		const FRotateToTargetInfo& Info = Units[Index];
 
-			FVector TargetLocation = FVector::ZeroVector;
-			bool bHasTarget = false;
+		FVector TargetLocation = FVector::ZeroVector;
+		bool bHasTarget = false;
+		const bool bTargetEntityValid = EntityManager.IsEntityValid(Info.TargetEntity);
 
-			if (EntityManager.IsEntityValid(TargetFrag.TargetEntity))
-			{
-				if (const FTransformFragment* TargetXform = EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.TargetEntity))
-				{
-					TargetLocation = TargetXform->GetTransform().GetLocation();
-					bHasTarget = true;
-				}
-			}
-			else if (TargetFrag.bHasValidTarget && !TargetFrag.LastKnownLocation.IsNearlyZero())
+		if (bTargetEntityValid)
+		{
+			if (const FTransformFragment* TargetXform = EntityManager.GetFragmentDataPtr<FTransformFragment>(Info.TargetEntity))
 			{
-				TargetLocation = TargetFrag.LastKnownLocation;
+				TargetLocation = TargetXform->GetTransform().GetLocation();
 				bHasTarget = true;
 			}
+		}
+		else if (Info.bHasValidTarget && !Info.LastKnownLocation.IsNearlyZero())
+		{
+			TargetLocation = Info.LastKnownLocation;
+			bHasTarget = true;
+		}
 
-			FQuat TargetQuat = CurrentQuat;
+		FQuat TargetQuat = Info.CurrentQuat;
 
-			if (bHasTarget)
-			{
-				bool bIsDead = false;
-				if (EntityManager.IsEntityValid(TargetFrag.TargetEntity))
-				{
-					bIsDead = DoesEntityHaveTag(EntityManager, TargetFrag.TargetEntity, FMassStateDeadTag::StaticStruct());
-				}
+		if (bHasTarget)
+		{
+			const bool bIsDead = bTargetEntityValid && DoesEntityHaveTag(EntityManager, Info.TargetEntity, FMassStateDeadTag::StaticStruct());
+			const float DistanceSq = FVector::DistSquared(Info.Location, TargetLocation);
 
-				const float DistanceSq = FVector::DistSquared(CurrentLocation, TargetLocation);
-				float MaxRange = 2500.f;
-				if (const AMassUnitBase* MassUnit = Cast<AMassUnitBase>(UnitBase))
+			if (!bIsDead && DistanceSq <= FMath::Square(Info.MaxRange) && DistanceSq > 25.f)
+			{
+				FVector Dir = TargetLocation - Info.Location;
+				Dir.Z = 0.f;
+				if (Dir.Normalize())
 				{
-					if (MassUnit->MassActorBindingComponent)
-					{
-						MaxRange = MassUnit->MassActorBindingComponent->LoseSightRadius;
-					}
-				}
+					const float TargetYaw = Dir.ToOrientationQuat().Rotator().Yaw + Info.OffsetDegrees;
 
-				if (!bIsDead && DistanceSq <= FMath::Square(MaxRange) && DistanceSq > 25.f)
-				{
-					FVector Dir = TargetLocation - CurrentLocation;
-					Dir.Z = 0.f;
-					if (Dir.Normalize())
+					// Deadzone check to avoid jitter
+					const float CurrentYaw = Info.CurrentQuat.Rotator().Yaw;
+					if (FMath::Abs(FMath::FindDeltaAngleDegrees(CurrentYaw, TargetYaw)) > 2.5f)
 					{
-						FQuat DesiredQuat = Dir.ToOrientationQuat();
-						float TargetYaw = DesiredQuat.Rotator().Yaw + FollowFrag.OffsetDegrees;
-
-						// Deadzone check to avoid jitter
-						const float CurrentYaw = CurrentQuat.Rotator().Yaw;
-						float DeltaAngle = FMath::FindDeltaAngleDegrees(CurrentYaw, TargetYaw);
-						if (FMath::Abs(DeltaAngle) > 2.5f)
-						{
-							TargetQuat = FRotator(0.f, TargetYaw, 0.f).Quaternion();
-						}
+						TargetQuat = FRotator(0.f, TargetYaw, 0.f).Quaternion();
 					}
 				}
 			}
+		}
 
-			// Smooth interpolation using QInterpTo for better frame-rate independence and smoothness
-			float InterpSpeed = (FollowFrag.Duration > 0.f) ? (1.0f / FollowFrag.Duration) : 10.0f;
-			FQuat NewQuat = FMath::QInterpTo(CurrentQuat, TargetQuat, DeltaTime, InterpSpeed);
-			MassTransform.SetRotation(NewQuat);
+		// Smooth interpolation using QInterpTo for better frame-rate independence and smoothness
+		NewQuats[Index] = FMath::QInterpTo(Info.CurrentQuat, TargetQuat, DeltaTime, Info.InterpSpeed);
+	}, Units.Num() < 64 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-			const bool bLocationChanged = !PreviousLocation.Equals(MassTransform.GetLocation(), 0.01f);
-			const bool bRotationChanged = !PreviousQuat.Equals(MassTransform.GetRotation(), 0.0001f);
+	TArray<FActorTransformUpdatePayload> PendingActorUpdates;
 
-			if (UnitBase->bUseSkeletalMovement)
+	int32 MatchIndex = 0;
+	EntityQuery.ForEachEntityChunk(Context, [&NewQuats, &SlotByMatchIndex, &MatchIndex, &PendingActorUpdates](FMassExecutionContext& ChunkContext)
+	{
+		const int32 NumEntities = ChunkContext.GetNumEntities();
+		TArrayView<FTransformFragment> TransformList = ChunkContext.GetMutableFragmentView<FTransformFragment>();
+		TArrayView<FMassActorFragment> ActorList = ChunkContext.GetMutableFragmentView<FMassActorFragment>();
+		TArrayView<FMassAgentCharacteristicsFragment> CharList = ChunkContext.GetMutableFragmentView<FMassAgentCharacteristicsFragment>();
+
+		// Tags are per archetype, so read them once per chunk instead of per entity.
+		const bool bChunkUsesSkeletalMovement = ChunkContext.DoesArchetypeHaveTag<FMassUseSkeletalMovementTag>();
+
+		for (int32 i = 0; i < NumEntities; ++i, ++MatchIndex)
+		{
+			const int32 Slot = SlotByMatchIndex.IsValidIndex(MatchIndex) ? SlotByMatchIndex[MatchIndex] : INDEX_NONE;
+			if (Slot == INDEX_NONE)
 			{
-				if (bLocationChanged || bRotationChanged)
-				{
-					CharList[i].PositionedTransform = MassTransform;
-					CharList[i].bTransformDirty = true;
-					Actor->SetActorTransform(MassTransform, false, nullptr, ETeleportType::None);
-				}
+				continue;
+			}
+
+			FTransform& MassTransform = TransformList[i].GetMutableTransform();
+			if (MassTransform.GetRotation().Equals(NewQuats[Slot], 0.0001f))
+			{
+				continue;
+			}
+			MassTransform.SetRotation(NewQuats[Slot]);
+
+			if (bChunkUsesSkeletalMovement)
+			{
+				// The actor location is owned by the character movement; UActorTransformSyncProcessor copies it
+				// into the fragment, so only the rotation is pushed to the actor.
+				CharList[i].PositionedTransform = MassTransform;
+				CharList[i].bTransformDirty = true;
+				PendingActorUpdates.Emplace(ActorList[i].GetMutable(), MassTransform, true);
 			}
 			else
 			{
 				// For normal units and buildings: Only update rotation part to avoid losing Z-offset managed by SyncProcessor
-				if (bRotationChanged)
-				{
-					CharList[i].PositionedTransform.SetRotation(MassTransform.GetRotation());
-					CharList[i].bTransformDirty = true;
-				}
-				
-				// If location changed externally (e.g. by movement processor), 
-				// we rely on ActorTransformSyncProcessor to update PositionedTransform.Z correctly.
+				CharList[i].PositionedTransform.SetRotation(MassTransform.GetRotation());
+				CharList[i].bTransformDirty = true;
 			}
 		}
 	});
+
+	if (!PendingActorUpdates.IsEmpty())
+	{
+		AsyncTask(ENamedThreads::GameThread, [Updates = MoveTemp(PendingActorUpdates)]()
+		{
+			for (const FActorTransformUpdatePayload& Update : Updates)
+			{
+				if (AActor* Actor = Update.ActorPtr.Get())
+				{
+					Actor->SetActorRotation(Update.NewTransform.GetRotation(), ETeleportType::None);
+				}
+			}
+		});
+	}
 }
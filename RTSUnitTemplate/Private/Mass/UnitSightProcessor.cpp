@@ -5,12 +5,22 @@
 #include "MassExecutionContext.h"
 #include "MassSignalSubsystem.h"
 #include "Mass/DetectionProcessor.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
 #include "Mass/Signals/MySignals.h"
 #include "Async/Async.h"
 #include "MassActorSubsystem.h" // FMassActorFragment
 #include "Characters/Unit/UnitBase.h"
 #include "Characters/Unit/PerformanceUnit.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
+#include "HAL/IConsoleManager.h"
+
+// Enter/exit sight signals are only sent on per-team transitions. A periodic full resync re-sends the
+// current state so actors that were rebound or changed team converge without a transition.
+static TAutoConsoleVariable<float> CVarRTS_SightFullResyncInterval(
+    TEXT("RTS.Sight.FullResyncInterval"),
+    2.0f,
+    TEXT("Seconds between full re-sends of enemy sight state (0 = transitions only)."),
+    ECVF_Default);
 
 UUnitSightProcessor::UUnitSightProcessor(): EntityQuery()
 {
@@ -133,6 +143,7 @@ void UUnitSightProcessor::ExecuteServer(
     {
         return;
     }
+    const float TimeSinceLastRunBeforeReset = TimeSinceLastRun;
     TimeSinceLastRun = 0.f;
     
     // 2) Gather every “alive” entity into a flat array
@@ -181,12 +192,7 @@ void UUnitSightProcessor::ExecuteServer(
                     {
                         if (SightList && (bIsDeadTooLong || !State.IsInitialized))
                         {
-                            SightList[i].TeamOverlapsPerTeam.Empty();
-                            SightList[i].DetectorOverlapsPerTeam.Empty();
-                            SightList[i].AttackerTeamOverlapsPerTeam.Empty();
-                            SightList[i].ConsistentTeamOverlapsPerTeam.Empty();
-                            SightList[i].ConsistentDetectorOverlapsPerTeam.Empty();
-                            SightList[i].ConsistentAttackerTeamOverlapsPerTeam.Empty();
+                            SightList[i].ResetAll();
                         }
                         continue;
                     }
@@ -195,16 +201,19 @@ void UUnitSightProcessor::ExecuteServer(
                 {
                     if (SightList)
                     {
-                        SightList[i].TeamOverlapsPerTeam.Empty();
-                        SightList[i].DetectorOverlapsPerTeam.Empty();
-                        SightList[i].AttackerTeamOverlapsPerTeam.Empty();
-                        SightList[i].ConsistentTeamOverlapsPerTeam.Empty();
-                        SightList[i].ConsistentDetectorOverlapsPerTeam.Empty();
-                        SightList[i].ConsistentAttackerTeamOverlapsPerTeam.Empty();
+                        SightList[i].ResetAll();
                     }
                     continue;
                 }
 
+                static bool bWarnedTeamRange = false;
+                if (!bWarnedTeamRange && !FTeamSightCounters::IsValidTeam(StatsList[i].TeamId))
+                {
+                    bWarnedTeamRange = true;
+                    UE_LOG(LogTemp, Warning, TEXT("UnitSightProcessor: TeamId %d is outside the sight counter range [0, %d). Raise RTS_MAX_SIGHT_TEAMS."),
+                        StatsList[i].TeamId, FTeamSightCounters::MaxTeams);
+                }
+
                 AllEntities.Add({
                         ChunkCtx.GetEntity(i),
                         Transforms[i].GetTransform().GetLocation(),
@@ -228,6 +237,23 @@ void UUnitSightProcessor::ExecuteServer(
     TArray<FMassSightSignalPayload>   PendingSignals;
     FogEntities.Reserve(AllEntities.Num());
     PendingSignals.Reserve(AllEntities.Num() * 2);
+
+    // Candidates come from the shared spatial grid when it was rebuilt this frame, otherwise from a full scan.
+    const UUnitSpatialGridSubsystem* Grid = World->GetSubsystem<UUnitSpatialGridSubsystem>();
+    const bool bUseGrid = Grid && Grid->IsBuiltThisFrame();
+
+    TMap<FMassEntityHandle, int32> IndexByEntity;
+    if (bUseGrid)
+    {
+        IndexByEntity.Reserve(AllEntities.Num());
+        for (int32 i = 0; i < AllEntities.Num(); ++i)
+        {
+            IndexByEntity.Add(AllEntities[i].Entity, i);
+        }
+    }
+
+    TArray<int32> Candidates;
+    Candidates.Reserve(64);
     
     for (int32 i = 0; i < AllEntities.Num(); ++i)
     {
@@ -241,7 +267,28 @@ void UUnitSightProcessor::ExecuteServer(
             FogEntities.Add(Det.Entity);
         }
 
-        for (int32 j = 0; j < AllEntities.Num(); ++j)
+        Candidates.Reset();
+        if (bUseGrid)
+        {
+            const float DetCapsule = Det.Char ? Det.Char->CapsuleRadius : 0.f;
+            const float QueryRadius = Det.Stats->SightRadius + DetCapsule + Grid->GetMaxEntryRadius();
+            Grid->ForEachEntryInRadius2D(Det.Location, QueryRadius, [&IndexByEntity, &Candidates](const FUnitSpatialGridEntry& Entry)
+            {
+                if (const int32* Found = IndexByEntity.Find(Entry.Entity))
+                {
+                    Candidates.Add(*Found);
+                }
+            });
+        }
+        else
+        {
+            for (int32 j = 0; j < AllEntities.Num(); ++j)
+            {
+                Candidates.Add(j);
+            }
+        }
+
+        for (const int32 j : Candidates)
         {
             if (i == j) continue;
             const auto& Tgt = AllEntities[j];
@@ -265,14 +312,14 @@ void UUnitSightProcessor::ExecuteServer(
             {
                 if (Det.Char && Tgt.Char && (Det.Char->bCanDetectInvisible || !Tgt.Char->bCanBeInvisible))
                 {
-                    Tgt.Sight->DetectorOverlapsPerTeam.FindOrAdd(Det.Stats->TeamId)++;
+                    Tgt.Sight->DetectorOverlapsPerTeam.Increment(Det.Stats->TeamId);
                 }
                 else if (Det.Char && !Tgt.Char)
                 {
-                    Tgt.Sight->DetectorOverlapsPerTeam.FindOrAdd(Det.Stats->TeamId)++;
+                    Tgt.Sight->DetectorOverlapsPerTeam.Increment(Det.Stats->TeamId);
                 }
                 
-                Tgt.Sight->TeamOverlapsPerTeam.FindOrAdd(Det.Stats->TeamId)++;
+                Tgt.Sight->TeamOverlapsPerTeam.Increment(Det.Stats->TeamId);
             }
         }
     }
@@ -282,16 +329,7 @@ void UUnitSightProcessor::ExecuteServer(
     {
         if (Target.Char && Target.Char->bCanBeInvisible)
         {
-            bool bAnyEnemyDetects = false;
-            for (auto& Pair : Target.Sight->DetectorOverlapsPerTeam)
-            {
-                if (Pair.Value > 0)
-                {
-                    bAnyEnemyDetects = true;
-                    break;
-                }
-            }
-            Target.Char->bIsInvisible = !bAnyEnemyDetects;
+            Target.Char->bIsInvisible = !Target.Sight->DetectorOverlapsPerTeam.AnyNonZero();
         }
         else if (Target.Char)
         {
@@ -299,110 +337,168 @@ void UUnitSightProcessor::ExecuteServer(
         }
     }
 
-    // 5) Enqueue Signals
-    for (auto& Detector : AllEntities)
+    // 5) Enqueue Signals - only on per-team visibility transitions.
+    // SetEnemyVisibility only evaluates the detector's team, so one representative detector per team is enough.
+    TimeSinceFullSightResync += TimeSinceLastRunBeforeReset;
+    const float ResyncInterval = CVarRTS_SightFullResyncInterval.GetValueOnGameThread();
+    const bool bFullResync = ResyncInterval > 0.f && TimeSinceFullSightResync >= ResyncInterval;
+    if (bFullResync)
     {
-        const int32 DetectorTeamId = Detector.Stats->TeamId;
-        
-        for (auto& Target : AllEntities)
+        TimeSinceFullSightResync = 0.f;
+    }
+
+    constexpr int32 MaxTeams = FTeamSightCounters::MaxTeams;
+    TArray<int32> TeamMembers[MaxTeams];
+    FMassEntityHandle TeamRepresentative[MaxTeams];
+    uint64 PresentTeamsMask = 0;
+
+    for (int32 i = 0; i < AllEntities.Num(); ++i)
+    {
+        const int32 TeamId = AllEntities[i].Stats->TeamId;
+        if (!FTeamSightCounters::IsValidTeam(TeamId))
         {
-            if (Target.Stats->TeamId == DetectorTeamId) continue;
-            
-            const int32 DetectCount = Target.Sight->DetectorOverlapsPerTeam.FindOrAdd(DetectorTeamId);
-            
-            if (DetectCount > 0)
+            continue;
+        }
+        TeamMembers[TeamId].Add(i);
+
+        // Prefer a detector that is bound to a unit actor, the game-thread handler resolves the team from it.
+        if (!TeamRepresentative[TeamId].IsSet())
+        {
+            const FMassActorFragment* ActorFrag = EntityManager.GetFragmentDataPtr<FMassActorFragment>(AllEntities[i].Entity);
+            if (ActorFrag && IsValid(Cast<AUnitBase>(ActorFrag->Get())))
             {
-                PendingSignals.Emplace(Target.Entity, Detector.Entity, UnitSignals::UnitEnterSight);
+                TeamRepresentative[TeamId] = AllEntities[i].Entity;
+                PresentTeamsMask |= (1ULL << TeamId);
             }
-            else
+        }
+    }
+
+    TArray<FMassSightSignalPayload> EnterSignals;
+    for (auto& Target : AllEntities)
+    {
+        const int32 TargetTeamId = Target.Stats->TeamId;
+        uint64 VisibleMask = 0;
+
+        for (int32 DetectorTeamId = 0; DetectorTeamId < MaxTeams; ++DetectorTeamId)
+        {
+            if (DetectorTeamId == TargetTeamId || !(PresentTeamsMask & (1ULL << DetectorTeamId)))
             {
-                int32 AttackingSightCount = Target.Sight->AttackerTeamOverlapsPerTeam.FindOrAdd(DetectorTeamId);
-                
-                if (AttackingSightCount > 0)
+                continue;
+            }
+
+            bool bVisible = Target.Sight->DetectorOverlapsPerTeam.Get(DetectorTeamId) > 0;
+            if (!bVisible && Target.Sight->AttackerTeamOverlapsPerTeam.Get(DetectorTeamId) > 0)
+            {
+                const float TgtCapsule = Target.Char ? Target.Char->CapsuleRadius : 0.f;
+                for (const int32 DetIdx : TeamMembers[DetectorTeamId])
                 {
-                    const float DistSqr = FVector::DistSquared2D(Detector.Location, Target.Location);
+                    const auto& Detector = AllEntities[DetIdx];
                     const float DetCapsule = Detector.Char ? Detector.Char->CapsuleRadius : 0.f;
-                    const float TgtCapsule = Target.Char ? Target.Char->CapsuleRadius : 0.f;
                     const float EffectiveLoseSight = Detector.Stats->LoseSightRadius + DetCapsule + TgtCapsule;
-                    
-                    if (DistSqr <= FMath::Square(EffectiveLoseSight))
+                    if (FVector::DistSquared2D(Detector.Location, Target.Location) <= FMath::Square(EffectiveLoseSight))
                     {
-                        PendingSignals.Emplace(Target.Entity, Detector.Entity, UnitSignals::UnitEnterSight);
+                        bVisible = true;
+                        break;
                     }
-                    else
-                    {
-                        PendingSignals.Emplace(Target.Entity, Detector.Entity, UnitSignals::UnitExitSight);
-                    }
-                }
-                else
-                {
-                    PendingSignals.Emplace(Target.Entity, Detector.Entity, UnitSignals::UnitExitSight);
                 }
             }
+
+            if (bVisible)
+            {
+                VisibleMask |= (1ULL << DetectorTeamId);
+            }
+        }
+
+        const uint64 KnownMask = Target.Sight->SignaledTeamsMask & PresentTeamsMask;
+        const uint64 ChangedMask = ((VisibleMask ^ Target.Sight->SignaledVisibleTeamsMask) & KnownMask) | (PresentTeamsMask & ~KnownMask);
+        if (ChangedMask == 0 && !bFullResync)
+        {
+            continue;
+        }
+
+        // Exits first, then every currently visible team: the actor state ends up as the OR over its allied
+        // detector teams, even when one team loses sight while another still sees the target.
+        EnterSignals.Reset();
+        for (int32 DetectorTeamId = 0; DetectorTeamId < MaxTeams; ++DetectorTeamId)
+        {
+            const uint64 Bit = (1ULL << DetectorTeamId);
+            if (!(PresentTeamsMask & Bit) || DetectorTeamId == TargetTeamId)
+            {
+                continue;
+            }
+
+            if (VisibleMask & Bit)
+            {
+                EnterSignals.Emplace(Target.Entity, TeamRepresentative[DetectorTeamId], UnitSignals::UnitEnterSight);
+            }
+            else if ((ChangedMask & Bit) || bFullResync)
+            {
+                PendingSignals.Emplace(Target.Entity, TeamRepresentative[DetectorTeamId], UnitSignals::UnitExitSight);
+            }
         }
+        PendingSignals.Append(EnterSignals);
+
+        Target.Sight->SignaledVisibleTeamsMask = (Target.Sight->SignaledVisibleTeamsMask & ~PresentTeamsMask) | VisibleMask;
+        Target.Sight->SignaledTeamsMask |= PresentTeamsMask;
     }
 
     // 6) Sync Consistent Overlaps and Reset
     for (auto& Target : AllEntities)
     {
-        Target.Sight->ConsistentDetectorOverlapsPerTeam = Target.Sight->DetectorOverlapsPerTeam;
-        Target.Sight->ConsistentTeamOverlapsPerTeam = Target.Sight->TeamOverlapsPerTeam;
-        Target.Sight->ConsistentAttackerTeamOverlapsPerTeam = Target.Sight->AttackerTeamOverlapsPerTeam;
-        Target.Sight->TeamOverlapsPerTeam.Empty();
-        Target.Sight->DetectorOverlapsPerTeam.Empty();
+        Target.Sight->CommitAndReset();
     }
 
     // 7) Update fog mask and dispatch signals
-    if (SignalSubsystem)
+    if (SignalSubsystem && FogEntities.Num() > 0)
     {
-        if (FogEntities.Num() > 0)
-        {
-            SignalSubsystem->SignalEntities(UnitSignals::UpdateFogMask, FogEntities);
-        }
+        SignalSubsystem->SignalEntities(UnitSignals::UpdateFogMask, FogEntities);
+    }
 
-        if (PendingSignals.Num() > 0)
+    // One game-thread dispatch for the whole batch instead of a signal round-trip per pair.
+    if (PendingSignals.Num() > 0)
+    {
+        TWeakObjectPtr<UUnitSightProcessor> WeakThis = this;
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Signals = MoveTemp(PendingSignals)]()
         {
-            TWeakObjectPtr<UMassSignalSubsystem> SubPtr = SignalSubsystem;
-            AsyncTask(ENamedThreads::GameThread, [SubPtr, Signals = MoveTemp(PendingSignals)]()
+            if (UUnitSightProcessor* StrongThis = WeakThis.Get())
             {
-                if (auto* Sub = SubPtr.Get())
+                for (const FMassSightSignalPayload& P : Signals)
                 {
-                    for (auto& P : Signals)
-                    {
-                        if (!P.SignalName.IsNone())
-                        {
-                            Sub->SignalEntities(P.SignalName, { P.TargetEntity, P.DetectorEntity });
-                        }
-                    }
+                    StrongThis->ApplySightSignal(P.SignalName, P.TargetEntity, P.DetectorEntity);
                 }
-            });
-        }
+            }
+        });
     }
 }
 
 void UUnitSightProcessor::HandleSightSignals(FName SignalName, TArray<FMassEntityHandle>& Entities)
 {
-    if (!EntitySubsystem)
+    if (Entities.Num() < 2)
     {
         return;
     }
 
-    if (Entities.Num() < 2)
+    ApplySightSignal(SignalName, Entities[0], Entities[1]);
+}
+
+void UUnitSightProcessor::ApplySightSignal(FName SignalName, FMassEntityHandle TargetEntity, FMassEntityHandle DetectorEntity)
+{
+    if (!EntitySubsystem || SignalName.IsNone())
     {
         return;
     }
 
     FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
 
-    const bool bValid0 = EntityManager.IsEntityValid(Entities[0]);
-    const bool bValid1 = EntityManager.IsEntityValid(Entities[1]);
+    const bool bValid0 = EntityManager.IsEntityValid(TargetEntity);
+    const bool bValid1 = EntityManager.IsEntityValid(DetectorEntity);
     if (!bValid0 || !bValid1)
     {
         return;
     }
 
-    FMassActorFragment* TargetActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entities[0]);
-    FMassActorFragment* DetectorActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(Entities[1]);
+    FMassActorFragment* TargetActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(TargetEntity);
+    FMassActorFragment* DetectorActorFragPtr = EntityManager.GetFragmentDataPtr<FMassActorFragment>(DetectorEntity);
 
     if (!TargetActorFragPtr || !DetectorActorFragPtr)
     {
@@ -0,0 +1,91 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitSpatialGridProcessor.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+#include "Mass/UnitMassTag.h"
+#include "HAL/IConsoleManager.h"
+
+// Cell edge length of the unit spatial hash. Around half the typical sight radius keeps the
+// number of visited cells small without putting too many units in one cell.
+static TAutoConsoleVariable<float> CVarRTS_SpatialGridCellSize(
+	TEXT("RTS.SpatialGrid.CellSize"),
+	1000.f,
+	TEXT("Cell size (cm) of the unit spatial hash used by detection and sight queries."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_SpatialGridEnable(
+	TEXT("RTS.SpatialGrid.Enable"),
+	1,
+	TEXT("1 = rebuild the unit spatial hash every frame. 0 = disabled, detection and sight fall back to full scans."),
+	ECVF_Default);
+
+UUnitSpatialGridProcessor::UUnitSpatialGridProcessor()
+{
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bAutoRegisterWithProcessingPhases = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	ExecutionOrder.ExecuteBefore.Add(TEXT("DetectionProcessor"));
+	ExecutionOrder.ExecuteBefore.Add(TEXT("UnitSightProcessor"));
+	// The combat states read their targets from the snapshot rows.
+	ExecutionOrder.ExecuteBefore.Add(UE::Mass::ProcessorGroupNames::Behavior);
+}
+
+void UUnitSpatialGridProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	Super::InitializeInternal(Owner, EntityManager);
+	if (UWorld* World = Owner.GetWorld())
+	{
+		GridSubsystem = World->GetSubsystem<UUnitSpatialGridSubsystem>();
+	}
+}
+
+void UUnitSpatialGridProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	// Same population the sight pass gathers (units, effect areas, projectiles) - all carry a sight fragment.
+	EntityQuery.Initialize(EntityManager);
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassCombatStatsFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassSightFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FMassAgentCharacteristicsFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.AddRequirement<FMassAIStateFragment>(EMassFragmentAccess::ReadOnly, EMassFragmentPresence::Optional);
+	EntityQuery.RegisterWithProcessor(*this);
+}
+
+void UUnitSpatialGridProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	if (!GridSubsystem || CVarRTS_SpatialGridEnable.GetValueOnAnyThread() == 0)
+	{
+		return;
+	}
+
+	GridSubsystem->BeginRebuild(CVarRTS_SpatialGridCellSize.GetValueOnAnyThread(), EntityQuery.GetNumMatchingEntities());
+
+	EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& ChunkCtx)
+	{
+		const int32 N = ChunkCtx.GetNumEntities();
+		const auto Transforms = ChunkCtx.GetFragmentView<FTransformFragment>();
+		const auto StatsList = ChunkCtx.GetFragmentView<FMassCombatStatsFragment>();
+		const auto CharList = ChunkCtx.GetFragmentView<FMassAgentCharacteristicsFragment>();
+		const auto StateList = ChunkCtx.GetFragmentView<FMassAIStateFragment>();
+		const bool bHasChar = CharList.Num() > 0;
+		const bool bHasState = StateList.Num() > 0;
+
+		FUnitSpatialGridEntry Entry;
+		for (int32 i = 0; i < N; ++i)
+		{
+			Entry.Entity = ChunkCtx.GetEntity(i);
+			Entry.Location = Transforms[i].GetTransform().GetLocation();
+			Entry.TeamId = StatsList[i].TeamId;
+			Entry.Health = StatsList[i].Health;
+			Entry.Radius = bHasChar ? CharList[i].CapsuleRadius : 0.f;
+			Entry.GroundZ = bHasChar ? CharList[i].LastGroundLocation : Entry.Location.Z;
+			Entry.bIsFlying = bHasChar && CharList[i].bIsFlying;
+			Entry.bUseBoxComponent = bHasChar && CharList[i].bUseBoxComponent;
+			Entry.bCanAttack = !bHasState || StateList[i].CanAttack;
+			GridSubsystem->AddEntry(Entry);
+		}
+	});
+
+	GridSubsystem->FinishRebuild();
+}
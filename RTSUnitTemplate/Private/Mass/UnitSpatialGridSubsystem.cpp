@@ -0,0 +1,49 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Mass/UnitSpatialGridSubsystem.h"
+
+void UUnitSpatialGridSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndexByEntityIndex.Empty();
+	Grid = FUnitCellGrid2D();
+	LastBuildFrame = MAX_uint64;
+	Super::Deinitialize();
+}
+
+void UUnitSpatialGridSubsystem::BeginRebuild(float InCellSize, int32 ExpectedNum)
+{
+	MaxEntryRadius = 0.f;
+	Entries.Reset(ExpectedNum);
+	Grid.Reset(InCellSize, ExpectedNum);
+}
+
+void UUnitSpatialGridSubsystem::AddEntry(const FUnitSpatialGridEntry& Entry)
+{
+	const int32 EntryIndex = Entries.Add(Entry);
+	if (Entry.Entity.Index >= EntryIndexByEntityIndex.Num())
+	{
+		const int32 OldNum = EntryIndexByEntityIndex.Num();
+		EntryIndexByEntityIndex.AddUninitialized(Entry.Entity.Index + 1 - OldNum);
+		for (int32 Slot = OldNum; Slot < EntryIndexByEntityIndex.Num(); ++Slot)
+		{
+			EntryIndexByEntityIndex[Slot] = INDEX_NONE;
+		}
+	}
+	EntryIndexByEntityIndex[Entry.Entity.Index] = EntryIndex;
+	Grid.AddItem(Entry.Location);
+	MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+}
+
+void UUnitSpatialGridSubsystem::FinishRebuild()
+{
+	Grid.Finalize();
+	LastBuildFrame = GFrameCounter;
+}
+
+void UUnitSpatialGridSubsystem::QueryEntitiesInRadius2D(const FVector& Center, float Radius, TArray<FMassEntityHandle>& OutEntities) const
+{
+	ForEachEntryInRadius2D(Center, Radius, [&OutEntities](const FUnitSpatialGridEntry& Entry)
+	{
+		OutEntities.Add(Entry.Entity);
+	});
+}
@@ -212,27 +212,8 @@ void UUnitVisibilityProcessor::Execute(FMassEntityManager& EntityManager, FMassE
 					}
 					else if (SightList.Num() > 0)
 					{
-						bool bSeenByAlliance = false;
-						for (const auto& Pair : SightList[i].ConsistentTeamOverlapsPerTeam)
-						{
-							if (Pair.Value > 0 && (LocalAllianceMask & (1LL << Pair.Key)) != 0)
-							{
-								bSeenByAlliance = true;
-								break;
-							}
-						}
-
-						if (!bSeenByAlliance)
-						{
-							for (const auto& Pair : SightList[i].ConsistentAttackerTeamOverlapsPerTeam)
-							{
-								if (Pair.Value > 0 && (LocalAllianceMask & (1LL << Pair.Key)) != 0)
-								{
-									bSeenByAlliance = true;
-									break;
-								}
-							}
-						}
+						const bool bSeenByAlliance = SightList[i].ConsistentTeamOverlapsPerTeam.AnyInMask(LocalAllianceMask)
+							|| SightList[i].ConsistentAttackerTeamOverlapsPerTeam.AnyInMask(LocalAllianceMask);
 
 						bool bAttacksMyAlliance = false;
 						if (!bSeenByAlliance && TargetList)
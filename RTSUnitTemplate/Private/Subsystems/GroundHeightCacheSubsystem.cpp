@@ -0,0 +1,258 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "Subsystems/GroundHeightCacheSubsystem.h"
+#include "Characters/Unit/UnitBase.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_GroundCacheEnable(
+	TEXT("RTS.GroundCache.Enable"),
+	1,
+	TEXT("1 = resolve unit ground height from the cached heightfield, 0 = always line trace."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRTS_GroundCacheSpacing(
+	TEXT("RTS.GroundCache.Spacing"),
+	50.f,
+	TEXT("Distance (cm) between two heightfield samples. Changing it drops the cache."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRTS_GroundCacheMaxCornerDelta(
+	TEXT("RTS.GroundCache.MaxCornerDelta"),
+	60.f,
+	TEXT("If the four samples around a lookup differ by more than this (cm) the area counts as a step/cliff and the caller traces."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_GroundCacheMaxFillsPerFrame(
+	TEXT("RTS.GroundCache.MaxFillsPerFrame"),
+	512,
+	TEXT("Maximum number of heightfield samples traced per frame. Lookups over the budget report a miss and trace themselves."),
+	ECVF_Default);
+
+namespace
+{
+	// Vertical extent of a sample trace. The whole column is traced once so every layer is seen.
+	constexpr float GroundCacheTraceHalfHeight = 200000.f;
+
+	// Hits closer than this in Z are treated as the same surface (e.g. landscape and a decal mesh lying on it).
+	constexpr float GroundCacheLayerTolerance = 25.f;
+
+	int32 FloorDiv(int32 Value, int32 Divisor)
+	{
+		return Value >= 0 ? Value / Divisor : (Value - Divisor + 1) / Divisor;
+	}
+}
+
+void UGroundHeightCacheSubsystem::Deinitialize()
+{
+	Tiles.Empty();
+	Super::Deinitialize();
+}
+
+bool UGroundHeightCacheSubsystem::GetGroundHeight(const FVector& Location, float& OutZ, FVector& OutNormal)
+{
+	if (CVarRTS_GroundCacheEnable.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+
+	const float CurrentSpacing = FMath::Max(10.f, CVarRTS_GroundCacheSpacing.GetValueOnGameThread());
+	if (CurrentSpacing != Spacing)
+	{
+		Tiles.Reset();
+		Spacing = CurrentSpacing;
+	}
+
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		SampleFillsThisFrame = 0;
+	}
+
+	const float GridX = Location.X / Spacing;
+	const float GridY = Location.Y / Spacing;
+	const int32 X0 = FMath::FloorToInt(GridX);
+	const int32 Y0 = FMath::FloorToInt(GridY);
+	const float Alpha = GridX - X0;
+	const float Beta = GridY - Y0;
+
+	float Z00, Z10, Z01, Z11;
+	if (ResolveSample(X0, Y0, Z00) != ESampleState::Ground
+		|| ResolveSample(X0 + 1, Y0, Z10) != ESampleState::Ground
+		|| ResolveSample(X0, Y0 + 1, Z01) != ESampleState::Ground
+		|| ResolveSample(X0 + 1, Y0 + 1, Z11) != ESampleState::Ground)
+	{
+		return false;
+	}
+
+	// Bilinear interpolation over a cliff edge would put units halfway up the wall.
+	const float MinZ = FMath::Min(FMath::Min(Z00, Z10), FMath::Min(Z01, Z11));
+	const float MaxZ = FMath::Max(FMath::Max(Z00, Z10), FMath::Max(Z01, Z11));
+	if (MaxZ - MinZ > CVarRTS_GroundCacheMaxCornerDelta.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	OutZ = FMath::Lerp(FMath::Lerp(Z00, Z10, Alpha), FMath::Lerp(Z01, Z11, Alpha), Beta);
+
+	const float DzDx = (FMath::Lerp(Z10, Z11, Beta) - FMath::Lerp(Z00, Z01, Beta)) / Spacing;
+	const float DzDy = (FMath::Lerp(Z01, Z11, Alpha) - FMath::Lerp(Z00, Z10, Alpha)) / Spacing;
+	OutNormal = FVector(-DzDx, -DzDy, 1.f).GetSafeNormal();
+	return true;
+}
+
+UGroundHeightCacheSubsystem::ESampleState UGroundHeightCacheSubsystem::ResolveSample(int32 SampleX, int32 SampleY, float& OutZ)
+{
+	const FIntPoint TileCoord = GetTileCoord(SampleX, SampleY);
+	FTile& Tile = FindOrAddTile(TileCoord);
+	const int32 Index = (SampleY - TileCoord.Y * TileSize) * TileSize + (SampleX - TileCoord.X * TileSize);
+
+	if (Tile.States[Index] == ESampleState::Unknown)
+	{
+		if (SampleFillsThisFrame >= CVarRTS_GroundCacheMaxFillsPerFrame.GetValueOnGameThread())
+		{
+			return ESampleState::Unknown;
+		}
+		++SampleFillsThisFrame;
+		Tile.States[Index] = TraceSample(SampleX, SampleY, Tile.Heights[Index]);
+	}
+
+	OutZ = Tile.Heights[Index];
+	return Tile.States[Index];
+}
+
+UGroundHeightCacheSubsystem::ESampleState UGroundHeightCacheSubsystem::TraceSample(int32 SampleX, int32 SampleY, float& OutZ) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return ESampleState::NeedsTrace;
+	}
+
+	const FVector2D XY(SampleX * Spacing, SampleY * Spacing);
+	const FVector Start(XY, GroundCacheTraceHalfHeight);
+	const FVector End(XY, -GroundCacheTraceHalfHeight);
+
+	TArray<FHitResult> Hits;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GroundHeightCacheSample), false);
+	World->LineTraceMultiByObjectType(Hits, Start, End, FCollisionObjectQueryParams(ECC_WorldStatic), Params);
+
+	bool bFound = false;
+	for (const FHitResult& Hit : Hits)
+	{
+		const AActor* HitActor = Hit.GetActor();
+		if (!IsValid(HitActor))
+		{
+			return ESampleState::NeedsTrace;
+		}
+
+		// Units move, so they never become part of the heightfield. Buildings are units as well, but the
+		// sync processor treats them as obstacles (flyers hover over them), so their columns keep tracing.
+		if (const AUnitBase* Unit = Cast<AUnitBase>(HitActor))
+		{
+			if (Unit->bIsBuilding)
+			{
+				return ESampleState::NeedsTrace;
+			}
+			continue;
+		}
+
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (!HitComponent || HitComponent->Mobility == EComponentMobility::Movable)
+		{
+			return ESampleState::NeedsTrace;
+		}
+
+		if (!bFound)
+		{
+			OutZ = Hit.ImpactPoint.Z;
+			bFound = true;
+		}
+		else if (FMath::Abs(Hit.ImpactPoint.Z - OutZ) > GroundCacheLayerTolerance)
+		{
+			// Bridge, overhang or cave: the correct layer depends on the unit's own height.
+			return ESampleState::NeedsTrace;
+		}
+	}
+
+	return bFound ? ESampleState::Ground : ESampleState::NeedsTrace;
+}
+
+UGroundHeightCacheSubsystem::FTile& UGroundHeightCacheSubsystem::FindOrAddTile(const FIntPoint& TileCoord)
+{
+	TUniquePtr<FTile>& Tile = Tiles.FindOrAdd(TileCoord);
+	if (!Tile)
+	{
+		Tile = MakeUnique<FTile>();
+	}
+	return *Tile;
+}
+
+FIntPoint UGroundHeightCacheSubsystem::GetTileCoord(int32 SampleX, int32 SampleY)
+{
+	return FIntPoint(FloorDiv(SampleX, TileSize), FloorDiv(SampleY, TileSize));
+}
+
+void UGroundHeightCacheSubsystem::InvalidateBounds(const FBox& Bounds)
+{
+	if (!Bounds.IsValid || Tiles.Num() == 0 || Spacing <= 0.f)
+	{
+		return;
+	}
+
+	// One extra sample on each side: lookups interpolate between neighbours.
+	const int32 MinX = FMath::FloorToInt(Bounds.Min.X / Spacing) - 1;
+	const int32 MinY = FMath::FloorToInt(Bounds.Min.Y / Spacing) - 1;
+	const int32 MaxX = FMath::CeilToInt(Bounds.Max.X / Spacing) + 1;
+	const int32 MaxY = FMath::CeilToInt(Bounds.Max.Y / Spacing) + 1;
+
+	const FIntPoint MinTile = GetTileCoord(MinX, MinY);
+	const FIntPoint MaxTile = GetTileCoord(MaxX, MaxY);
+
+	for (int32 TileY = MinTile.Y; TileY <= MaxTile.Y; ++TileY)
+	{
+		for (int32 TileX = MinTile.X; TileX <= MaxTile.X; ++TileX)
+		{
+			TUniquePtr<FTile>* TilePtr = Tiles.Find(FIntPoint(TileX, TileY));
+			if (!TilePtr || !*TilePtr)
+			{
+				continue;
+			}
+
+			FTile& Tile = **TilePtr;
+			const int32 LocalMinX = FMath::Max(MinX - TileX * TileSize, 0);
+			const int32 LocalMinY = FMath::Max(MinY - TileY * TileSize, 0);
+			const int32 LocalMaxX = FMath::Min(MaxX - TileX * TileSize, TileSize - 1);
+			const int32 LocalMaxY = FMath::Min(MaxY - TileY * TileSize, TileSize - 1);
+
+			for (int32 Y = LocalMinY; Y <= LocalMaxY; ++Y)
+			{
+				for (int32 X = LocalMinX; X <= LocalMaxX; ++X)
+				{
+					Tile.States[Y * TileSize + X] = ESampleState::Unknown;
+				}
+			}
+		}
+	}
+}
+
+void UGroundHeightCacheSubsystem::InvalidateActorBounds(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (UWorld* World = Actor->GetWorld())
+	{
+		if (UGroundHeightCacheSubsystem* Cache = World->GetSubsystem<UGroundHeightCacheSubsystem>())
+		{
+			Cache->InvalidateBounds(Actor->GetComponentsBoundingBox(true));
+		}
+	}
+}
+
+void UGroundHeightCacheSubsystem::InvalidateAll()
+{
+	Tiles.Reset();
+}
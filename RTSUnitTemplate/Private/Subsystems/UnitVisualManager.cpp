@@ -3,6 +3,7 @@
 #include "MassEntityManager.h"
 #include "MassEntitySubsystem.h"
 #include "Mass/MassUnitVisualFragments.h"
+#include "Mass/MassVisualEffectCustomData.h"
 #include "Engine/World.h"
 #include "Engine/StaticMesh.h"
 #include "UObject/UObjectIterator.h"
@@ -119,7 +120,8 @@ void UUnitVisualManager::AssignUnitVisual(FMassEntityHandle Entity, UInstancedSt
 	// Never inherit a too-small value from the editor template. The animation processor needs 13
 	// custom-data floats (indices 1..12); clamp up so a misconfigured template can't undersize the
 	// pooled ISM and force a destructive runtime resize later (which would zero all instances).
-	ISM->SetNumCustomDataFloats(FMath::Max(13, TemplateISM->NumCustomDataFloats));
+	// With GPU periodic effects the effect block follows (see MassVisualEffectCustomData.h).
+	ISM->SetNumCustomDataFloats(FMath::Max(VisualEffectCustomData::GetRequiredCustomDataFloats(), TemplateISM->NumCustomDataFloats));
 
 	// Map ISM instance to MassUnitBase
 	TArray<TWeakObjectPtr<AMassUnitBase>>& UnitArray = ISMToUnitMap.FindOrAdd(ISM);
@@ -420,7 +422,7 @@ UInstancedStaticMeshComponent* UUnitVisualManager::GetOrCreateISM(UStaticMesh* M
     // Pre-size custom data ONCE, before any instance is added (so nothing is wiped). The animation
     // processor writes custom-data indices 1..12, i.e. it needs 13 floats. Doing this here means it
     // never has to resize a live, shared ISM at runtime (which would zero EVERY instance's data).
-    NewISM->SetNumCustomDataFloats(13);
+    NewISM->SetNumCustomDataFloats(VisualEffectCustomData::GetRequiredCustomDataFloats());
     if (Material) {
         NewISM->SetMaterial(0, Material);
     }
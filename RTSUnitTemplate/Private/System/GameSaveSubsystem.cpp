@@ -518,6 +518,7 @@ void UGameSaveSubsystem::ApplyLoadedData(UWorld* LoadedWorld, URTSSaveGame* Save
         {
             LevelUnit->LevelData = SavedUnit.LevelData;
             LevelUnit->LevelUpData = SavedUnit.LevelUpData;
+            LevelUnit->NotifyLevelDataChanged();
 
             // Restore the radial attribute-tree bookkeeping as raw state. We deliberately do NOT
             // call InvestInAttributeTreeNode here: the GAS attribute values are re-applied below via
@@ -0,0 +1,297 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "System/PlacementIndexSubsystem.h"
+#include "Actors/WorkArea.h"
+#include "Characters/Unit/BuildingBase.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Mass/MassActorBindingComponent.h"
+
+namespace PlacementIndex
+{
+	// Cell edge length in cm. Structures are a few hundred units wide, snap radii a bit more.
+	constexpr float CellSize = 1000.f;
+	// Structures spanning more cells than this are kept in a separate list instead of being filed.
+	constexpr int32 MaxCellsPerEntry = 256;
+}
+
+void UPlacementIndexSubsystem::Deinitialize()
+{
+	for (const FEntry& Entry : Entries)
+	{
+		if (USceneComponent* Root = Entry.Root.Get())
+		{
+			Root->TransformUpdated.RemoveAll(this);
+		}
+	}
+	Entries.Reset();
+	FreeEntries.Reset();
+	EntryByActor.Reset();
+	EntryByRoot.Reset();
+	Cells.Reset();
+	OversizedEntries.Reset();
+	DirtyEntries.Reset();
+	Super::Deinitialize();
+}
+
+void UPlacementIndexSubsystem::RegisterStructure(AActor* Structure)
+{
+	if (!Structure || EntryByActor.Contains(Structure))
+	{
+		return;
+	}
+
+	const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop() : Entries.AddDefaulted();
+	FEntry& Entry = Entries[EntryIndex];
+	Entry = FEntry();
+	Entry.Actor = Structure;
+	Entry.bWorkArea = Structure->IsA<AWorkArea>();
+	Entry.bUsed = true;
+	EntryByActor.Add(Structure, EntryIndex);
+
+	if (USceneComponent* Root = Structure->GetRootComponent())
+	{
+		Entry.Root = Root;
+		EntryByRoot.Add(Root, EntryIndex);
+		Root->TransformUpdated.AddUObject(this, &UPlacementIndexSubsystem::OnStructureTransformUpdated);
+	}
+
+	FileEntry(EntryIndex);
+}
+
+void UPlacementIndexSubsystem::UnregisterStructure(AActor* Structure)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!Structure || !EntryByActor.RemoveAndCopyValue(Structure, EntryIndex))
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[EntryIndex];
+	if (USceneComponent* Root = Entry.Root.Get())
+	{
+		Root->TransformUpdated.RemoveAll(this);
+		EntryByRoot.Remove(Root);
+	}
+	UnfileEntry(EntryIndex);
+	Entry = FEntry();
+	FreeEntries.Add(EntryIndex);
+}
+
+void UPlacementIndexSubsystem::QueryNearby(const FVector& Center, float Radius, TArray<AActor*>& OutStructures, EPlacementIndexFilter Filter)
+{
+	RefileDirtyEntries();
+
+	const FVector2D Center2D(Center.X, Center.Y);
+	const FBox2D QueryBox(Center2D - FVector2D(Radius), Center2D + FVector2D(Radius));
+	++QueryStamp;
+
+	auto Consider = [&](int32 EntryIndex)
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		if (Entry.QueryStamp == QueryStamp)
+		{
+			return;
+		}
+		Entry.QueryStamp = QueryStamp;
+
+		const EPlacementIndexFilter Kind = Entry.bWorkArea ? EPlacementIndexFilter::WorkAreas : EPlacementIndexFilter::Buildings;
+		if (!EnumHasAnyFlags(Filter, Kind) || !Entry.Reach.Intersect(QueryBox))
+		{
+			return;
+		}
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			OutStructures.Add(Actor);
+		}
+	};
+
+	const FIntPoint Min = ToCell(QueryBox.Min);
+	const FIntPoint Max = ToCell(QueryBox.Max);
+	if ((int64(Max.X - Min.X) + 1) * (int64(Max.Y - Min.Y) + 1) > Entries.Num())
+	{
+		// Query wider than the population: testing every entry is cheaper than walking the cells.
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+		{
+			if (Entries[EntryIndex].bUsed)
+			{
+				Consider(EntryIndex);
+			}
+		}
+		return;
+	}
+
+	for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+	{
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			if (const TArray<int32>* Cell = Cells.Find(FIntPoint(X, Y)))
+			{
+				for (const int32 EntryIndex : *Cell)
+				{
+					Consider(EntryIndex);
+				}
+			}
+		}
+	}
+	for (const int32 EntryIndex : OversizedEntries)
+	{
+		Consider(EntryIndex);
+	}
+}
+
+void UPlacementIndexSubsystem::GetAllWorkAreas(TArray<AActor*>& OutWorkAreas) const
+{
+	for (const FEntry& Entry : Entries)
+	{
+		if (Entry.bUsed && Entry.bWorkArea)
+		{
+			if (AActor* Actor = Entry.Actor.Get())
+			{
+				OutWorkAreas.Add(Actor);
+			}
+		}
+	}
+}
+
+bool UPlacementIndexSubsystem::GetStructureBounds(AActor* Actor, FVector& OutCenter, FVector& OutExtent)
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	// Prefer explicit mesh on WorkArea
+	if (AWorkArea* WA = Cast<AWorkArea>(Actor))
+	{
+		if (WA->Mesh)
+		{
+			const FBoxSphereBounds B = WA->Mesh->CalcBounds(WA->Mesh->GetComponentTransform());
+			OutCenter = B.Origin;
+			OutExtent = B.BoxExtent;
+			return true;
+		}
+	}
+
+	// For buildings: approximate footprint as a square using the capsule radius (radius*2 side length)
+	if (ABuildingBase* Bld = Cast<ABuildingBase>(Actor))
+	{
+		if (UCapsuleComponent* Capsule = Bld->FindComponentByClass<UCapsuleComponent>())
+		{
+			float R = Capsule->GetScaledCapsuleRadius();
+			if (Bld->MassActorBindingComponent)
+			{
+				R += Bld->MassActorBindingComponent->AdditionalCapsuleRadius;
+			}
+			OutCenter = Bld->GetActorLocation();
+			// Use radius for XY half-extents; keep Z from capsule half-height
+			OutExtent.X = R;
+			OutExtent.Y = R;
+			OutExtent.Z = Capsule->GetScaledCapsuleHalfHeight();
+			return true;
+		}
+	}
+
+	// Otherwise, fall back to aggregate component bounds (works for ISM as well)
+	const FBox CompBox = Actor->GetComponentsBoundingBox(/*bNonColliding=*/true);
+	OutCenter = CompBox.GetCenter();
+	OutExtent = CompBox.GetExtent();
+	return true;
+}
+
+void UPlacementIndexSubsystem::OnStructureTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	const int32* EntryIndex = EntryByRoot.Find(UpdatedComponent);
+	if (EntryIndex && !Entries[*EntryIndex].bDirty)
+	{
+		Entries[*EntryIndex].bDirty = true;
+		DirtyEntries.Add(*EntryIndex);
+	}
+}
+
+void UPlacementIndexSubsystem::FileEntry(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	AActor* Actor = Entry.Actor.Get();
+	if (!Actor)
+	{
+		return;
+	}
+
+	FVector Center, Extent;
+	if (!GetStructureBounds(Actor, Center, Extent))
+	{
+		Center = Actor->GetActorLocation();
+		Extent = FVector::ZeroVector;
+	}
+	const FVector Location = Actor->GetActorLocation();
+	const float HalfXY = FMath::Max(Extent.X, Extent.Y);
+
+	Entry.Reach = FBox2D(FVector2D(Center.X - HalfXY, Center.Y - HalfXY), FVector2D(Center.X + HalfXY, Center.Y + HalfXY));
+	Entry.Reach += FBox2D(FVector2D(Location.X - HalfXY, Location.Y - HalfXY), FVector2D(Location.X + HalfXY, Location.Y + HalfXY));
+
+	const FIntPoint Min = ToCell(Entry.Reach.Min);
+	const FIntPoint Max = ToCell(Entry.Reach.Max);
+	Entry.Cells = FIntRect(Min, Max);
+	Entry.bOversized = (int64(Max.X - Min.X) + 1) * (int64(Max.Y - Min.Y) + 1) > PlacementIndex::MaxCellsPerEntry;
+
+	if (Entry.bOversized)
+	{
+		OversizedEntries.Add(EntryIndex);
+		return;
+	}
+	for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+	{
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(EntryIndex);
+		}
+	}
+}
+
+void UPlacementIndexSubsystem::UnfileEntry(int32 EntryIndex)
+{
+	const FEntry& Entry = Entries[EntryIndex];
+	if (Entry.bOversized)
+	{
+		OversizedEntries.RemoveSingleSwap(EntryIndex);
+		return;
+	}
+	for (int32 Y = Entry.Cells.Min.Y; Y <= Entry.Cells.Max.Y; ++Y)
+	{
+		for (int32 X = Entry.Cells.Min.X; X <= Entry.Cells.Max.X; ++X)
+		{
+			const FIntPoint Key(X, Y);
+			if (TArray<int32>* Cell = Cells.Find(Key))
+			{
+				Cell->RemoveSingleSwap(EntryIndex);
+				if (Cell->IsEmpty())
+				{
+					Cells.Remove(Key);
+				}
+			}
+		}
+	}
+}
+
+void UPlacementIndexSubsystem::RefileDirtyEntries()
+{
+	for (const int32 EntryIndex : DirtyEntries)
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		if (!Entry.bUsed || !Entry.bDirty)
+		{
+			continue;
+		}
+		Entry.bDirty = false;
+		UnfileEntry(EntryIndex);
+		FileEntry(EntryIndex);
+	}
+	DirtyEntries.Reset();
+}
+
+FIntPoint UPlacementIndexSubsystem::ToCell(const FVector2D& Location)
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / PlacementIndex::CellSize),
+		FMath::FloorToInt(Location.Y / PlacementIndex::CellSize));
+}
@@ -0,0 +1,138 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "System/ProjectilePoolSubsystem.h"
+#include "Actors/Projectile.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+static TAutoConsoleVariable<int32> CVarRTS_ProjectilePoolEnable(
+	TEXT("RTS.ProjectilePool.Enable"),
+	1,
+	TEXT("1 = recycle actor projectiles per class, 0 = spawn and destroy one actor per shot."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_ProjectilePoolPrewarmCount(
+	TEXT("RTS.ProjectilePool.PrewarmCount"),
+	16,
+	TEXT("Projectiles parked in advance the first time a projectile class is fired."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRTS_ProjectilePoolMaxPerClass(
+	TEXT("RTS.ProjectilePool.MaxPerClass"),
+	256,
+	TEXT("Parked projectiles kept per class; released projectiles beyond this are destroyed."),
+	ECVF_Default);
+
+void UProjectilePoolSubsystem::Deinitialize()
+{
+	Parked.Reset();
+	Super::Deinitialize();
+}
+
+AProjectile* UProjectilePoolSubsystem::AcquireProjectile(TSubclassOf<AProjectile> ProjectileClass, const FTransform& Transform)
+{
+	if (!ProjectileClass)
+	{
+		return nullptr;
+	}
+	if (CVarRTS_ProjectilePoolEnable.GetValueOnGameThread() == 0)
+	{
+		return SpawnDeferred(ProjectileClass, Transform);
+	}
+
+	TArray<TWeakObjectPtr<AProjectile>>* ClassPool = Parked.Find(ProjectileClass.Get());
+	if (!ClassPool)
+	{
+		PreWarm(ProjectileClass, CVarRTS_ProjectilePoolPrewarmCount.GetValueOnGameThread());
+		ClassPool = &Parked.FindOrAdd(ProjectileClass.Get());
+	}
+
+	while (ClassPool->Num() > 0)
+	{
+		AProjectile* Projectile = ClassPool->Pop().Get();
+		if (IsValid(Projectile))
+		{
+			Projectile->LeavePool(Transform);
+			++NumReused;
+			return Projectile;
+		}
+	}
+	return SpawnDeferred(ProjectileClass, Transform);
+}
+
+void UProjectilePoolSubsystem::FinishProjectile(AProjectile* Projectile, const FTransform& Transform)
+{
+	// Init* may already have handed the projectile back (e.g. a zero-length aim).
+	if (!IsValid(Projectile) || Projectile->IsInPool())
+	{
+		return;
+	}
+	if (!Projectile->IsActorInitialized())
+	{
+		UGameplayStatics::FinishSpawningActor(Projectile, Transform);
+		return;
+	}
+	Projectile->Relaunch(Transform);
+}
+
+void UProjectilePoolSubsystem::ReleaseProjectile(AProjectile* Projectile)
+{
+	if (!IsValid(Projectile) || Projectile->IsInPool())
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<AProjectile>>& ClassPool = Parked.FindOrAdd(Projectile->GetClass());
+	if (CVarRTS_ProjectilePoolEnable.GetValueOnGameThread() == 0
+		|| !Projectile->IsActorInitialized()
+		|| ClassPool.Num() >= CVarRTS_ProjectilePoolMaxPerClass.GetValueOnGameThread())
+	{
+		Projectile->Destroy(true, false);
+		return;
+	}
+
+	Projectile->EnterPool();
+	ClassPool.Add(Projectile);
+}
+
+void UProjectilePoolSubsystem::PreWarm(TSubclassOf<AProjectile> ProjectileClass, int32 Count)
+{
+	if (!ProjectileClass)
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<AProjectile>>& ClassPool = Parked.FindOrAdd(ProjectileClass.Get());
+	ClassPool.RemoveAll([](const TWeakObjectPtr<AProjectile>& Projectile) { return !Projectile.IsValid(); });
+
+	// Parked projectiles wait far below the map until they are relaunched.
+	const FTransform ParkTransform(FVector(0.f, 0.f, -100000.f));
+	for (int32 Missing = Count - ClassPool.Num(); Missing > 0; --Missing)
+	{
+		AProjectile* Projectile = SpawnDeferred(ProjectileClass, ParkTransform);
+		if (!Projectile)
+		{
+			return;
+		}
+		UGameplayStatics::FinishSpawningActor(Projectile, ParkTransform);
+		Projectile->EnterPool();
+		ClassPool.Add(Projectile);
+	}
+}
+
+int32 UProjectilePoolSubsystem::GetNumParked(TSubclassOf<AProjectile> ProjectileClass) const
+{
+	const TArray<TWeakObjectPtr<AProjectile>>* ClassPool = Parked.Find(ProjectileClass.Get());
+	return ClassPool ? ClassPool->Num() : 0;
+}
+
+AProjectile* UProjectilePoolSubsystem::SpawnDeferred(TSubclassOf<AProjectile> ProjectileClass, const FTransform& Transform)
+{
+	AProjectile* Projectile = Cast<AProjectile>(UGameplayStatics::BeginDeferredActorSpawnFromClass(
+		GetWorld(), ProjectileClass, Transform, ESpawnActorCollisionHandlingMethod::AlwaysSpawn));
+	if (Projectile)
+	{
+		++NumSpawned;
+	}
+	return Projectile;
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#include "System/UnitIndexSubsystem.h"
+#include "Characters/Unit/UnitBase.h"
+#include <climits>
+
+void UUnitIndexSubsystem::Deinitialize()
+{
+	Roster.Reset();
+	Units.Reset();
+	FreeHandles.Reset();
+	HandleByUnit.Reset();
+	Super::Deinitialize();
+}
+
+void UUnitIndexSubsystem::RegisterUnit(AUnitBase* Unit)
+{
+	if (!Unit || HandleByUnit.Contains(Unit))
+	{
+		return;
+	}
+
+	const int32 Handle = FreeHandles.Num() > 0 ? FreeHandles.Pop() : Units.AddDefaulted();
+	Units[Handle] = Unit;
+	HandleByUnit.Add(Unit, Handle);
+	Roster.Add(Handle, MakeKey(Unit));
+}
+
+void UUnitIndexSubsystem::UnregisterUnit(AUnitBase* Unit)
+{
+	int32 Handle = INDEX_NONE;
+	if (!Unit || !HandleByUnit.RemoveAndCopyValue(Unit, Handle))
+	{
+		return;
+	}
+
+	Roster.Remove(Handle);
+	Units[Handle].Reset();
+	FreeHandles.Add(Handle);
+}
+
+void UUnitIndexSubsystem::NotifyUnitChanged(AUnitBase* Unit)
+{
+	if (const int32* Handle = Unit ? HandleByUnit.Find(Unit) : nullptr)
+	{
+		Roster.Update(*Handle, MakeKey(Unit));
+	}
+}
+
+AUnitBase* UUnitIndexSubsystem::FindByUnitIndex(int32 UnitIndex)
+{
+	SyncKeys();
+	return GetUnit(Roster.FindByUnitIndex(UnitIndex));
+}
+
+AUnitBase* UUnitIndexSubsystem::FindSquadHealthbarOwner(int32 TeamId, int32 SquadId)
+{
+	AUnitBase* Best = nullptr;
+	int32 BestIndex = TNumericLimits<int32>::Max();
+	ForEachSquadMember(TeamId, SquadId, [&Best, &BestIndex](AUnitBase* U)
+	{
+		if (U->GetUnitState() == UnitData::Dead) return;
+		int32 Index = U->UnitIndex;
+		if (Index < 0) Index = INT_MAX - 1; // push invalids back
+		if (!Best || Index < BestIndex)
+		{
+			Best = U;
+			BestIndex = Index;
+		}
+	});
+	return Best;
+}
+
+FUnitRosterKey UUnitIndexSubsystem::MakeKey(const AUnitBase* Unit) const
+{
+	FUnitRosterKey Key;
+	Key.TeamId = Unit->TeamId;
+	Key.SquadId = Unit->SquadId;
+	Key.UnitIndex = Unit->UnitIndex;
+	return Key;
+}
+
+AUnitBase* UUnitIndexSubsystem::GetUnit(int32 Handle) const
+{
+	if (!Roster.Contains(Handle))
+	{
+		return nullptr;
+	}
+	AUnitBase* Unit = Units[Handle].Get();
+	return IsValid(Unit) ? Unit : nullptr;
+}
+
+void UUnitIndexSubsystem::SyncKeys()
+{
+	if (LastSyncFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastSyncFrame = GFrameCounter;
+
+	for (int32 Handle = 0; Handle < Units.Num(); ++Handle)
+	{
+		if (!Roster.Contains(Handle))
+		{
+			continue;
+		}
+		if (const AUnitBase* Unit = Units[Handle].Get())
+		{
+			Roster.Update(Handle, MakeKey(Unit));
+		}
+	}
+}
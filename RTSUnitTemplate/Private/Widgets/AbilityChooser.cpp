@@ -5,6 +5,7 @@
 #include "Controller/PlayerController/ControllerBase.h"
 #include "Controller/PlayerController/ExtendedControllerBase.h"
 #include "Widgets/AbilityButton.h"
+#include "System/HudEventSubsystem.h"
 
 void UAbilityChooser::NativeConstruct()
 {
@@ -18,6 +19,12 @@ void UAbilityChooser::NativeConstruct()
     SetVisibility(ESlateVisibility::Hidden);
 }
 
+void UAbilityChooser::NativeDestruct()
+{
+    StopTimer();
+    Super::NativeDestruct();
+}
+
 void UAbilityChooser::InitWidget(ACustomControllerBase* InController)
 {
     if (InController)
@@ -40,16 +47,43 @@ void UAbilityChooser::SetOwnerActor(AAbilityUnit* NewOwner)
 
 void UAbilityChooser::StartUpdateTimer()
 {
-    // Set a repeating timer to call NativeTick at a regular interval based on UpdateInterval
-    GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UAbilityChooser::UpdateAbilityDisplay, UpdateInterval, true);
+    if (!UnitProgressHandle.IsValid())
+    {
+        if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+        {
+            UnitProgressHandle = HudEvents->OnUnitProgressChanged.AddUObject(this, &UAbilityChooser::OnUnitProgressChanged);
+        }
+    }
+    UpdateAbilityDisplay();
 }
 
 void UAbilityChooser::StopTimer()
 {
-    // Check if the timer is currently active before attempting to clear it
-    if (GetWorld()->GetTimerManager().IsTimerActive(UpdateTimerHandle))
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (UHudEventSubsystem* HudEvents = World->GetSubsystem<UHudEventSubsystem>())
+    {
+        HudEvents->OnUnitProgressChanged.Remove(UnitProgressHandle);
+    }
+    UnitProgressHandle.Reset();
+    World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+}
+
+void UAbilityChooser::OnUnitProgressChanged(ALevelUnit* Unit)
+{
+    if (!OwnerAbilityUnit || Unit != OwnerAbilityUnit)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    if (!TimerManager.TimerExists(UpdateTimerHandle))
     {
-        GetWorld()->GetTimerManager().ClearTimer(UpdateTimerHandle);
+        UpdateTimerHandle = TimerManager.SetTimerForNextTick(this, &UAbilityChooser::UpdateAbilityDisplay);
     }
 }
 
@@ -9,6 +9,7 @@
 #include "Components/VerticalBox.h"
 #include "Engine/Engine.h" // For UEnum
 #include "Engine/Texture2D.h"
+#include "System/HudEventSubsystem.h"
 
 UResourceWidget::UResourceWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -28,6 +29,12 @@ void UResourceWidget::NativeConstruct()
     UpdateWidget();
 }
 
+void UResourceWidget::NativeDestruct()
+{
+    StopTimer();
+    Super::NativeDestruct();
+}
+
 
 void UResourceWidget::SetTeamId(int32 Id)
 {
@@ -47,12 +54,51 @@ void UResourceWidget::UpdateTeamIdText()
 
 void UResourceWidget::StartUpdateTimer()
 {
-    GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UResourceWidget::UpdateWidget, UpdateInterval, true);
+    UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>();
+    if (!HudEvents || ResourcesChangedHandle.IsValid())
+    {
+        return;
+    }
+
+    ResourcesChangedHandle = HudEvents->OnResourcesChanged.AddUObject(this, &UResourceWidget::OnResourcesChanged);
+    OnResourcesChanged(); // Catch up on changes made while not listening
 }
 
 void UResourceWidget::StopTimer()
 {
-    GetWorld()->GetTimerManager().ClearTimer(UpdateTimerHandle);
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (UHudEventSubsystem* HudEvents = World->GetSubsystem<UHudEventSubsystem>())
+    {
+        HudEvents->OnResourcesChanged.Remove(ResourcesChangedHandle);
+    }
+    ResourcesChangedHandle.Reset();
+    World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+}
+
+void UResourceWidget::OnResourcesChanged()
+{
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    if (TimerManager.TimerExists(UpdateTimerHandle))
+    {
+        return;
+    }
+
+    UpdateTimerHandle = TimerManager.SetTimerForNextTick(this, &UResourceWidget::RefreshResources);
+}
+
+void UResourceWidget::RefreshResources()
+{
+    // The game state may have replicated after NativeConstruct/SetTeamId tried to populate the list
+    if (ResourceEntriesBox && ResourceEntriesBox->GetChildrenCount() == 0)
+    {
+        PopulateResourceList();
+    }
+    UpdateWidget();
 }
 
 void UResourceWidget::PopulateResourceList()
@@ -5,7 +5,7 @@
 #include <Components/TextBlock.h>
 #include "Characters/Unit/UnitBase.h"
 #include "GAS/AttributeSetBase.h"
-#include "EngineUtils.h"
+#include "System/UnitIndexSubsystem.h"
 
 void USquadHealthBar::UpdateWidget()
 {
@@ -85,18 +85,18 @@ void USquadHealthBar::ComputeSquadHealth(float& OutCurrentHealth, float& OutMaxH
 
 	UWorld* World = OwnerCharacter->GetWorld();
 	if (!World) return;
+	UUnitIndexSubsystem* UnitIndexSubsystem = World->GetSubsystem<UUnitIndexSubsystem>();
+	if (!UnitIndexSubsystem) return;
 
 	// Sum current values from alive/valid units only
-	for (TActorIterator<AUnitBase> It(World); It; ++It)
+	UnitIndexSubsystem->ForEachSquadMember(Team, Squad, [&](AUnitBase* Unit)
 	{
-		AUnitBase* Unit = *It;
-		if (!Unit || Unit->IsActorBeingDestroyed()) continue;
-		if (Unit->TeamId != Team || Unit->SquadId != Squad) continue;
+		if (Unit->IsActorBeingDestroyed()) return;
 		
 		// Recalculate based on remaining units: skip dead units for both Current and Max totals
-		if (Unit->GetUnitState() == UnitData::Dead) continue;
+		if (Unit->GetUnitState() == UnitData::Dead) return;
 		
-		if (!Unit->Attributes) continue;
+		if (!Unit->Attributes) return;
 
 		const float UnitMaxH = FMath::Max(0.f, Unit->Attributes->GetMaxHealth());
 		const float UnitMaxS = FMath::Max(0.f, Unit->Attributes->GetMaxShield());
@@ -106,5 +106,5 @@ void USquadHealthBar::ComputeSquadHealth(float& OutCurrentHealth, float& OutMaxH
 
 		OutCurrentHealth += FMath::Clamp(Unit->Attributes->GetHealth(), 0.f, UnitMaxH);
 		OutCurrentShield += FMath::Clamp(Unit->Attributes->GetShield(), 0.f, UnitMaxS);
-	}
+	});
 }
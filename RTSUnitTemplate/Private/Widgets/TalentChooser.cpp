@@ -7,6 +7,8 @@
 #include "Components/VerticalBox.h"
 #include "Controller/PlayerController/ControllerBase.h"
 #include "GameFramework/GameSession.h"
+#include "AbilitySystemComponent.h"
+#include "System/HudEventSubsystem.h"
 
 void UTalentChooser::NativeConstruct()
 {
@@ -18,6 +20,22 @@ void UTalentChooser::NativeConstruct()
 
     SetVisibility(ESlateVisibility::Hidden);
 }
+
+void UTalentChooser::NativeDestruct()
+{
+    StopTimer();
+    Super::NativeDestruct();
+}
+
+void UTalentChooser::SetOwnerActor(ALevelUnit* Unit)
+{
+    OwnerUnitBase = Unit;
+    if (UnitProgressHandle.IsValid())
+    {
+        WatchTalentAttributes();
+        RequestUpdate();
+    }
+}
 /*
 void UTalentChooser::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
@@ -37,17 +55,93 @@ void UTalentChooser::UpdateWidget()
 
 void UTalentChooser::StartUpdateTimer()
 {
-    // Set a repeating timer to call NativeTick at a regular interval based on UpdateInterval
-    GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UTalentChooser::UpdateWidget, UpdateInterval, true);
+    if (!UnitProgressHandle.IsValid())
+    {
+        if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+        {
+            UnitProgressHandle = HudEvents->OnUnitProgressChanged.AddUObject(this, &UTalentChooser::OnUnitProgressChanged);
+        }
+    }
+    WatchTalentAttributes();
+    UpdateWidget();
 }
 
 void UTalentChooser::StopTimer()
 {
-    // Check if the timer is currently active before attempting to clear it
-    if (GetWorld()->GetTimerManager().IsTimerActive(UpdateTimerHandle))
+    UnwatchTalentAttributes();
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (UHudEventSubsystem* HudEvents = World->GetSubsystem<UHudEventSubsystem>())
+    {
+        HudEvents->OnUnitProgressChanged.Remove(UnitProgressHandle);
+    }
+    UnitProgressHandle.Reset();
+    World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+}
+
+void UTalentChooser::OnUnitProgressChanged(ALevelUnit* Unit)
+{
+    if (OwnerUnitBase && Unit == OwnerUnitBase)
     {
-        GetWorld()->GetTimerManager().ClearTimer(UpdateTimerHandle);
+        RequestUpdate();
+    }
+}
+
+void UTalentChooser::OnTalentAttributeChanged(const FOnAttributeChangeData& Data)
+{
+    RequestUpdate();
+}
+
+void UTalentChooser::RequestUpdate()
+{
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    if (!TimerManager.TimerExists(UpdateTimerHandle))
+    {
+        UpdateTimerHandle = TimerManager.SetTimerForNextTick(this, &UTalentChooser::UpdateWidget);
+    }
+}
+
+void UTalentChooser::WatchTalentAttributes()
+{
+    UnwatchTalentAttributes();
+
+    UAbilitySystemComponent* ASC = OwnerUnitBase ? OwnerUnitBase->GetAbilitySystemComponent() : nullptr;
+    if (!ASC)
+    {
+        return;
+    }
+
+    WatchedAbilitySystem = ASC;
+    const FGameplayAttribute TalentAttributes[] = {
+        UAttributeSetBase::GetStaminaAttribute(),
+        UAttributeSetBase::GetAttackPowerAttribute(),
+        UAttributeSetBase::GetWillpowerAttribute(),
+        UAttributeSetBase::GetHasteAttribute(),
+        UAttributeSetBase::GetArmorAttribute(),
+        UAttributeSetBase::GetMagicResistanceAttribute()
+    };
+    for (const FGameplayAttribute& Attribute : TalentAttributes)
+    {
+        WatchedAttributes.Emplace(Attribute, ASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UTalentChooser::OnTalentAttributeChanged));
+    }
+}
+
+void UTalentChooser::UnwatchTalentAttributes()
+{
+    if (UAbilitySystemComponent* ASC = WatchedAbilitySystem.Get())
+    {
+        for (const TPair<FGameplayAttribute, FDelegateHandle>& Watched : WatchedAttributes)
+        {
+            ASC->GetGameplayAttributeValueChangeDelegate(Watched.Key).Remove(Watched.Value);
+        }
     }
+    WatchedAbilitySystem.Reset();
+    WatchedAttributes.Reset();
 }
 
 void UTalentChooser::UpdateProgressBars()
@@ -6,6 +6,7 @@
 #include "Containers/Set.h"
 #include "GAS/GameplayAbilityBase.h"
 #include "AbilitySystemComponent.h"
+#include "System/HudEventSubsystem.h"
 
 
 
@@ -19,6 +20,25 @@ void UUnitWidgetSelector::NativeConstruct()
 	SetButtonLabelCount(ShowButtonCount);;
 }
 
+void UUnitWidgetSelector::NativeDestruct()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UHudEventSubsystem* HudEvents = World->GetSubsystem<UHudEventSubsystem>())
+		{
+			HudEvents->OnSelectionChanged.Remove(SelectionChangedHandle);
+			HudEvents->OnAbilityCooldownChanged.Remove(AbilityCooldownHandle);
+		}
+	}
+	SelectionChangedHandle.Reset();
+	AbilityCooldownHandle.Reset();
+
+	UnwatchCooldownTags();
+	StopUpdateTimer();
+
+	Super::NativeDestruct();
+}
+
 
 FText UUnitWidgetSelector::ReplaceRarityKeywords(
 	FText OriginalText,
@@ -52,11 +72,21 @@ void UUnitWidgetSelector::UpdateSelectedUnits()
 		SetUnitIcons(ControllerBase->SelectedUnits);
 
 		Update(ControllerBase->AbilityArrayIndex);
+
+		// Cooldowns of the previous unit or ability page no longer apply
+		UnwatchCooldownTags();
+		CooldownEndTimes.Init(0.f, AbilityCooldownTexts.Num());
+		ShownCooldownSeconds.Init(INDEX_NONE, AbilityCooldownTexts.Num());
+		for (UTextBlock* CooldownText : AbilityCooldownTexts)
+		{
+			if (CooldownText) CooldownText->SetText(FText::GetEmpty());
+		}
 		
-		if (!ControllerBase->SelectedUnits.Num()) return;
-		if (ControllerBase->CurrentUnitWidgetIndex < 0 || ControllerBase->CurrentUnitWidgetIndex >= ControllerBase->SelectedUnits.Num()) return;
-		if (!ControllerBase->SelectedUnits[ControllerBase->CurrentUnitWidgetIndex]) return;
-		if (!ControllerBase->SelectedUnits.IsValidIndex(ControllerBase->CurrentUnitWidgetIndex)) return;
+		if (!ControllerBase->SelectedUnits.IsValidIndex(ControllerBase->CurrentUnitWidgetIndex) || !ControllerBase->SelectedUnits[ControllerBase->CurrentUnitWidgetIndex])
+		{
+			StopUpdateTimer();
+			return;
+		}
 		
 		bool bHasSelected = false;
 		if (ControllerBase)
@@ -86,11 +116,26 @@ void UUnitWidgetSelector::UpdateSelectedUnits()
 
 		UpdateAbilityButtonsState();
 		UpdateAbilityCooldowns();
+		WatchCooldownTags(ControllerBase->SelectedUnits[ControllerBase->CurrentUnitWidgetIndex]);
 		UpdateCurrentAbility();
 		UpdateQueuedAbilityIcons();
+		StartUpdateTimer();
 	}
 }
 
+void UUnitWidgetSelector::UpdateCurrentUnit()
+{
+	if (!ControllerBase || !ControllerBase->SelectedUnits.IsValidIndex(ControllerBase->CurrentUnitWidgetIndex))
+	{
+		StopUpdateTimer();
+		return;
+	}
+
+	UpdateCurrentAbility();
+	UpdateQueuedAbilityIcons();
+	UpdateCooldownCountdown();
+}
+
 void UUnitWidgetSelector::UpdateCurrentAbility()
 {
 	if (!ControllerBase->SelectedUnits.IsValidIndex(ControllerBase->CurrentUnitWidgetIndex)) return;
@@ -152,6 +197,13 @@ void UUnitWidgetSelector::UpdateCurrentAbility()
  */
 void UUnitWidgetSelector::SetWidgetCooldown(int32 AbilityIndex, float RemainingTime)
 {
+    // Remember when the cooldown ends, UpdateCooldownCountdown counts down locally until then
+    if (CooldownEndTimes.IsValidIndex(AbilityIndex) && ShownCooldownSeconds.IsValidIndex(AbilityIndex))
+    {
+        CooldownEndTimes[AbilityIndex] = GetWorld()->GetTimeSeconds() + FMath::Max(RemainingTime, 0.f);
+        ShownCooldownSeconds[AbilityIndex] = RemainingTime > 0.f ? FMath::RoundToInt(RemainingTime) : INDEX_NONE;
+    }
+
     if (RemainingTime > 0.f)
     {
         // Format to one decimal place for a smoother countdown look
@@ -172,40 +224,111 @@ void UUnitWidgetSelector::SetWidgetCooldown(int32 AbilityIndex, float RemainingT
 }
 
 
+void UUnitWidgetSelector::UpdateCooldownCountdown()
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+	for (int32 AbilityIndex = 0; AbilityIndex < CooldownEndTimes.Num(); ++AbilityIndex)
+	{
+		const float RemainingTime = CooldownEndTimes[AbilityIndex] - Now;
+		const int32 Seconds = RemainingTime > 0.f ? FMath::RoundToInt(RemainingTime) : INDEX_NONE;
+		if (Seconds == ShownCooldownSeconds[AbilityIndex] || !AbilityCooldownTexts.IsValidIndex(AbilityIndex) || !AbilityCooldownTexts[AbilityIndex])
+		{
+			continue;
+		}
+
+		ShownCooldownSeconds[AbilityIndex] = Seconds;
+		AbilityCooldownTexts[AbilityIndex]->SetText(Seconds == INDEX_NONE ? FText::GetEmpty() : FText::AsNumber(Seconds));
+	}
+}
+
 void UUnitWidgetSelector::UpdateAbilityCooldowns()
 {
+	if (!ControllerBase)
+		return;
 
+	const int32 AbilityCount = FMath::Min(ControllerBase->GetAbilityArrayByIndex().Num(), MaxAbilityButtonCount);
+	for (int32 AbilityIndex = 0; AbilityIndex < AbilityCount; ++AbilityIndex)
+	{
+		RequestAbilityCooldown(AbilityIndex);
+	}
+}
+
+void UUnitWidgetSelector::RequestAbilityCooldown(int32 AbilityIndex)
+{
 	if (!ControllerBase || !ControllerBase->SelectedUnits.IsValidIndex(ControllerBase->CurrentUnitWidgetIndex))
 		return;
-	
-	
-	TArray<TSubclassOf<UGameplayAbilityBase>> AbilityArray = ControllerBase->GetAbilityArrayByIndex();
-	
 
-	AUnitBase* SelectedUnit = ControllerBase->SelectedUnits[ControllerBase->CurrentUnitWidgetIndex];
+	const TArray<TSubclassOf<UGameplayAbilityBase>> AbilityArray = ControllerBase->GetAbilityArrayByIndex();
+	if (!AbilityArray.IsValidIndex(AbilityIndex) || !AbilityArray[AbilityIndex])
+		return;
+
+	UGameplayAbilityBase* Ability = AbilityArray[AbilityIndex]->GetDefaultObject<UGameplayAbilityBase>();
+	if (!Ability)
+		return;
+
+	ControllerBase->Server_RequestCooldown(ControllerBase->SelectedUnits[ControllerBase->CurrentUnitWidgetIndex], AbilityIndex, Ability);
+}
 
-	// Loop through each ability up to AbilityButtonCount
-	for (int32 AbilityIndex = 0; AbilityIndex < MaxAbilityButtonCount; ++AbilityIndex)
+void UUnitWidgetSelector::WatchCooldownTags(AUnitBase* Unit)
+{
+	UnwatchCooldownTags();
+
+	UAbilitySystemComponent* ASC = Unit ? Unit->GetAbilitySystemComponent() : nullptr;
+	if (!ASC || !ControllerBase)
+		return;
+
+	WatchedAbilitySystem = ASC;
+	const TArray<TSubclassOf<UGameplayAbilityBase>> AbilityArray = ControllerBase->GetAbilityArrayByIndex();
+	for (int32 AbilityIndex = 0; AbilityIndex < AbilityArray.Num() && AbilityIndex < MaxAbilityButtonCount; ++AbilityIndex)
 	{
-		if (!AbilityArray.IsValidIndex(AbilityIndex))
-		{
-			return;
-		}
+		const UGameplayAbilityBase* Ability = AbilityArray[AbilityIndex] ? AbilityArray[AbilityIndex]->GetDefaultObject<UGameplayAbilityBase>() : nullptr;
+		const FGameplayTagContainer* CooldownTags = Ability ? Ability->GetCooldownTags() : nullptr;
+		if (!CooldownTags)
+			continue;
 
-		if (!AbilityArray[AbilityIndex])
+		for (const FGameplayTag& CooldownTag : *CooldownTags)
 		{
-			continue;
+			CooldownTagAbilityIndices.Add(CooldownTag, AbilityIndex);
+			if (!WatchedCooldownTags.Contains(CooldownTag))
+			{
+				WatchedCooldownTags.Add(CooldownTag, ASC->RegisterGameplayTagEvent(CooldownTag, EGameplayTagEventType::NewOrRemoved)
+					.AddUObject(this, &UUnitWidgetSelector::OnCooldownTagChanged));
+			}
 		}
+	}
+}
 
-		UGameplayAbilityBase* Ability = AbilityArray[AbilityIndex]->GetDefaultObject<UGameplayAbilityBase>();
-		if (!Ability)
+void UUnitWidgetSelector::UnwatchCooldownTags()
+{
+	if (UAbilitySystemComponent* ASC = WatchedAbilitySystem.Get())
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& Watched : WatchedCooldownTags)
 		{
-			return;
+			ASC->UnregisterGameplayTagEvent(Watched.Value, Watched.Key, EGameplayTagEventType::NewOrRemoved);
 		}
-		
-		ControllerBase->Server_RequestCooldown(SelectedUnit, AbilityIndex, Ability);
 	}
-    
+	WatchedAbilitySystem.Reset();
+	WatchedCooldownTags.Reset();
+	CooldownTagAbilityIndices.Reset();
+}
+
+void UUnitWidgetSelector::OnCooldownTagChanged(const FGameplayTag CooldownTag, int32 NewCount)
+{
+	// A cooldown started or ended on the focused unit: ask the server for the exact remaining time
+	TArray<int32> AbilityIndices;
+	CooldownTagAbilityIndices.MultiFind(CooldownTag, AbilityIndices);
+	for (const int32 AbilityIndex : AbilityIndices)
+	{
+		RequestAbilityCooldown(AbilityIndex);
+	}
+}
+
+void UUnitWidgetSelector::OnHudSelectionChanged(AControllerBase* Controller)
+{
+	if (Controller == ControllerBase)
+	{
+		UpdateSelectedUnits();
+	}
 }
 
 
@@ -301,8 +424,20 @@ void UUnitWidgetSelector::OnCurrentAbilityButtonClicked()
 
 void UUnitWidgetSelector::StartUpdateTimer()
 {
-	// Set a repeating timer to call NativeTick at a regular interval based on UpdateInterval
-	GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UUnitWidgetSelector::UpdateSelectedUnits, UpdateInterval, true);
+	// Cast bar and ability queue have no change events; poll them only while a unit is selected
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(UpdateTimerHandle))
+	{
+		TimerManager.SetTimer(UpdateTimerHandle, this, &UUnitWidgetSelector::UpdateCurrentUnit, UpdateInterval, true);
+	}
+}
+
+void UUnitWidgetSelector::StopUpdateTimer()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+	}
 }
 
 void UUnitWidgetSelector::InitWidget(ACustomControllerBase* InController)
@@ -310,7 +445,16 @@ void UUnitWidgetSelector::InitWidget(ACustomControllerBase* InController)
 	if (InController)
 	{
 		ControllerBase = InController;
-		StartUpdateTimer(); // Now it's safe to start the timer
+
+		// Redraw on selection changes and server cooldown answers instead of rebuilding on a timer
+		if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+		{
+			HudEvents->OnSelectionChanged.Remove(SelectionChangedHandle);
+			HudEvents->OnAbilityCooldownChanged.Remove(AbilityCooldownHandle);
+			SelectionChangedHandle = HudEvents->OnSelectionChanged.AddUObject(this, &UUnitWidgetSelector::OnHudSelectionChanged);
+			AbilityCooldownHandle = HudEvents->OnAbilityCooldownChanged.AddUObject(this, &UUnitWidgetSelector::SetWidgetCooldown);
+		}
+		UpdateSelectedUnits();
 		UE_LOG(LogTemp, Log, TEXT("UnitWidgetSelector Initialized Successfully!"));
 	}
 	else
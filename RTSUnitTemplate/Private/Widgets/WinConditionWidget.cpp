@@ -5,6 +5,7 @@
 #include "EngineUtils.h"
 #include "Components/RichTextBlock.h"
 #include "Components/Image.h"
+#include "System/HudEventSubsystem.h"
 
 static FString SplitPascalCase(const FString& InString)
 {
@@ -147,20 +148,10 @@ void UWinConditionWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 	
+	// Configs that replicate later are bound in OnHudWinConditionChanged
 	for (TActorIterator<AWinLoseConfigActor> It(GetWorld()); It; ++It)
 	{
-		AWinLoseConfigActor* ConfigActor = *It;
-		if (ConfigActor)
-		{
-			ConfigActor->OnWinConditionChanged.RemoveDynamic(this, &UWinConditionWidget::OnWinConditionChanged);
-			ConfigActor->OnWinConditionChanged.AddDynamic(this, &UWinConditionWidget::OnWinConditionChanged);
-			ConfigActor->OnTagProgressUpdated.RemoveDynamic(this, &UWinConditionWidget::OnTagProgressUpdated);
-			ConfigActor->OnTagProgressUpdated.AddDynamic(this, &UWinConditionWidget::OnTagProgressUpdated);
-			ConfigActor->OnYouWonTheGame.RemoveDynamic(this, &UWinConditionWidget::UpdateConditionText);
-			ConfigActor->OnYouWonTheGame.AddDynamic(this, &UWinConditionWidget::UpdateConditionText);
-			ConfigActor->OnYouLostTheGame.RemoveDynamic(this, &UWinConditionWidget::UpdateConditionText);
-			ConfigActor->OnYouLostTheGame.AddDynamic(this, &UWinConditionWidget::UpdateConditionText);
-		}
+		BindConfigActor(*It);
 	}
 
 	ACameraControllerBase* MyPC = Cast<ACameraControllerBase>(GetOwningPlayer());
@@ -174,32 +165,51 @@ void UWinConditionWidget::NativeConstruct()
 	UpdateConditionText();
 }
 
-void UWinConditionWidget::StartUpdateTimer()
+void UWinConditionWidget::NativeDestruct()
 {
-	if (!GetWorld()) return;
-	GetWorld()->GetTimerManager().SetTimer(UpdateTimerHandle, this, &UWinConditionWidget::UpdateConditionText, UpdateInterval, true);
+	StopTimer();
+	Super::NativeDestruct();
 }
 
-void UWinConditionWidget::StopTimer()
+void UWinConditionWidget::BindConfigActor(AWinLoseConfigActor* ConfigActor)
+{
+	if (!ConfigActor) return;
+
+	ConfigActor->OnYouWonTheGame.RemoveDynamic(this, &UWinConditionWidget::UpdateConditionText);
+	ConfigActor->OnYouWonTheGame.AddDynamic(this, &UWinConditionWidget::UpdateConditionText);
+	ConfigActor->OnYouLostTheGame.RemoveDynamic(this, &UWinConditionWidget::UpdateConditionText);
+	ConfigActor->OnYouLostTheGame.AddDynamic(this, &UWinConditionWidget::UpdateConditionText);
+}
+
+void UWinConditionWidget::StartUpdateTimer()
 {
-	if (GetWorld())
+	if (!GetWorld() || WinConditionChangedHandle.IsValid()) return;
+
+	if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(UpdateTimerHandle);
+		WinConditionChangedHandle = HudEvents->OnWinConditionChanged.AddUObject(this, &UWinConditionWidget::OnHudWinConditionChanged);
 	}
 }
 
-void UWinConditionWidget::OnTeamIdChanged(int32 NewTeamId)
+void UWinConditionWidget::StopTimer()
 {
-	UpdateConditionText();
+	if (!GetWorld()) return;
+
+	if (UHudEventSubsystem* HudEvents = GetWorld()->GetSubsystem<UHudEventSubsystem>())
+	{
+		HudEvents->OnWinConditionChanged.Remove(WinConditionChangedHandle);
+	}
+	WinConditionChangedHandle.Reset();
 }
 
-void UWinConditionWidget::OnWinConditionChanged(AWinLoseConfigActor* Config, EWinLoseCondition NewCondition)
+void UWinConditionWidget::OnTeamIdChanged(int32 NewTeamId)
 {
 	UpdateConditionText();
 }
 
-void UWinConditionWidget::OnTagProgressUpdated(AWinLoseConfigActor* Config)
+void UWinConditionWidget::OnHudWinConditionChanged(AWinLoseConfigActor* Config)
 {
+	BindConfigActor(Config);
 	UpdateConditionText();
 }
 
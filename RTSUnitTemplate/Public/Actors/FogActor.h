@@ -81,6 +81,11 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
 	float FogUpdateRate = 0.1f;
+
+	// Stores the mask as a single 8-bit channel (PF_G8) instead of BGRA: a quarter of the memory and upload
+	// bandwidth. Combine with a lower FogTexSize on large maps. FogMaterial must read the R channel of FogMaskTex.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = RTSUnitTemplate)
+	bool bUseSingleChannelFogMask = false;
 private:
 	FTimerHandle FogUpdateTimerHandle;
 	
@@ -93,6 +98,28 @@ private:
 	UPROPERTY(VisibleAnywhere, Category = RTSUnitTemplate)
 	TArray<FColor> FogPixels;
 
+	// Pixel buffer used instead of FogPixels when bUseSingleChannelFogMask is set.
+	TArray<uint8> FogPixelsR8;
+
+	// Shared by the local and multicast update: diffs the circle set against the last update,
+	// redraws only the dirty blocks and uploads only those regions.
+	void RasterizeFogCircles(
+		const TArray<FVector_NetQuantize>& Positions,
+		const TArray<float>&              WorldRadii,
+		const TArray<uint8>&              UnitTeamIds);
+
+	// Pixel-space circles of the last rasterized update, packed and sorted (see FogActor.cpp).
+	TArray<uint64> PreviousFogCircles;
+	TArray<uint64> CurrentFogCircles;
+
+	// One bit per FogBlockSize x FogBlockSize pixel block that has to be cleared, redrawn and uploaded.
+	TBitArray<> DirtyFogBlocks;
+
+	// Set on init and whenever the bounds change, forces every block to be redrawn.
+	bool bFogMaskNeedsFullRedraw = true;
+	FVector2D RasterizedFogMinBounds = FVector2D::ZeroVector;
+	FVector2D RasterizedFogMaxBounds = FVector2D::ZeroVector;
+
 	UFUNCTION()
 	void OnTeamIdChanged(int32 NewTeamId);
 
@@ -44,6 +44,22 @@ class RTSUNITTEMPLATE_API AProjectile : public AActor
 private:
 	// Timer to control the frequency of the overlap check
 	float OverlapCheckTimer = 0.0f;
+
+	// Applies a flight step: locally for client-simulated projectiles, otherwise multicast to everyone.
+	void MoveISMInstance(const FTransform& NewTransform);
+	void ApplyISMTransform(const FTransform& NewTransform);
+	void SendRetarget();
+	FTransform GetFlightTransform() const;
+
+	float HomingCorrectionTimer = 0.0f;
+	bool bClientCaughtUp = false;
+
+	// Decides client simulation and creates the flight instance for actor projectiles; BeginPlay and Relaunch.
+	void LaunchActorMode();
+
+	FTimerHandle DestroyTimerHandle;
+	bool bInPool = false;
+
 public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadOnly, Category = "RTSUnitTemplate")
 	float OverlapCheckInterval = 0.1f;
@@ -186,6 +202,57 @@ public:
 	
 	UFUNCTION(NetMulticast, Reliable, Category = "RTSUnitTemplate")
 	void Multicast_UpdateISMTransform(const FTransform& NewTransform);
+
+	/**
+	 * Actor mode only (bUseMass = false): clients fly the projectile themselves from the replicated launch
+	 * state (ShooterLocation, TargetLocation, FlightDirection, speed, arc and homing parameters) instead of
+	 * receiving Multicast_UpdateISMTransform every tick. The server only sends retargets (bounce, pierce),
+	 * the impact (bImpacted) and, for homing projectiles, a low-rate correction.
+	 * Decided by the server in BeginPlay from RTS.Projectile.ClientSimulation.
+	 */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "RTSUnitTemplate|Projectile")
+	bool bClientSimulated = false;
+
+	// Server world time at launch. Clients fast-forward their first step by the time the spawn took to arrive.
+	UPROPERTY(Replicated)
+	float LaunchServerTime = 0.f;
+
+	UFUNCTION(NetMulticast, Reliable)
+	void Multicast_Retarget(const FTransform& CurrentTransform, AActor* NewTarget, FVector_NetQuantize NewTargetLocation, FVector_NetQuantizeNormal NewFlightDirection);
+
+	// Periodic correction of client-simulated homing projectiles (RTS.Projectile.HomingCorrectionInterval).
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_CorrectISMTransform(const FTransform& NewTransform);
+
+	// Bumped by every relaunch of a pooled projectile. Clients have no BeginPlay for a reused actor and reset
+	// their local flight state from here; movement is not replicated, so the launch transform travels along.
+	UPROPERTY(ReplicatedUsing = OnRep_LaunchSerial)
+	uint8 LaunchSerial = 0;
+
+	UPROPERTY(Replicated)
+	FTransform LaunchTransform;
+
+	UFUNCTION()
+	void OnRep_LaunchSerial();
+
+	// --- Projectile pool (UProjectilePoolSubsystem) ---
+
+	// Restores the launch, flight, pierce and impact state to the class defaults before the next Init*.
+	void ResetProjectileState();
+
+	// Parks the projectile: hidden, no tick, no collision, no pending destroy timer, no flight instance.
+	void EnterPool();
+
+	// Takes the projectile out of the pool at Transform, reset and ready for Init*.
+	void LeavePool(const FTransform& Transform);
+
+	// BeginPlay counterpart for a reused projectile once the caller has initialised it.
+	void Relaunch(const FTransform& Transform);
+
+	// Undoes EnterPool and OnRep_bImpacted on the Niagara components of a relaunch: restarted and shown again.
+	void RestoreLaunchVisuals();
+
+	bool IsInPool() const { return bInPool; }
  
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "RTSUnitTemplate")
 	UNiagaraComponent* Niagara_A;
@@ -28,6 +28,11 @@ struct FTagProgress
 
 	UPROPERTY(BlueprintReadOnly, Category = "RTSUnitTemplate|WinLose")
 	int32 TargetCount = 0;
+
+	bool operator==(const FTagProgress& Other) const
+	{
+		return Tag == Other.Tag && AliveCount == Other.AliveCount && TotalCount == Other.TotalCount && TargetCount == Other.TargetCount;
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -139,6 +144,9 @@ public:
 	UFUNCTION()
 	void OnRep_TagProgress();
 
+	// Server: stores new tag progress and broadcasts OnTagProgressUpdated if it differs.
+	void SetTagProgress(TArray<FTagProgress>&& NewTagProgress);
+
 	UFUNCTION(BlueprintCallable, Category = "RTSUnitTemplate|WinLose")
 	EWinLoseCondition GetCurrentWinCondition() const;
 
@@ -157,4 +165,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
+private:
+	void NotifyHud();
+
 };
@@ -3,30 +3,135 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 
-#if PLATFORM_WINDOWS
-#include "Windows/WindowsHWrapper.h"
-#endif
+/**
+ * Binary shared-memory transport between the RL agent and an external training process.
+ *
+ * The mapping holds a header followed by two lock-free single-producer/single-consumer rings:
+ *  - Observations: written by Unreal, read by the trainer.
+ *  - Actions: written by the trainer, read by Unreal.
+ * Each ring has a write and a read sequence counter (monotonic uint64, slot = Seq % SlotCount).
+ * The producer fills a slot and then publishes it with a release store of WriteSeq; the consumer
+ * copies the slot and then frees it with a release store of ReadSeq. No locks, no flags.
+ *
+ * The layout is fixed and versioned (RLSharedMemory::Version). Whichever side creates the segment
+ * initializes the header; the side that attaches checks Magic, Version and the record sizes and
+ * never resets the ring counters.
+ * Windows uses a named file mapping ("Global\<Name>"), other platforms use POSIX shm_open ("/<Name>").
+ */
+namespace RLSharedMemory
+{
+	constexpr uint32 Magic = 0x52545352; // 'RTSR'
+	constexpr uint32 Version = 2;
+	constexpr uint32 ObservationSlots = 64;
+	constexpr uint32 ActionSlots = 64;
+	constexpr uint32 ActionPayloadCapacity = 4080;
+}
+
+// One environment step as seen by the agent. Plain floats/ints only, read by the trainer with a fixed struct format.
+struct FRLObservationRecord
+{
+	uint64 Step = 0;
+	int32 MyUnitCount = 0;
+	int32 EnemyUnitCount = 0;
+	float MyTotalHealth = 0.f;
+	float EnemyTotalHealth = 0.f;
+	float MyTotalAttackDamage = 0.f;
+	float EnemyTotalAttackDamage = 0.f;
+	float AgentPosition[3] = {};
+	float AverageFriendlyPosition[3] = {};
+	float AverageEnemyPosition[3] = {};
+	// Primary, Secondary, Tertiary, Rare, Epic, Legendary
+	float Resources[6] = {};
+	uint32 Reserved = 0;
+};
+static_assert(sizeof(FRLObservationRecord) == 96, "FRLObservationRecord layout is part of the shared-memory protocol");
 
-struct SharedData
+// One action from the trainer. Payload is the UTF-8 action JSON understood by ARLAgent::ReceiveRLAction.
+struct FRLActionRecord
 {
-	bool bNewGameStateAvailable;
-	bool bNewActionAvailable;
-	TCHAR GameState[1024];  // Use TCHAR instead of char
-	TCHAR Action[1024];     // Use TCHAR instead of char
+	// Observation step this action answers (0 if not tied to a step).
+	uint64 Step = 0;
+	uint32 PayloadSize = 0;
+	uint32 Reserved = 0;
+	uint8 Payload[RLSharedMemory::ActionPayloadCapacity];
+};
+static_assert(sizeof(FRLActionRecord) == 4096, "FRLActionRecord layout is part of the shared-memory protocol");
+
+// Sequence counters of one ring, each on its own cache line so producer and consumer do not false-share.
+struct FRLRingCursors
+{
+	static_assert(std::atomic<uint64>::is_always_lock_free, "Ring cursors must be lock-free to be shared across processes");
+
+	alignas(64) std::atomic<uint64> WriteSeq;
+	alignas(64) std::atomic<uint64> ReadSeq;
+};
+
+struct FRLSharedLayout
+{
+	uint32 Magic;
+	uint32 Version;
+	uint32 ObservationSlots;
+	uint32 ObservationRecordSize;
+	uint32 ActionSlots;
+	uint32 ActionRecordSize;
+	uint32 Reserved[10];
+
+	FRLRingCursors ObservationRing;
+	FRLRingCursors ActionRing;
+
+	FRLObservationRecord Observations[RLSharedMemory::ObservationSlots];
+	FRLActionRecord Actions[RLSharedMemory::ActionSlots];
 };
+static_assert(STRUCT_OFFSET(FRLSharedLayout, ObservationRing) == 64, "Header must be 64 bytes");
 
 class FSharedMemoryManager
 {
 public:
-	FSharedMemoryManager(const FString& SharedMemoryName, size_t MemorySize);
+	explicit FSharedMemoryManager(const FString& SharedMemoryName);
 	~FSharedMemoryManager();
 
-	bool WriteGameState(const FString& GameStateJSON);
-	FString ReadAction();
+	FSharedMemoryManager(const FSharedMemoryManager&) = delete;
+	FSharedMemoryManager& operator=(const FSharedMemoryManager&) = delete;
+
+	bool IsValid() const { return Layout != nullptr; }
+
+	// Producer side of the observation ring. Returns false if the trainer has fallen a full ring behind.
+	bool WriteObservation(const FRLObservationRecord& Observation);
+
+	// Consumer side of the action ring. Returns false if no action is pending.
+	bool ReadAction(FRLActionRecord& OutAction);
+
+	// UTF-8 payload of an action record as a string (empty for a zero-length record).
+	static FString DecodeActionPayload(const FRLActionRecord& Action);
+
+	// Observations dropped because the ring was full.
+	uint64 GetDroppedObservations() const { return DroppedObservations; }
 
 private:
-	HANDLE MappingHandle;
-	SharedData* SharedDataPtr;
-};
+	FRLSharedLayout* Layout = nullptr;
+	uint64 DroppedObservations = 0;
+	FString MappingName;
+
+	// True if this process created the segment; only the creator initializes the header and removes the name again (POSIX shm_unlink).
+	bool bCreatedSegment = false;
 
+	// Writes the header and zeroes the ring counters of a segment this process created.
+	void InitializeHeader();
+
+	// On attach: Magic, Version and the ring geometry must match this build's layout.
+	bool IsHeaderCompatible() const;
+
+	// Unmaps the view and releases the handle/descriptor. Safe to call twice.
+	void ReleaseMapping();
+
+#if PLATFORM_WINDOWS
+	void* MappingHandle = nullptr;
+#else
+	int32 FileDescriptor = -1;
+
+	// Closes the descriptor and unlinks the name if we created it.
+	void ReleasePosixDescriptor();
+#endif
+};
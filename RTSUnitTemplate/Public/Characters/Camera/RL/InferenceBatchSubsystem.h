@@ -0,0 +1,78 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InferenceBatchSubsystem.generated.h"
+
+class UNNEModelData;
+namespace UE::NNE
+{
+	class IModelCPU;
+	class IModelInstanceCPU;
+}
+
+/**
+ * Shares one NNE CPU model instance per ONNX asset between all UInferenceComponents of a world and
+ * batches their decisions: observations queued during a frame are written into one persistent
+ * [N, NumFeatures] input tensor, run with a single RunSync at the end of the frame, and the argmax of
+ * every output row is handed back to its requester.
+ *
+ * The batch dimension grows in powers of two and is only re-shaped when the pending count exceeds it;
+ * unused rows are padding. Models exported with a fixed batch size of 1 fall back to one run per row on
+ * the same preallocated tensors.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UInferenceBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	using FOnActionChosen = TFunction<void(int32 /*ActionIndex*/)>;
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Creates the shared runtime model for the asset on first use. False if the ORT CPU runtime or the model is unavailable.
+	bool RegisterModel(UNNEModelData* ModelData, int32 NumFeatures, int32 NumActions);
+
+	// Queues one observation. OnChosen runs on the game thread after this frame's batched run.
+	bool EnqueueDecision(UNNEModelData* ModelData, TConstArrayView<float> Features, FOnActionChosen&& OnChosen);
+
+	// Runs everything queued for the model plus Features right away and returns the argmax for Features (0 on failure).
+	int32 RunImmediate(UNNEModelData* ModelData, TConstArrayView<float> Features);
+
+private:
+	struct FModelBatch
+	{
+		TSharedPtr<UE::NNE::IModelCPU> Model;
+		TSharedPtr<UE::NNE::IModelInstanceCPU> Instance;
+		int32 NumFeatures = 0;
+		int32 NumActions = 0;
+
+		// Batch dimension the instance is currently shaped for (0 = not shaped yet).
+		int32 ShapedBatchSize = 0;
+		bool bSupportsBatching = true;
+
+		// Persistent tensors, row-major. Inputs holds the pending rows (plus padding while running).
+		TArray<float> Inputs;
+		TArray<float> Outputs;
+		TArray<FOnActionChosen> Pending;
+	};
+
+	// Runs the batch and invokes and clears its pending callbacks.
+	void Flush(FModelBatch& Batch);
+
+	// Runs all pending rows of the batch and writes one action index per row. False if the model failed.
+	bool RunBatch(FModelBatch& Batch, TArray<int32>& OutActions);
+
+	bool SetBatchShape(FModelBatch& Batch, int32 BatchSize);
+
+	TMap<TObjectKey<UNNEModelData>, TUniquePtr<FModelBatch>> Batches;
+
+	// Reused between flushes.
+	TArray<int32> ScratchActions;
+	TArray<FOnActionChosen> ScratchCallbacks;
+};
@@ -42,11 +42,6 @@ struct FRLAction
 };
 
 class UNNEModelData;
-namespace UE::NNE
-{
-	class IModelCPU;
-	class IModelInstanceCPU;
-}
 
 
 USTRUCT(BlueprintType)
@@ -261,6 +256,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI|Inference")
 	FString ChooseJsonAction(const FGameStateData& GameState);
 
+	// Deferred variant of ChooseJsonAction. In RL mode the observation joins this frame's batched
+	// inference (UInferenceBatchSubsystem) and OnChosen runs at the end of the frame; BT mode answers immediately.
+	void RequestJsonAction(const FGameStateData& GameState, TFunction<void(const FString&)>&& OnChosen);
+
+	// Number of floats ConvertStateToArray produces; must match the model input.
+	static constexpr int32 NumStateFeatures = 21;
+
 	// Expose for BT task to fetch JSON for an index
 	UFUNCTION(BlueprintCallable, Category = "AI|Inference")
 	FString GetActionAsJSON(int32 ActionIndex);
@@ -314,11 +316,15 @@ private:
 	UPROPERTY(EditAnywhere, Category = "AI|Inference", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UNNEModelData> QNetworkModelData;
 
-	// Runtime model + instance
-	TSharedPtr<UE::NNE::IModelCPU> RuntimeModel;
-	TSharedPtr<UE::NNE::IModelInstanceCPU> ModelInstance;
+	// True once the model is registered with the world's UInferenceBatchSubsystem, which owns the shared runtime instance.
+	bool bModelRegistered = false;
 
 	TArray<float> ConvertStateToArray(const FGameStateData& GameStateData) const;
+
+	// Writes the NumStateFeatures model inputs into Out (no allocation).
+	static void WriteStateFeatures(const FGameStateData& GameStateData, float* Out);
+
+	class UInferenceBatchSubsystem* GetBatchSubsystem() const;
 	
 	// Helper function to set up the action space
 	void InitializeActionSpace();
@@ -31,6 +31,8 @@ protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = RLAgent, meta = (AllowPrivateAccess = "true"))
     TObjectPtr<UInferenceComponent> InferenceComponent;
     
@@ -99,13 +101,17 @@ private:
     void CheckForNewActions();
     
     
-    FString CreateGameStateJSON(const FGameStateData& GameState); // New function
+    // Packs the game state into the fixed binary record of the shared-memory observation ring.
+    FRLObservationRecord CreateObservationRecord(const FGameStateData& GameState);
     
     // Toggle to enable/disable using shared memory for RL IO (disabled by default for BT mode)
     UPROPERTY(EditAnywhere, Category = RLAgent)
     bool bEnableSharedMemoryIO = false;
 
-    FSharedMemoryManager* SharedMemoryManager;
+    FSharedMemoryManager* SharedMemoryManager = nullptr;
+
+    // Monotonic step counter written into each observation; actions echo it back.
+    uint64 ObservationStep = 0;
 
     FTimerHandle RLUpdateTimerHandle;
 
@@ -132,6 +132,9 @@ public:
 	UFUNCTION()
 	void OnRep_LevelData(const FLevelData& OldLevelData);
 
+	// Tells the HUD (UHudEventSubsystem) that LevelData changed; OnRep_LevelData and every server-side change call it.
+	void NotifyLevelDataChanged();
+
 	UFUNCTION(BlueprintCallable, Category = "Leveling")
 	void SetLevelData(
 	int32 Experience,
@@ -147,6 +150,7 @@ public:
 		LevelData.UsedTalentPoints = UsedTalentPoints;
 		LevelData.AbilityPoints = AbilityPoints;
 		LevelData.UsedAbilityPoints = UsedAbilityPoints;
+		NotifyLevelDataChanged();
 	}
 	
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Leveling")
@@ -354,6 +354,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = TopDownRTSTemplate)
 	int SelectedUnitCount = 0;
 
+	// Hash of everything the unit selector shows about the selection; Tick reports changes to UHudEventSubsystem.
+	virtual uint32 GetHudSelectionHash() const;
+
+	uint32 LastHudSelectionHash = 0;
+
 	UPROPERTY(BlueprintReadWrite, Category = TopDownRTSTemplate)
 	float RelocateWaypointZOffset = 30.f;
 
@@ -15,6 +15,7 @@
 #include "Engine/Engine.h"       // Include for GEngine
 #include "Engine/EngineTypes.h"   // For FHitResult in UFUNCTION params
 #include "TimerManager.h"  // For FTimerHandle
+#include "Core/FormationAssignment.h"
 
 class USoundBase;
 class AUnitBase;
@@ -41,6 +42,10 @@ protected:
 	// /** A snapshot of the last group of units for which a formation was calculated. Used to detect changes in selection. */
 	TArray<TWeakObjectPtr<AUnitBase>> LastFormationUnits;
 
+	// Reused between formation recalculations so large selections do not reallocate N*N floats per move command.
+	FFormationCostMatrix FormationCostScratch;
+	TArray<int32> FormationAssignmentScratch;
+
 	// Retry state for deferred follow-target commands
 	FTimerHandle FollowRetryTimerHandle;
 	int32 FollowRetryRemaining = 0;
@@ -203,14 +208,20 @@ public:
 	/** Computes offsets for an N-unit grid formation centered at (0,0). */
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	TArray<FVector> ComputeSlotOffsets(const TArray<AUnitBase*>& Units, float Spacing = -1.0f) const;
-	/** Builds an N×N cost matrix of squared distances from units to slots, with size-compatibility penalties. */
-	TArray<TArray<float>> BuildCostMatrix(
+	/** Fills an N×N cost matrix of squared distances from units to slots, with size-compatibility penalties. */
+	void BuildCostMatrix(
 		const TArray<AUnitBase*>& Units,
 		const TArray<FVector>& SlotOffsets,
-		const FVector& TargetCenter) const;
-	
-	/** Solves the assignment problem (Hungarian) on the given cost matrix. */
-	TArray<int32> SolveHungarian(const TArray<TArray<float>>& Matrix) const;
+		const FVector& TargetCenter,
+		FFormationCostMatrix& OutCost) const;
+
+	/** Solver used to match units to formation slots. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Formation Settings")
+	EFormationAssignmentSolver FormationAssignmentSolver = EFormationAssignmentSolver::Auction;
+
+	/** Selections larger than this use the greedy + local swap solver regardless of FormationAssignmentSolver (0 = never). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Formation Settings", meta = (ClampMin = "0"))
+	int32 FormationGreedyUnitThreshold = 500;
 	/** Determines if the formation needs to be recalculated. */
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	bool ShouldRecalculateFormation() const;
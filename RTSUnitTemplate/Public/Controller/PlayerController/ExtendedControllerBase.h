@@ -241,6 +241,8 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = RTSUnitTemplate)
 	int AbilityArrayIndex = 0;
 
+	virtual uint32 GetHudSelectionHash() const override;
+
 	UPROPERTY(BlueprintReadOnly, Category = BuildingSnap)
 	bool WorkAreaIsSnapped = false;
 	
@@ -0,0 +1,62 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FormationAssignment.generated.h"
+
+UENUM(BlueprintType)
+enum class EFormationAssignmentSolver : uint8
+{
+	// Exact, O(n^3). Fine up to a few dozen units.
+	Hungarian   UMETA(DisplayName = "Hungarian (exact)"),
+	// Epsilon-scaling auction. Total cost within RelativeTolerance of the optimum, much faster on large selections.
+	Auction     UMETA(DisplayName = "Auction (epsilon scaling)"),
+	// Nearest free slot per unit followed by pairwise swap passes. O(n^2) per pass, not optimal.
+	GreedySwap  UMETA(DisplayName = "Greedy + local swaps")
+};
+
+/** Square unit-to-slot cost matrix in one contiguous row-major buffer (row = unit, column = slot). */
+struct RTSUNITTEMPLATE_API FFormationCostMatrix
+{
+	int32 Num = 0;
+	TArray<float> Costs;
+
+	// Resizes to InNum x InNum. Keeps the allocation when the matrix shrinks; contents are undefined.
+	void Reset(int32 InNum)
+	{
+		Num = InNum;
+		Costs.Reset();
+		Costs.AddUninitialized(InNum * InNum);
+	}
+
+	float& At(int32 Unit, int32 Slot) { return Costs[Unit * Num + Slot]; }
+	float At(int32 Unit, int32 Slot) const { return Costs[Unit * Num + Slot]; }
+	const float* Row(int32 Unit) const { return Costs.GetData() + Unit * Num; }
+};
+
+/**
+ * Unit-to-slot assignment solvers for formation moves. Every solver writes OutAssignment[Unit] = Slot
+ * as a permutation of 0..Num-1.
+ */
+class RTSUNITTEMPLATE_API FFormationAssignment
+{
+public:
+	static void Solve(EFormationAssignmentSolver Solver, const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment);
+
+	static void SolveHungarian(const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment);
+
+	/**
+	 * Forward auction with epsilon scaling. The final epsilon is chosen so that the total cost is at most
+	 * RelativeTolerance (of the row-minimum lower bound) above the optimum.
+	 */
+	static void SolveAuction(const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment, float RelativeTolerance = 1e-4f);
+
+	static void SolveGreedySwap(const FFormationCostMatrix& Cost, TArray<int32>& OutAssignment, int32 MaxSwapPasses = 4);
+
+	static double TotalCost(const FFormationCostMatrix& Cost, const TArray<int32>& Assignment);
+
+private:
+	// 2-opt over unit pairs: swaps two units' slots whenever that lowers the summed cost.
+	static void ImproveBySwaps(const FFormationCostMatrix& Cost, TArray<int32>& InOutAssignment, int32 MaxPasses);
+};
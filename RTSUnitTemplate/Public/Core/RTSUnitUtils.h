@@ -16,6 +16,7 @@
 #include "CollisionQueryParams.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Mass/MassUnitVisualFragments.h"
+#include "Mass/UnitSpatialGridSubsystem.h"
 #include "NavigationSystem.h"
 
 namespace RTSUnitUtils
@@ -151,6 +152,48 @@ namespace RTSUnitUtils
  	return AttackerRadius + TargetRadius;
 	}
 
+	// Same as above, but reads the target from its snapshot row (UUnitSpatialGridSubsystem::FindEntry) when there is one.
+	// Box-shaped or unlisted targets fall back to their fragments.
+	inline float GetCombinedRadii(FMassEntityManager& EntityManager, const FMassAgentCharacteristicsFragment& AttackerChar, const FTransform& AttackerTransform,
+		const FMassEntityHandle TargetEntity, const FUnitSpatialGridEntry* TargetRow, const FVector& TargetLocation)
+	{
+		if (TargetRow && !TargetRow->bUseBoxComponent)
+		{
+			float AttackerRadius = AttackerChar.CapsuleRadius;
+			if (AttackerChar.bUseBoxComponent)
+			{
+				FVector Dir = (TargetLocation - AttackerTransform.GetLocation());
+				Dir.Z = 0.f;
+				if (!Dir.IsNearlyZero())
+				{
+					AttackerRadius = AttackerChar.GetRadiusInDirection(Dir.GetSafeNormal(), AttackerTransform.GetRotation().Rotator());
+				}
+			}
+			return AttackerRadius + TargetRow->Radius;
+		}
+
+		const bool bTargetActive = EntityManager.IsEntityActive(TargetEntity);
+		const FMassAgentCharacteristicsFragment* TargetChar = bTargetActive ? EntityManager.GetFragmentDataPtr<FMassAgentCharacteristicsFragment>(TargetEntity) : nullptr;
+		const FTransformFragment* TargetTransformFrag = bTargetActive ? EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetEntity) : nullptr;
+		return GetCombinedRadii(AttackerChar, AttackerTransform, TargetChar, TargetTransformFrag ? &TargetTransformFrag->GetTransform() : nullptr, TargetLocation);
+	}
+
+	// Target health from its snapshot row, or from its combat stats fragment. Returns false if neither is available.
+	inline bool GetTargetHealth(FMassEntityManager& EntityManager, const FMassEntityHandle TargetEntity, const FUnitSpatialGridEntry* TargetRow, float& OutHealth)
+	{
+		if (TargetRow)
+		{
+			OutHealth = TargetRow->Health;
+			return true;
+		}
+		if (const FMassCombatStatsFragment* Stats = EntityManager.IsEntityActive(TargetEntity) ? EntityManager.GetFragmentDataPtr<FMassCombatStatsFragment>(TargetEntity) : nullptr)
+		{
+			OutHealth = Stats->Health;
+			return true;
+		}
+		return false;
+	}
+
 	inline FVector CalculateFollowPosition(FMassEntityManager& EntityManager, const FMassEntityHandle Entity, const FMassAITargetFragment& TargetFrag, const FMassAgentCharacteristicsFragment* CharacteristicsFrag, const FVector& CurrentLocation, const FVector& FriendlyLoc, UWorld* World)
 	{
 		uint64 Seed = (uint64)Entity.Index | ((uint64)Entity.SerialNumber << 32);
@@ -263,21 +306,28 @@ namespace RTSUnitUtils
 		return DesiredPos;
 	}
 
-	inline bool IsWithinFollowThreshold(FMassEntityManager& EntityManager, const FMassEntityHandle Entity, const FMassAITargetFragment& TargetFrag, const FMassAgentCharacteristicsFragment* CharacteristicsFrag, const FVector& CurrentLocation, const FMassMoveTargetFragment& MoveTarget, UWorld* World, float AcceptanceMultiplier)
+	// Follow slot of Entity around its friendly target, from the target's live transform if it has one. Queries
+	// the navigation system, so game thread only.
+	inline FVector CalculateFollowPositionForTarget(FMassEntityManager& EntityManager, const FMassEntityHandle Entity, const FMassAITargetFragment& TargetFrag, const FMassAgentCharacteristicsFragment* CharacteristicsFrag, const FVector& CurrentLocation, UWorld* World)
 	{
-		if (!EntityManager.IsEntityActive(TargetFrag.FriendlyTargetEntity))
-		{
-			return true;
-		}
-
 		FVector FriendlyLoc = TargetFrag.LastKnownFriendlyLocation;
 		if (const FTransformFragment* FriendlyXform = EntityManager.GetFragmentDataPtr<FTransformFragment>(TargetFrag.FriendlyTargetEntity))
 		{
 			FriendlyLoc = FriendlyXform->GetTransform().GetLocation();
 		}
+		return CalculateFollowPosition(EntityManager, Entity, TargetFrag, CharacteristicsFrag, CurrentLocation, FriendlyLoc, World);
+	}
+
+	// Reads only TargetFrag.CachedFollowPosition, so it is safe on worker threads. Without a cached slot yet the
+	// unit counts as within the threshold and keeps its current state until the next game-thread sync.
+	inline bool IsWithinFollowThreshold(const FMassEntityManager& EntityManager, const FMassAITargetFragment& TargetFrag, const FVector& CurrentLocation, const FMassMoveTargetFragment& MoveTarget, float AcceptanceMultiplier)
+	{
+		if (!EntityManager.IsEntityActive(TargetFrag.FriendlyTargetEntity) || !TargetFrag.bHasCachedFollowPosition)
+		{
+			return true;
+		}
 
-		FVector DesiredPos = CalculateFollowPosition(EntityManager, Entity, TargetFrag, CharacteristicsFrag, CurrentLocation, FriendlyLoc, World);
-		const float Dist2D = FVector::Dist2D(CurrentLocation, DesiredPos);
+		const float Dist2D = FVector::Dist2D(CurrentLocation, TargetFrag.CachedFollowPosition);
 		const float Threshold = MoveTarget.SlackRadius * AcceptanceMultiplier;
 
 		return Dist2D <= Threshold;
@@ -0,0 +1,70 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** What a unit is filed under in FUnitRoster. */
+struct FUnitRosterKey
+{
+	int32 TeamId = 0;
+	int32 SquadId = 0;
+	int32 UnitIndex = INDEX_NONE;
+
+	bool operator==(const FUnitRosterKey& Other) const
+	{
+		return TeamId == Other.TeamId && SquadId == Other.SquadId && UnitIndex == Other.UnitIndex;
+	}
+	bool operator!=(const FUnitRosterKey& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Team, squad and UnitIndex buckets over small integer unit handles (the caller's slot indices).
+ * Every entry remembers its position inside its team and squad bucket, so add, remove and re-file
+ * are O(1) and a team or squad lookup only touches its own members.
+ *
+ * Units with SquadId <= 0 are not in any squad bucket. A UnitIndex < 0 is not indexed; if two
+ * handles share a UnitIndex the one filed last is returned by FindByUnitIndex.
+ * Bucket order is unspecified and changes on removal.
+ */
+struct RTSUNITTEMPLATE_API FUnitRoster
+{
+	void Add(int32 Handle, const FUnitRosterKey& Key);
+	void Remove(int32 Handle);
+
+	// Moves Handle to the buckets of Key. Returns true if the key actually changed.
+	bool Update(int32 Handle, const FUnitRosterKey& Key);
+
+	bool Contains(int32 Handle) const { return Entries.IsValidIndex(Handle) && Entries[Handle].bUsed; }
+	const FUnitRosterKey* FindKey(int32 Handle) const { return Contains(Handle) ? &Entries[Handle].Key : nullptr; }
+
+	TConstArrayView<int32> GetTeam(int32 TeamId) const;
+	TConstArrayView<int32> GetSquad(int32 TeamId, int32 SquadId) const;
+	int32 FindByUnitIndex(int32 UnitIndex) const;
+
+	int32 Num() const { return NumUsed; }
+	int32 NumTeams() const { return TeamMembers.Num(); }
+	int32 NumSquads() const { return SquadMembers.Num(); }
+
+	void Reset();
+
+private:
+	struct FEntry
+	{
+		FUnitRosterKey Key;
+		int32 TeamSlot = INDEX_NONE;
+		int32 SquadSlot = INDEX_NONE;
+		bool bUsed = false;
+	};
+
+	void Link(int32 Handle);
+	void Unlink(int32 Handle);
+
+	static FIntPoint SquadKey(int32 TeamId, int32 SquadId) { return FIntPoint(TeamId, SquadId); }
+
+	TArray<FEntry> Entries;
+	TMap<int32, TArray<int32>> TeamMembers;
+	TMap<FIntPoint, TArray<int32>> SquadMembers;
+	TMap<int32, int32> HandleByUnitIndex;
+	int32 NumUsed = 0;
+};
@@ -86,9 +86,6 @@ protected:
 
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void GatherBases();
-	
-	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
-	void AssignWorkAreasToWorkers();
 
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Work)
@@ -152,6 +149,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void AssignWorkAreasToWorker(AWorkingUnitBase* Worker);
 
+	// Takes Worker off its ResourcePlace and out of that resource type's CurrentWorkers count.
+	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
+	void ReleaseWorkPlace(AWorkingUnitBase* Worker);
+
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	AWorkArea* GetSuitableWorkAreaToWorker(int TeamId, const TArray<AWorkArea*>& WorkAreas);
 
@@ -179,11 +180,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void SetCurrentWorkersForResourceType(int TeamId, EResourceType ResourceType, float Amount);
 
-	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
-	void SetAllCurrentWorkers(int TeamId);
-
 	virtual void CheckWinLoseCondition(AUnitBase* DestroyedUnit = nullptr) override;
 
 private:
 	void CheckWinLoseConditionTimer();
+
+	// Picks the work place for Worker among WorkPlaces (nearest to ReferenceLocation first), honouring the team's
+	// worker distribution and the distance threshold, and files the worker there.
+	void AssignWorkPlace(AWorkingUnitBase* Worker, const TArray<AWorkArea*>& WorkPlaces, const FVector& ReferenceLocation, bool bWorkerDistributionSet);
+
+	// Valid, non-depleted resource areas of all types. Drops stale pointers from WorkAreaGroups.
+	void GetAvailableResourcePlaces(TArray<AWorkArea*>& OutAreas);
+
+	// Copies TeamResources to the game state.
+	void SyncTeamResourcesToGameState();
 };
\ No newline at end of file
@@ -18,7 +18,7 @@ class RTSUNITTEMPLATE_API AResourceGameState : public AGameStateBase
 
 public:
 	// Use replicated properties to share data with clients
-	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "RTSUnitTemplate")
+	UPROPERTY(ReplicatedUsing = OnRep_TeamResources, VisibleAnywhere, BlueprintReadOnly, Category = "RTSUnitTemplate")
 	TArray<FResourceArray> TeamResources;
 
 	UPROPERTY(Replicated, VisibleAnywhere, BlueprintReadOnly, Category = "RTSUnitTemplate")
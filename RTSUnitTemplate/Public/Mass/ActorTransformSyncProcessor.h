@@ -11,6 +11,7 @@
 
 // Forward declaration if needed
 class UMassRepresentationSubsystem;
+class UGroundHeightCacheSubsystem;
 
 UCLASS()
 class RTSUNITTEMPLATE_API UActorTransformSyncProcessor : public UMassProcessor
@@ -59,6 +60,7 @@ public:
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	//virtual void Initialize(UObject& Owner) override;
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
 
 private:
@@ -70,6 +72,10 @@ private:
 	UPROPERTY(Transient)
 	UMassRepresentationSubsystem* RepresentationSubsystem; // Example if using Representation Subsystem
 
+	// Cached static ground heightfield; HandleGroundAndHeight only traces where it reports a miss.
+	UPROPERTY(Transient)
+	TObjectPtr<UGroundHeightCacheSubsystem> GroundHeightCache;
+
 
 	// Separated execution paths
 	void ExecuteClient(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
@@ -8,6 +8,8 @@
 #include "DrawDebugHelpers.h"
 #include "DynamicObstacleRegProcessor.generated.h"
 
+class UNavigationSystemV1;
+
 /**
  * 
  */
@@ -24,6 +26,10 @@ public:
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
     float ExecutionInterval = 0.1f;
+
+	/** A registered obstacle is only moved in the grid once its position or radius changed by more than this (cm). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = RTSUnitTemplate)
+	float UpdateTolerance = 10.f;
 	
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
@@ -45,11 +51,24 @@ private:
 		bool bIsProcessed = false; // Used by the clustering algorithm
 	};
     
-	/** Gathers static obstacles and immediately processes all dynamic ones. */
-	void CollectAndProcessObstacles(FMassExecutionContext& Context, FMassEntityQuery& Query, UMassNavigationSubsystem& NavSys); // Removed const
+	/** Grid items one stationary entity currently owns, so it can be moved or removed without rebuilding the grid. */
+	struct FRegisteredObstacle
+	{
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.f;
+		// Empty while the entity stands off the navmesh.
+		TArray<FNavigationObstacleHashGrid2D::FCellLocation, TInlineAllocator<1>> CellLocations;
+		uint32 SeenStamp = 0;
+	};
+
+	/** Registers entities entering the query and re-adds those that moved beyond UpdateTolerance. */
+	void CollectAndProcessObstacles(FMassExecutionContext& Context, FMassEntityQuery& Query, UMassNavigationSubsystem& NavSys, UNavigationSystemV1& NavSystem);
 	
 	/** Adds a single obstacle to the grid, subdividing if it's a large circle. */
-	void AddSingleObstacleToGrid(UMassNavigationSubsystem& NavSys, const FMassEntityHandle Entity, const FVector& Location, const float Radius); // Removed const
+	void AddSingleObstacleToGrid(UMassNavigationSubsystem& NavSys, const FMassEntityHandle Entity, FRegisteredObstacle& Obstacle);
+
+	/** Removes all grid items previously added for Entity. */
+	void RemoveObstacleFromGrid(UMassNavigationSubsystem& NavSys, const FMassEntityHandle Entity, FRegisteredObstacle& Obstacle);
 	
 	//void AddConvexHullClusterToGrid(UMassNavigationSubsystem& NavSys, const TArray<int32>& ClusterIndices, const TArray<FStaticObstacleDesc>& AllStaticObstacles); // Removed const
 	UPROPERTY(EditAnywhere, Category = "Navigation")
@@ -58,8 +77,13 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Navigation")
 	TSubclassOf<UNavArea> NullNavAreaClass;
 
-	/** Keeps track of the volumes we spawn so we can destroy them on the next run. */
-	TArray<TWeakObjectPtr<AActor>> SpawnedNavVolumes;
+	/** Entities currently in the obstacle grid. Entries not seen in a run have left their stationary state. */
+	TMap<FMassEntityHandle, FRegisteredObstacle> RegisteredObstacles;
+
+	/** Subsystem whose grid RegisteredObstacles refers to; a different one (new world) starts from scratch. */
+	TWeakObjectPtr<UMassNavigationSubsystem> RegisteredNavSys;
+
+	uint32 RunStamp = 0;
 	
 	float TimeSinceLastRun = 0.0f;
 };
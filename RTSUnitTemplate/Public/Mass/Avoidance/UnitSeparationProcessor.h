@@ -17,6 +17,7 @@ struct FMassExecutionContext;
 	 * Applies a lateral repulsion force between nearby units to avoid clumping.
 	 * Includes all active states (Attack, Run, Chase, Pause, Build, Repair).
 	 * Uses FMassForceFragment so the existing movement processor can consume it.
+	 * Neighbors come from a per-tick cell grid (3x3 cells), pushes are accumulated per unit in parallel.
 	 */
 UCLASS()
 class RTSUNITTEMPLATE_API UUnitSeparationProcessor : public UMassProcessor
@@ -9,6 +9,7 @@
 #include "UnitMassTag.h"
 #include "Signals/UnitSignalingProcessor.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "DetectionProcessor.generated.h"
 
 struct FMassExecutionContext;
@@ -16,17 +17,8 @@ struct FTransformFragment;
 struct FMassAITargetFragment;
 struct FMassCombatStatsFragment;
 struct FMassAgentCharacteristicsFragment;
-struct FTargetUnitInfo
-{
-	FMassEntityHandle                          Entity;
-	FVector                                    Location;
-	FMassAIStateFragment*                      State;
-	//FMassAITargetFragment*                     TargetFrag;
-	//FMassMoveTargetFragment*                   MoveFrag;
-	const FMassCombatStatsFragment*            Stats;
-	const FMassAgentCharacteristicsFragment*   Char;
-	const FMassSightFragment* Sight;
-};
+struct FUnitPresenceEntry;
+class UUnitPresenceSubsystem;
 struct FDetectorUnitInfo
 {
 	FMassEntityHandle                          Entity;
@@ -59,13 +51,13 @@ private:
 	UPROPERTY(Transient)
 	UWorld* World;
 
-	void HandleUnitPresenceSignal(FName SignalName, TConstArrayView<FMassEntityHandle> Entities);
-
-	void InjectCurrentTargetIfMissing(const FDetectorUnitInfo& DetectorInfo, TArray<FTargetUnitInfo>& InOutTargetUnits, FMassEntityManager& EntityManager);
+	// Adds the detector's current target to InOutInjectedTargets if the presence snapshot does not contain it.
+	void InjectCurrentTargetIfMissing(const FDetectorUnitInfo& DetectorInfo, TArray<FUnitPresenceEntry>& InOutInjectedTargets, FMassEntityManager& EntityManager);
 
 	FMassEntityQuery EntityQuery;
 	
-	float TimeSinceLastRun = 0.0f;
+	// Detectors are spread over RTS.TimeSlice.Buckets frames, each one is still re-evaluated every ExecutionInterval.
+	FMassTimeSlice TimeSlice;
 	const float ExecutionInterval = 0.2f; // Intervall für die Detektion (z.B. 5x pro Sekunde)
 
 	UPROPERTY(Transient)
@@ -73,10 +65,8 @@ private:
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassEntitySubsystem> EntitySubsystem;
-	
-	FDelegateHandle SignalDelegateHandle;
 
-	TMap<FName, TArray<FMassEntityHandle>> ReceivedSignalsBuffer;
-	
-	TSet<FMassEntityHandle> SignaledEntitiesProcessedThisTick;
+	// Detectable units of this frame, published by UUnitPresenceProcessor.
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitPresenceSubsystem> PresenceSubsystem;
 };
\ No newline at end of file
@@ -28,6 +28,8 @@ protected:
 	FMassEntityHandle LastHoveredEntity;
 
 	FMassEntityQuery EntityQuery;
+	// Broad-phase result from UUnitPickingSubsystem, kept to reuse its allocation.
+	TArray<int32> CandidateEntries;
 	float LastLogTime = 0.f;
 	float LastHeartbeatTime = 0.f;
 };
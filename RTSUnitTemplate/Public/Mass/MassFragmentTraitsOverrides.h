@@ -9,7 +9,6 @@
 
 // Forward declarations of project fragments
 struct FMassAITargetFragment;
-struct FMassSightFragment;
 struct FMassGameplayEffectFragment;
 struct FUnitNavigationPathFragment;
 struct FMassUnitPathFragment;
@@ -25,12 +24,6 @@ struct TMassFragmentTraits<FMassAITargetFragment>
 	static constexpr bool AuthorAcceptsItsNotTriviallyCopyable = true;
 };
 
-template<>
-struct TMassFragmentTraits<FMassSightFragment>
-{
-	static constexpr bool AuthorAcceptsItsNotTriviallyCopyable = true;
-};
-
 template<>
 struct TMassFragmentTraits<FMassGameplayEffectFragment>
 {
@@ -0,0 +1,50 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+
+/**
+ * Staggers an interval-gated processor over several frames.
+ * Instead of running the whole population once every Interval, entities are split into
+ * NumBuckets phase buckets (by entity index) and each frame only the buckets whose phase
+ * came up since the last frame are due. Every entity is still processed once per Interval,
+ * so per-entity timers that add Interval on each visit stay correct, but the cost is
+ * spread flat instead of spiking every Interval.
+ *
+ * Usage in Execute():
+ *     if (!TimeSlice.Advance(Context.GetDeltaTimeSeconds(), ExecutionInterval)) return;
+ *     ... for each entity: if (!TimeSlice.IsDue(Entity)) continue;
+ *
+ * With one bucket (RTS.TimeSlice.Buckets 1) this is the old TimeSinceLastRun accumulator.
+ */
+struct RTSUNITTEMPLATE_API FMassTimeSlice
+{
+	// Returns true if at least one bucket is due this frame. Interval <= 0 makes every bucket due every frame.
+	bool Advance(float DeltaSeconds, float Interval);
+
+	bool IsDue(const FMassEntityHandle& Entity) const
+	{
+		if (DueCount >= NumBuckets)
+		{
+			return true;
+		}
+		const int32 Bucket = int32(uint32(Entity.Index) % uint32(NumBuckets));
+		return (Bucket - DueBegin + NumBuckets) % NumBuckets < DueCount;
+	}
+
+	// True if every bucket is due this frame (one bucket, or a frame longer than the interval).
+	bool IsFullPass() const { return DueCount >= NumBuckets; }
+
+	int32 GetNumBuckets() const { return NumBuckets; }
+
+	// Number of buckets from RTS.TimeSlice.Buckets.
+	static int32 GetConfiguredBuckets();
+
+private:
+	// Accumulated phase in buckets, wrapped to [0, NumBuckets).
+	float Phase = 0.f;
+	int32 NumBuckets = 1;
+	int32 DueBegin = 0;
+	int32 DueCount = 0;
+};
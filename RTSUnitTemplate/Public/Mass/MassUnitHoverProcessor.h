@@ -12,10 +12,12 @@
 class AMassUnitBase;
 class USkeletalMeshComponent;
 class UMassSignalSubsystem;
+class UUnitPickingSubsystem;
 
 /**
  * Processor that handles hover detection for Mass units and buildings.
  * Runs on the local client and triggers CustomOverlapStart/End on the unit actors via signals.
+ * Only the entities UUnitPickingSubsystem returns for the mouse ray are tested.
  */
 UCLASS()
 class RTSUNITTEMPLATE_API UMassUnitHoverProcessor : public UMassProcessor
@@ -37,7 +39,12 @@ protected:
 	UPROPERTY()
 	UMassSignalSubsystem* SignalSubsystem = nullptr;
 
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitPickingSubsystem> PickingSubsystem;
+
+	// Declares the fragment access of the hover test; candidates come from UUnitPickingSubsystem.
 	FMassEntityQuery EntityQuery;
+	TArray<int32> CandidateEntries;
 	float AccumulatedTime = 0.f;
 
 	UFUNCTION()
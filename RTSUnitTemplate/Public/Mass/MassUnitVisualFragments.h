@@ -200,6 +200,13 @@ struct RTSUNITTEMPLATE_API FMassVisualEffectFragment : public FMassFragment
     UPROPERTY()
     TWeakObjectPtr<UInstancedStaticMeshComponent> OscillationTargetISM;
 
+    // Periodic effects last written to the instance custom data, see MassVisualEffectCustomData.h.
+    UPROPERTY(Transient)
+    uint8 GpuWrittenEffects = 0;
+
+    UPROPERTY(Transient)
+    uint32 GpuWrittenParamsHash = 0;
+
     // Dish (Random) Rotation
     UPROPERTY()
     bool bDishRotationEnabled = false;
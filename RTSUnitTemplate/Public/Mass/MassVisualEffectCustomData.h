@@ -0,0 +1,70 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMassUnitVisualFragment;
+struct FMassVisualEffectFragment;
+
+/**
+ * Per-instance custom data for the periodic ISM effects (pulsate, continuous rotation, oscillation).
+ *
+ * With RTS.VisualEffects.GpuPeriodic enabled, UMassUnitVisualTweenProcessor no longer bakes these effects
+ * into the instance transform every frame. It writes the parameters below once when an effect starts,
+ * changes or stops, and the unit material evaluates them in World Position Offset.
+ *
+ * Layout (after the animation data in 1..12, see UnitAnimationProcessor.h). Vectors are in the instance's
+ * local space, so the material can work on the local vertex position P and transform the result to world:
+ *   Pulsate     t = Time - PulsateStartTime, a = 0.5 * (1 - cos(PI * t / PulsateHalfPeriod))
+ *               P *= lerp(PulsateMinFactor, PulsateMaxFactor, a)           (HalfPeriod 0 = off)
+ *   Rotation    P = RotateAboutAxis(P * RotationScale, RotationAxis, DegreesPerSecond * (Time - RotationStartTime)) / RotationScale
+ *               (the CPU path rotates the scaled mesh; RotationScale is the instance scale, so the instance
+ *               transform's own scale is undone first and non-uniform scales rotate the same way)
+ *   Oscillation t = Time - OscillationStartTime, a = 0.5 * (1 - cos(2 PI * CyclesPerSecond * t))
+ *               P += lerp(OscillationOffsetA, OscillationOffsetB, a)
+ * Time is the world time in seconds (same clock as the animation StartTime); inactive blocks are zero.
+ */
+namespace VisualEffectCustomData
+{
+	inline constexpr int32 PulsateStartTime = 13;
+	inline constexpr int32 PulsateHalfPeriod = 14;
+	inline constexpr int32 PulsateMinFactor = 15;       // xyz
+	inline constexpr int32 PulsateMaxFactor = 18;       // xyz
+	inline constexpr int32 RotationStartTime = 21;
+	inline constexpr int32 RotationDegreesPerSecond = 22;
+	inline constexpr int32 RotationAxis = 23;           // xyz
+	inline constexpr int32 RotationScale = 26;          // xyz
+	inline constexpr int32 OscillationStartTime = 29;
+	inline constexpr int32 OscillationCyclesPerSecond = 30;
+	inline constexpr int32 OscillationOffsetA = 31;     // xyz
+	inline constexpr int32 OscillationOffsetB = 34;     // xyz
+	inline constexpr int32 NumFloats = 37;
+
+	// Same bits as AMassUnitBase::Rep_VE_ActiveEffects.
+	enum EEffectBits : uint8
+	{
+		Pulsate = 1 << 0,
+		Rotation = 1 << 1,
+		Oscillation = 1 << 2,
+	};
+
+	/** True if RTS.VisualEffects.GpuPeriodic is set. */
+	RTSUNITTEMPLATE_API bool IsGpuPeriodicEnabled();
+
+	/** Custom-data floats a unit ISM has to be created with: 13 for the animation, NumFloats with GPU effects. */
+	RTSUNITTEMPLATE_API int32 GetRequiredCustomDataFloats();
+
+	/** True if every rendered instance of the unit has room for the effect block. */
+	RTSUNITTEMPLATE_API bool CanUseCustomData(const FMassUnitVisualFragment& Visual);
+
+	/** Periodic effects currently enabled on the fragment (EEffectBits). */
+	RTSUNITTEMPLATE_API uint8 GetActiveEffects(const FMassVisualEffectFragment& Effect);
+
+	/**
+	 * GPU path of one entity for this frame. Compares GpuEffects (subset of GetActiveEffects, 0 to clear)
+	 * and their parameters with what was last written and, only if they differ, rewrites the custom data
+	 * of every instance. Expects the instances' CurrentRelativeTransform without those effects applied.
+	 * Returns true if it wrote, i.e. the frame the effect set changed; false while effects just run.
+	 */
+	RTSUNITTEMPLATE_API bool SyncInstances(const FMassUnitVisualFragment& Visual, FMassVisualEffectFragment& Effect, uint8 GpuEffects, float WorldTime);
+}
@@ -7,6 +7,9 @@ class FSubsystemCollectionBase;
 class AUnitRegistryReplicator;
 class AUnitClientBubbleInfo;
 class UMassActorBindingComponent;
+struct FMassNetworkID;
+struct FUnitReplicationItem;
+struct FPlayerMouseData;
 
 #include "RTSWorldCacheSubsystem.generated.h"
 
@@ -24,8 +27,19 @@ public:
 	AUnitRegistryReplicator* GetRegistry(bool bAllowSpawnOnServer = true);
 
 	// Returns cached bubble info; may spawn on server when allowed.
+	// Prefers the bubble owned by a connection (the team view when net.RTS.Relevancy.Enable is on).
 	AUnitClientBubbleInfo* GetBubble(bool bAllowSpawnOnServer = true);
 
+	// Returns the unowned bubble carrying always-relevant units, if one exists. Never spawns.
+	AUnitClientBubbleInfo* GetSharedBubble();
+
+	// Finds a replicated unit in the own bubble first, then in the shared bubble.
+	// OutBubble receives the bubble holding the item (its ProjectileStyleRegistry resolves the item's style index).
+	FUnitReplicationItem* FindReplicatedItem(const FMassNetworkID& NetID, AUnitClientBubbleInfo** OutBubble = nullptr);
+
+	// Replicated mouse location of PlayerId, looked up like FindReplicatedItem: own bubble first, then the shared one.
+	const FPlayerMouseData* FindPlayerMouseData(int32 PlayerId);
+
 	// Rebuild OwnerName->BindingComponent cache if needed (throttled by interval seconds)
 	void RebuildBindingCacheIfNeeded(float IntervalSeconds = 1.0f);
 
@@ -42,6 +56,10 @@ public:
 private:
 	TWeakObjectPtr<AUnitRegistryReplicator> CachedRegistry;
 	TWeakObjectPtr<AUnitClientBubbleInfo> CachedBubble;
+	TWeakObjectPtr<AUnitClientBubbleInfo> CachedSharedBubble;
+	// Bubbles arrive by replication in any order; rescan (throttled) while only a shared one is known.
+	double LastBubbleScanTime = -1000.0;
+	double LastSharedBubbleScanTime = -1000.0;
 	TMap<FName, TWeakObjectPtr<UMassActorBindingComponent>> BindingByOwnerName;
 	TMap<int32, TWeakObjectPtr<UMassActorBindingComponent>> BindingByUnitIndex;
 	TMap<uint32, TWeakObjectPtr<UMassActorBindingComponent>> BindingByMassNetID;
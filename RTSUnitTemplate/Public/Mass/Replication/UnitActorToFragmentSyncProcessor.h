@@ -49,6 +49,9 @@ private:
 	void SyncAIState(const AUnitBase& Unit, FMassAIStateFragment& AIStateFragment, FMassCombatStatsFragment& CombatStatsFragment);
 	void SyncMoveTarget(const AUnitBase& Unit, FMassMoveTargetFragment& MoveTargetFragment);
 	void SyncAITarget(const AUnitBase& Unit, FMassAITargetFragment& AITarget, FMassEntityManager& EntityManager);
+	// Caches the nav-projected follow slot for the off-thread Attack/Pause state processors.
+	void UpdateFollowPosition(FMassEntityManager& EntityManager, const FMassEntityHandle Entity, FMassAITargetFragment& AITarget,
+		const FMassAgentCharacteristicsFragment* Characteristics, const FVector& CurrentLocation, bool bNeedsFollowPosition, UWorld* World);
 	void SyncVisibility(const AUnitBase& Unit, FMassVisibilityFragment& VisibilityFragment);
 	void SyncVisualEffect(const AUnitBase& Unit, FMassVisualEffectFragment& VisualEffectFragment);
 	void SyncPatrol(const AUnitBase& Unit, FMassPatrolFragment& PatrolFragment, FMassEntityManager& EntityManager, FMassEntityHandle EntityHandle);
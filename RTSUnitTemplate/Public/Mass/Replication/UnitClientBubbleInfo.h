@@ -112,6 +112,15 @@ struct FPlayerMouseData
 	}
 };
 
+// Server-only relevancy bookkeeping of one NetID in a team-filtered bubble (see net.RTS.Relevancy.*).
+struct FUnitRelevancyState
+{
+	// World time the unit became visible to the bubble's viewer; < 0 while not visible.
+	double VisibleSince = -1.0;
+	// Last world time the unit was visible to the bubble's viewer.
+	double LastVisible = -1.0;
+};
+
 UCLASS()
 class RTSUNITTEMPLATE_API AUnitClientBubbleInfo : public AMassClientBubbleInfoBase
 {
@@ -140,6 +149,18 @@ public:
 	UFUNCTION()
 	void OnRep_Agents();
 
+	// Bubbles without an owning connection are shared: with relevancy filtering they carry the
+	// always-relevant items for every client, while connection-owned bubbles carry that team's view.
+	bool IsSharedBubble() const { return GetOwner() == nullptr; }
+
+	// Alliance mask of the owning player (own team + allies), or 0 if the bubble is shared or the
+	// owner is a spectator / has no team yet. 0 means the bubble is not team-filtered.
+	int64 GetViewerAllianceMask() const;
+
+	// Server only: per-NetID enter/leave hysteresis for team-filtered bubbles.
+	TMap<FMassNetworkID, FUnitRelevancyState> RelevancyStates;
+	double LastRelevancySweepTime = 0.0;
+
 protected:
 	virtual void BeginPlay() override;
 };
@@ -112,28 +112,134 @@ struct FUnitReplicationArray : public FFastArraySerializer
 	UPROPERTY() TArray<FUnitReplicationItem> Items;
 	class AUnitClientBubbleInfo* OwnerBubble = nullptr;
 
+	/**
+	 * NetID -> index into Items. Kept exact by AddItem/RemoveItemByNetID on the server and rebuilt after
+	 * every client receive (PostReplicatedReceive). Lookups never mutate it, so they stay safe from
+	 * processors running concurrently; a stale or mismatching entry falls back to the linear scan.
+	 */
+	TMap<FMassNetworkID, int32> IndexByNetID;
+
+	// Set by the item replication callbacks until PostReplicatedReceive rebuilds the index.
+	mutable bool bNetIDIndexDirty = false;
+
+	// Items.Num() when the index was last made consistent; catches direct Items edits.
+	int32 IndexedItemCount = 0;
+
+	// Items holds a NetID more than once (only the first is indexed).
+	bool bHasDuplicateNetIDs = false;
+
 	FUnitReplicationItem* FindItemByNetID(const FMassNetworkID& NetID)
 	{
-		for (FUnitReplicationItem& Item : Items)
+		const int32 Index = FindIndexByNetID(NetID);
+		return Index != INDEX_NONE ? &Items[Index] : nullptr;
+	}
+
+	const FUnitReplicationItem* FindItemByNetID(const FMassNetworkID& NetID) const
+	{
+		const int32 Index = FindIndexByNetID(NetID);
+		return Index != INDEX_NONE ? &Items[Index] : nullptr;
+	}
+
+	int32 FindIndexByNetID(const FMassNetworkID& NetID) const
+	{
+		if (!bNetIDIndexDirty && IndexedItemCount == Items.Num())
 		{
-			if (Item.NetID == NetID) return &Item;
+			if (const int32* Found = IndexByNetID.Find(NetID))
+			{
+				if (Items.IsValidIndex(*Found) && Items[*Found].NetID == NetID)
+				{
+					return *Found;
+				}
+			}
+			else
+			{
+				return INDEX_NONE;
+			}
 		}
-		return nullptr;
+
+		for (int32 i = 0; i < Items.Num(); ++i)
+		{
+			if (Items[i].NetID == NetID) return i;
+		}
+		return INDEX_NONE;
 	}
 
-	const FUnitReplicationItem* FindItemByNetID(const FMassNetworkID& NetID) const
+	// Appends the item and indexes it. The caller still marks the item/array dirty.
+	int32 AddItem(const FUnitReplicationItem& NewItem)
 	{
-		for (const FUnitReplicationItem& Item : Items)
+		EnsureNetIDIndex();
+		const int32 NewIdx = Items.Add(NewItem);
+		if (IndexByNetID.Contains(NewItem.NetID))
 		{
-			if (Item.NetID == NetID) return &Item;
+			bHasDuplicateNetIDs = true;
 		}
-		return nullptr;
+		else
+		{
+			IndexByNetID.Add(NewItem.NetID, NewIdx);
+		}
+		IndexedItemCount = Items.Num();
+		return NewIdx;
 	}
 
+	// Swap-removes every item with this NetID. The caller still marks the array dirty.
 	bool RemoveItemByNetID(const FMassNetworkID& NetID)
 	{
-		const int32 Removed = Items.RemoveAll([&NetID](const FUnitReplicationItem& Item) { return Item.NetID == NetID; });
-		return Removed > 0;
+		EnsureNetIDIndex();
+
+		int32 Index = INDEX_NONE;
+		if (!IndexByNetID.RemoveAndCopyValue(NetID, Index))
+		{
+			return false;
+		}
+
+		Items.RemoveAtSwap(Index);
+		if (Items.IsValidIndex(Index))
+		{
+			IndexByNetID.Add(Items[Index].NetID, Index);
+		}
+		IndexedItemCount = Items.Num();
+
+		// Duplicates are never indexed; only then is a rebuild needed to find and drop the rest.
+		if (bHasDuplicateNetIDs)
+		{
+			Items.RemoveAll([&NetID](const FUnitReplicationItem& Item) { return Item.NetID == NetID; });
+			RebuildNetIDIndex();
+		}
+		return true;
+	}
+
+	void RebuildNetIDIndex()
+	{
+		IndexByNetID.Reset();
+		IndexByNetID.Reserve(Items.Num());
+		bHasDuplicateNetIDs = false;
+		for (int32 i = 0; i < Items.Num(); ++i)
+		{
+			// First occurrence wins, matching the linear scan.
+			if (IndexByNetID.Contains(Items[i].NetID))
+			{
+				bHasDuplicateNetIDs = true;
+				continue;
+			}
+			IndexByNetID.Add(Items[i].NetID, i);
+		}
+		IndexedItemCount = Items.Num();
+		bNetIDIndexDirty = false;
+	}
+
+	void EnsureNetIDIndex()
+	{
+		if (bNetIDIndexDirty || IndexedItemCount != Items.Num())
+		{
+			RebuildNetIDIndex();
+		}
+	}
+
+	void MarkNetIDIndexDirty() const { bNetIDIndexDirty = true; }
+
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+	{
+		RebuildNetIDIndex();
 	}
 
 	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
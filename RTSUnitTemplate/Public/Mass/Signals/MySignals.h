@@ -33,7 +33,6 @@ namespace UnitSignals
 	// Define other signal names here if needed
 	const FName MeleeAttack(TEXT("MeeleAttack"));
 	const FName RangedAttack(TEXT("RangedAttack"));
-	const FName UnitInDetectionRange(TEXT("UnitInDetectionRange"));
 	const FName UnitSpawned(TEXT("UnitSpawned"));
 	const FName SetUnitToChase(TEXT("SetUnitToChase"));
 	const FName StartDead(TEXT("StartDead"));
@@ -10,6 +10,8 @@
 // ================================
 #include "Core/UnitData.h" // Dein Enum etc.
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
+#include "Mass/States/StateGameThreadBatch.h"
 #include "AttackStateProcessor.generated.h"
 
 // Forward Decls für Fragmente, Tags und Systeme
@@ -26,6 +28,7 @@ struct FMassStatePauseTag;
 struct FMassStateChaseTag;
 struct FMassStateIdleTag; // Falls Ziel verloren geht
 class UMassSignalSubsystem; // Für Schadens-Signale
+class UUnitSpatialGridSubsystem;
 
 // Beispiel für eine Signal-Payload Struktur (optional, aber gut für klare Datenübergabe)
 USTRUCT()
@@ -70,11 +73,18 @@ protected:
 private:
     FMassEntityQuery EntityQuery;
 
-    float TimeSinceLastRun = 0.0f;
+    FMassTimeSlice TimeSlice;
+
+    // Actor and bubble writes recorded during Execute, flushed to the game thread at its end.
+    FMassStateGameThreadBatch GameThreadBatch;
     
     // Cached Subsystem Pointer
     UPROPERTY(Transient)
     TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
 
+    // Per-frame target snapshot (FindEntry), read instead of the target's fragments.
+    UPROPERTY(Transient)
+    TObjectPtr<UUnitSpatialGridSubsystem> SpatialGrid;
+
     float FollowAcceptanceMultiplier = 6.f;
 };
\ No newline at end of file
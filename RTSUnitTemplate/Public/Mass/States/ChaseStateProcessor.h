@@ -6,8 +6,11 @@
 #include "MassSignalSubsystem.h"
 #include "Core/RTSUnitUtils.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
+#include "Mass/States/StateGameThreadBatch.h"
 #include "ChaseStateProcessor.generated.h"
 
+class UUnitSpatialGridSubsystem;
 struct FMassEntityManager;
 struct FMassExecutionContext;
 struct FMassStateChaseTag; // Tag für diesen Zustand
@@ -48,8 +51,15 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
+
+	// Actor and bubble writes recorded during Execute, flushed to the game thread at its end.
+	FMassStateGameThreadBatch GameThreadBatch;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
+
+	// Per-frame target snapshot (FindEntry), read instead of the target's fragments.
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitSpatialGridSubsystem> SpatialGrid;
 };
\ No newline at end of file
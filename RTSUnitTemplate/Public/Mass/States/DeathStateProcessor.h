@@ -5,6 +5,7 @@
 #include "MassProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "DeathStateProcessor.generated.h"
 
 struct FMassExecutionContext;
@@ -45,7 +46,7 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
@@ -7,6 +7,7 @@
 #include "MassSignalSubsystem.h"
 #include "Core/RTSUnitUtils.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "IdleStateProcessor.generated.h"
 
 // Forward declare Fragments and Tags used
@@ -62,7 +63,7 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 	float FollowAcceptanceMultiplier = 6.f;
 	float TresholdAcceptanceMultiplier = 6.f;
 	// --- Konfigurationswerte ---
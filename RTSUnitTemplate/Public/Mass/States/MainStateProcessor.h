@@ -8,6 +8,7 @@
 #include "MassExecutionContext.h"
 #include "Mass/UnitMassTag.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "MainStateProcessor.generated.h"
 
 /**
@@ -37,7 +38,7 @@ public:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRunA = 0.0f;
+	FMassTimeSlice TimeSlice;
 	float TimeSinceLastRunB = 0.0f;
 
 	UPROPERTY(Transient)
@@ -5,6 +5,7 @@
 #include "MassProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "PatrolIdleStateProcessor.generated.h"
 
 // Forward Decls...
@@ -35,7 +36,7 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
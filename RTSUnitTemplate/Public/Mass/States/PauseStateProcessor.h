@@ -5,9 +5,12 @@
 #include "MassProcessor.h"
 #include "MassSignalSubsystem.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
+#include "Mass/States/StateGameThreadBatch.h"
 #include "PauseStateProcessor.generated.h"
 
 class UMassSignalSubsystem;
+class UUnitSpatialGridSubsystem;
 class UMassEntitySubsystem;
 struct FMassExecutionContext;
 struct FMassStatePauseTag;
@@ -61,11 +64,18 @@ private:
 
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
+
+	// Actor writes recorded during Execute, flushed to the game thread at its end.
+	FMassStateGameThreadBatch GameThreadBatch;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
 
+	// Per-frame target snapshot (FindEntry), read instead of the target's fragments.
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitSpatialGridSubsystem> SpatialGrid;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UMassEntitySubsystem> EntitySubsystem;
 
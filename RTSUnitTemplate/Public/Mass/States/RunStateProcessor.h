@@ -6,6 +6,7 @@
 #include "MassSignalSubsystem.h"
 #include "Core/RTSUnitUtils.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "RunStateProcessor.generated.h"
 
 struct FMassEntityManager;
@@ -48,7 +49,7 @@ public:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 	
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
@@ -0,0 +1,50 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassReplicationTypes.h"
+#include "Core/UnitData.h"
+
+class AActor;
+class AUnitBase;
+struct FMassExecutionContext;
+
+/**
+ * Actor and UObject writes collected by a state processor that runs off the game thread.
+ * The per-entity decision logic only records what has to happen; Flush() hands everything to
+ * the game thread as one deferred Mass command, which runs when the phase flushes its command buffer.
+ *
+ * Not thread safe: fill it from one Execute() (ForEachEntityChunk runs the chunks sequentially).
+ */
+struct RTSUNITTEMPLATE_API FMassStateGameThreadBatch
+{
+	// UnitStatePlaceholder write on the unit actor. Ignored if Actor is not an AUnitBase.
+	void SetPlaceholder(AActor* Actor, UnitData::EState State);
+
+	// PredictionTimer changes on the client's replicated bubble item, applied in recording order.
+	void AddPredictionTime(const FMassNetworkID& NetID, float Seconds);
+	void ResetPredictionTimer(const FMassNetworkID& NetID, bool bClearPredictedLatch = false);
+
+	bool IsEmpty() const { return Placeholders.IsEmpty() && PredictionOps.IsEmpty(); }
+
+	// Pushes the collected writes into Context's command buffer and empties the batch.
+	void Flush(FMassExecutionContext& Context);
+
+private:
+	struct FPlaceholderWrite
+	{
+		TWeakObjectPtr<AUnitBase> Unit;
+		UnitData::EState State;
+	};
+
+	struct FPredictionTimerOp
+	{
+		FMassNetworkID NetID;
+		float AddSeconds = 0.f;
+		bool bReset = false;
+		bool bClearPredictedLatch = false;
+	};
+
+	TArray<FPlaceholderWrite> Placeholders;
+	TArray<FPredictionTimerOp> PredictionOps;
+};
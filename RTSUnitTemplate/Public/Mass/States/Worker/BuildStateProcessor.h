@@ -6,6 +6,7 @@
 #include "MassSignalSubsystem.h"
 #include "MassEntityTypes.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "BuildStateProcessor.generated.h"
 
 struct FMassAIStateFragment;
@@ -47,7 +48,7 @@ private:
 	// BuildFacingToleranceDeg. Shared by server and client so the facing matches on both.
 	void FaceBuildArea(FMassExecutionContext& Context, const int32 EntityIdx);
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
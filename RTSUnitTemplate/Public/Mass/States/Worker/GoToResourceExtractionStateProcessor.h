@@ -6,6 +6,7 @@
 #include "MassEntityTypes.h"         // Required for FMassEntityQuery
 #include "MassSignalSubsystem.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "GoToResourceExtractionStateProcessor.generated.h"
 
 // Forward declaration
@@ -42,7 +43,7 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
@@ -6,6 +6,7 @@
 #include "MassSignalSubsystem.h"
 #include "MassEntityTypes.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "RepairStateProcessor.generated.h"
 
 struct FMassAIStateFragment;
@@ -36,7 +37,7 @@ public:
 
 private:
 	FMassEntityQuery EntityQuery;
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
 };
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "MassSignalSubsystem.h"
 #include "MassEntitySubsystem.h"
 #include "MassEntityQuery.h"
+#include "Mass/MassTimeSlice.h"
 #include "ResourceExtractionStateProcessor.generated.h"
 
 // Forward declaration
@@ -40,7 +41,7 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
-	float TimeSinceLastRun = 0.0f;
+	FMassTimeSlice TimeSlice;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
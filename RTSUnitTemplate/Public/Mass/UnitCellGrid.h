@@ -0,0 +1,152 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Flat uniform 2D cell grid (world XY) over item indices.
+ * Build() buckets a location array with a counting sort, so rebuilding every frame reuses the
+ * allocations and a cell lookup is one hash probe plus a contiguous index range.
+ * Items are plain indices into whatever array the caller built the grid from.
+ */
+struct FUnitCellGrid2D
+{
+	void Reset(float InCellSize, int32 ExpectedNum = 0)
+	{
+		CellSize = FMath::Max(1.f, InCellSize);
+		ItemCells.Reset(ExpectedNum);
+		SortedItems.Reset(ExpectedNum);
+		Cells.Reset();
+	}
+
+	// Items must be added in index order (0..N-1).
+	void AddItem(const FVector& Location)
+	{
+		ItemCells.Add(GetCellCoord(Location));
+	}
+
+	void Finalize()
+	{
+		for (const FIntPoint& Cell : ItemCells)
+		{
+			Cells.FindOrAdd(Cell).Num++;
+		}
+
+		int32 Offset = 0;
+		for (TPair<FIntPoint, FCellRange>& Pair : Cells)
+		{
+			Pair.Value.Start = Offset;
+			Offset += Pair.Value.Num;
+			Pair.Value.Num = 0;
+		}
+
+		SortedItems.SetNumUninitialized(ItemCells.Num());
+		for (int32 i = 0; i < ItemCells.Num(); ++i)
+		{
+			FCellRange& Range = Cells.FindChecked(ItemCells[i]);
+			SortedItems[Range.Start + Range.Num++] = i;
+		}
+	}
+
+	int32 Num() const { return ItemCells.Num(); }
+	float GetCellSize() const { return CellSize; }
+
+	FIntPoint GetCellCoord(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	}
+
+	FIntPoint GetItemCell(int32 ItemIndex) const { return ItemCells[ItemIndex]; }
+
+	/** Calls Func(int32 ItemIndex) for every item in a cell overlapped by the circle's bounding square (broad phase). */
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		ForEachInBox2D(FVector2D(Center) - FVector2D(Radius), FVector2D(Center) + FVector2D(Radius), Func);
+	}
+
+	/** Calls Func(int32 ItemIndex) for every item in a cell overlapped by the XY box (broad phase). */
+	template<typename FuncType>
+	void ForEachInBox2D(const FVector2D& BoxMin, const FVector2D& BoxMax, FuncType&& Func) const
+	{
+		if (ItemCells.Num() == 0)
+		{
+			return;
+		}
+
+		const FIntPoint Min = GetCellCoord(FVector(BoxMin, 0.f));
+		const FIntPoint Max = GetCellCoord(FVector(BoxMax, 0.f));
+		const int64 NumQueryCells = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+
+		// Huge radius compared to the populated area: walking the occupied cells is cheaper than the rect.
+		if (NumQueryCells > Cells.Num())
+		{
+			for (const TPair<FIntPoint, FCellRange>& Pair : Cells)
+			{
+				if (Pair.Key.X >= Min.X && Pair.Key.X <= Max.X && Pair.Key.Y >= Min.Y && Pair.Key.Y <= Max.Y)
+				{
+					ForEachInRange(Pair.Value, Func);
+				}
+			}
+			return;
+		}
+
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				if (const FCellRange* Range = Cells.Find(FIntPoint(X, Y)))
+				{
+					ForEachInRange(*Range, Func);
+				}
+			}
+		}
+	}
+
+	/** Calls Func(int32 ItemIndex) for every item in Cell. */
+	template<typename FuncType>
+	void ForEachInCell(const FIntPoint& Cell, FuncType&& Func) const
+	{
+		if (const FCellRange* Range = Cells.Find(Cell))
+		{
+			ForEachInRange(*Range, Func);
+		}
+	}
+
+	/** Calls Func(int32 ItemIndex) for every item in the 3x3 cell block around Cell. */
+	template<typename FuncType>
+	void ForEachInNeighborhood(const FIntPoint& Cell, FuncType&& Func) const
+	{
+		for (int32 Y = Cell.Y - 1; Y <= Cell.Y + 1; ++Y)
+		{
+			for (int32 X = Cell.X - 1; X <= Cell.X + 1; ++X)
+			{
+				if (const FCellRange* Range = Cells.Find(FIntPoint(X, Y)))
+				{
+					ForEachInRange(*Range, Func);
+				}
+			}
+		}
+	}
+
+private:
+	struct FCellRange
+	{
+		int32 Start = 0;
+		int32 Num = 0;
+	};
+
+	template<typename FuncType>
+	void ForEachInRange(const FCellRange& Range, FuncType& Func) const
+	{
+		for (int32 k = 0; k < Range.Num; ++k)
+		{
+			Func(SortedItems[Range.Start + k]);
+		}
+	}
+
+	TArray<FIntPoint> ItemCells;
+	TArray<int32> SortedItems;
+	TMap<FIntPoint, FCellRange> Cells;
+	float CellSize = 1000.f;
+};
@@ -559,30 +559,108 @@ struct FMassAllianceFragment : public FMassFragment
 	int64 AlliedTeamsMask = 0;
 };
 
+// Number of team slots in the fixed-layout sight counters. Team ids must be in [0, RTS_MAX_SIGHT_TEAMS).
+// Override via PublicDefinitions in the Build.cs when a project uses more teams (max 64, matching AlliedTeamsMask).
+#ifndef RTS_MAX_SIGHT_TEAMS
+#define RTS_MAX_SIGHT_TEAMS 16
+#endif
+
+/** Team-indexed overlap counters. Reset/commit are memset/memcpy, no hashing or heap. */
+struct FTeamSightCounters
+{
+	static constexpr int32 MaxTeams = RTS_MAX_SIGHT_TEAMS;
+	static_assert(MaxTeams > 0 && MaxTeams <= 64, "RTS_MAX_SIGHT_TEAMS must fit the int64 alliance mask");
+
+	uint16 Counts[MaxTeams] = {};
+
+	static bool IsValidTeam(const int32 TeamId) { return TeamId >= 0 && TeamId < MaxTeams; }
+
+	void Reset() { FMemory::Memzero(Counts, sizeof(Counts)); }
+
+	void Increment(const int32 TeamId)
+	{
+		if (IsValidTeam(TeamId) && Counts[TeamId] < MAX_uint16)
+		{
+			++Counts[TeamId];
+		}
+	}
+
+	int32 Get(const int32 TeamId) const { return IsValidTeam(TeamId) ? Counts[TeamId] : 0; }
+
+	bool AnyNonZero() const
+	{
+		for (int32 Team = 0; Team < MaxTeams; ++Team)
+		{
+			if (Counts[Team] > 0) return true;
+		}
+		return false;
+	}
+
+	// True if any team whose bit is set in TeamMask has a non-zero count.
+	bool AnyInMask(const int64 TeamMask) const
+	{
+		for (int32 Team = 0; Team < MaxTeams; ++Team)
+		{
+			if (Counts[Team] > 0 && (TeamMask & (1LL << Team)) != 0) return true;
+		}
+		return false;
+	}
+
+	// Bit per team with a non-zero count.
+	uint64 GetNonZeroMask() const
+	{
+		uint64 Mask = 0;
+		for (int32 Team = 0; Team < MaxTeams; ++Team)
+		{
+			if (Counts[Team] > 0) Mask |= 1ULL << Team;
+		}
+		return Mask;
+	}
+};
+
 USTRUCT()
 struct FMassSightFragment : public FMassFragment
 {
 	GENERATED_BODY()
-	
-	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
-	TMap<int32, int32> TeamOverlapsPerTeam;
+
+	/** Overlaps this target has *per team* in the running sight pass. */
+	FTeamSightCounters TeamOverlapsPerTeam;
 
 	/** How many overlaps this target has *per team* from detectors that can see invisibles. */
-	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
-	TMap<int32, int32> DetectorOverlapsPerTeam;
+	FTeamSightCounters DetectorOverlapsPerTeam;
 
-	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
-	TMap<int32, int32> AttackerTeamOverlapsPerTeam;
-	
-	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
-	TMap<int32, int32> ConsistentDetectorOverlapsPerTeam;
+	FTeamSightCounters AttackerTeamOverlapsPerTeam;
 
-	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
-	TMap<int32, int32> ConsistentTeamOverlapsPerTeam;
+	// Last committed results, read by detection, visibility and fog.
+	FTeamSightCounters ConsistentDetectorOverlapsPerTeam;
+	FTeamSightCounters ConsistentTeamOverlapsPerTeam;
+	FTeamSightCounters ConsistentAttackerTeamOverlapsPerTeam;
 
-	UPROPERTY(VisibleAnywhere, Transient, Category = RTSUnitTemplate)
-	TMap<int32, int32> ConsistentAttackerTeamOverlapsPerTeam;
-	
+	// Per-team enter/exit state last sent by UUnitSightProcessor; signals are only emitted on changes.
+	uint64 SignaledVisibleTeamsMask = 0;
+	uint64 SignaledTeamsMask = 0;
+
+	void ResetAll()
+	{
+		TeamOverlapsPerTeam.Reset();
+		DetectorOverlapsPerTeam.Reset();
+		AttackerTeamOverlapsPerTeam.Reset();
+		ConsistentTeamOverlapsPerTeam.Reset();
+		ConsistentDetectorOverlapsPerTeam.Reset();
+		ConsistentAttackerTeamOverlapsPerTeam.Reset();
+		SignaledVisibleTeamsMask = 0;
+		SignaledTeamsMask = 0;
+	}
+
+	// Publishes the running counters to the Consistent* copies and clears them for the next pass.
+	void CommitAndReset()
+	{
+		ConsistentDetectorOverlapsPerTeam = DetectorOverlapsPerTeam;
+		ConsistentTeamOverlapsPerTeam = TeamOverlapsPerTeam;
+		ConsistentAttackerTeamOverlapsPerTeam = AttackerTeamOverlapsPerTeam;
+		TeamOverlapsPerTeam.Reset();
+		DetectorOverlapsPerTeam.Reset();
+	}
 };
 
 USTRUCT()
@@ -689,6 +767,14 @@ struct FMassAITargetFragment : public FMassFragment
 
 	UPROPERTY(VisibleAnywhere, Category = "AI", Transient)
 	float FollowOffset = 0.f;
+
+	/** Follow slot around FriendlyTargetEntity, nav-projected on the game thread by UUnitActorToFragmentSyncProcessor
+	 *  for units in Attack or Pause. Those state processors run on worker threads and only read this value. */
+	UPROPERTY(VisibleAnywhere, Category = "AI", Transient)
+	FVector CachedFollowPosition = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "AI", Transient)
+	bool bHasCachedFollowPosition = false;
 };
 
 //----------------------------------------------------------------------//
@@ -0,0 +1,33 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "UnitPickingProcessor.generated.h"
+
+class UUnitPickingSubsystem;
+
+/**
+ * Rebuilds UUnitPickingSubsystem once per frame from the hoverable units and effect areas.
+ * Runs before the hover processors; the HUD marquee selection reads the same snapshot in DrawHUD.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitPickingProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UUnitPickingProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitPickingSubsystem> PickingSubsystem;
+};
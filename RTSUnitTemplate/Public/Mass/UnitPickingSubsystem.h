@@ -0,0 +1,94 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreGlobals.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "Mass/UnitCellGrid.h"
+#include "UnitPickingSubsystem.generated.h"
+
+class APlayerController;
+
+enum class EUnitPickKind : uint8
+{
+	Unit,
+	EffectArea,
+};
+
+/**
+ * Pick volume of one hoverable entity: an upright cylinder from Base to Base + Height.
+ * Radius is the largest horizontal extent, so box units are covered in every direction;
+ * the exact shape test (GetRadiusInDirection, screen projection) stays with the caller.
+ *
+ * The marquee tests the rendered ISM instances instead, which FMassUnitVisualInstance::BaseOffset and the
+ * visual tweens can move off the cylinder. VisualRadius (XY distance from Base) and VisualMinZ/VisualMaxZ
+ * bound those instance locations; the defaults mean no instance outside the cylinder.
+ */
+struct FUnitPickEntry
+{
+	FMassEntityHandle Entity;
+	FVector Base = FVector::ZeroVector;
+	float Height = 0.f;
+	float Radius = 0.f;
+	float VisualRadius = 0.f;
+	float VisualMinZ = MAX_flt;
+	float VisualMaxZ = -MAX_flt;
+	EUnitPickKind Kind = EUnitPickKind::Unit;
+};
+
+/**
+ * Local picking structure for hover, click and marquee selection.
+ * UUnitPickingProcessor rebuilds it once per frame from FTransformFragment into a uniform XY grid with
+ * the height band of all entries, so ray, screen-rectangle and radius picks only visit the cells under
+ * the cursor or the marquee instead of testing every unit.
+ *
+ * All queries are broad phase and return entry indices into GetEntries(); callers keep their exact tests.
+ * Not created on dedicated servers, which have no cursor.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitPickingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	// Starts a new build: clears entries and cells but keeps allocations.
+	void BeginRebuild(float InCellSize, int32 ExpectedNum = 0);
+
+	void AddEntry(const FUnitPickEntry& Entry);
+
+	void FinishRebuild();
+
+	// False until the first build. The snapshot is kept between builds, so the HUD can pick after the Mass tick.
+	bool HasSnapshot() const { return LastBuildFrame != MAX_uint64; }
+
+	const TArray<FUnitPickEntry>& GetEntries() const { return Entries; }
+
+	// Entries whose pick volume may intersect the ray, up to MaxDistance along Direction (normalized).
+	void QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, TArray<int32>& OutEntryIndices) const;
+
+	// Entries whose pick volume may project into the screen rectangle of PC's view (corners in any order).
+	void QueryScreenRect(const APlayerController& PC, const FVector2D& RectA, const FVector2D& RectB, TArray<int32>& OutEntryIndices) const;
+
+	// Same for a rectangle already deprojected into its four corner rays (origins and normalized directions).
+	void QueryCornerRays(const FVector (&Origins)[4], const FVector (&Directions)[4], TArray<int32>& OutEntryIndices) const;
+
+	// Entries whose pick volume may overlap the 2D circle.
+	void QueryRadius2D(const FVector& Center, float Radius, TArray<int32>& OutEntryIndices) const;
+
+private:
+	void QueryBox2D(const FVector2D& BoxMin, const FVector2D& BoxMax, TArray<int32>& OutEntryIndices) const;
+
+	TArray<FUnitPickEntry> Entries;
+	FUnitCellGrid2D Grid;
+
+	// Bounds over all entries of the last build, visual instances included: grid queries are inflated by
+	// MaxRadius, ray and frustum are clipped to the Z band.
+	float MaxRadius = 0.f;
+	float MinZ = 0.f;
+	float MaxZ = 0.f;
+	uint64 LastBuildFrame = MAX_uint64;
+};
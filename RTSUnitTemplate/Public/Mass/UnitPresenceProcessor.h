@@ -0,0 +1,33 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "UnitPresenceProcessor.generated.h"
+
+class UUnitPresenceSubsystem;
+
+/**
+ * Publishes the detectable units of this frame to UUnitPresenceSubsystem, which UDetectionProcessor
+ * reads directly. Runs right before detection.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitPresenceProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UUnitPresenceProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitPresenceSubsystem> PresenceSubsystem;
+};
@@ -0,0 +1,91 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreGlobals.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "UnitPresenceSubsystem.generated.h"
+
+/**
+ * One detectable unit as published by UUnitPresenceProcessor: everything UDetectionProcessor reads from a
+ * target, packed by value so the row stays valid after structural changes later in the frame.
+ */
+struct FUnitPresenceEntry
+{
+	FMassEntityHandle Entity;
+	FVector Location = FVector::ZeroVector;
+	int32 TeamId = INDEX_NONE;
+	float Health = 0.f;
+	float CapsuleRadius = 0.f;
+	float BirthTime = 0.f;
+	float DeathTime = 0.f;
+	// Teams with a non-zero FMassSightFragment::ConsistentTeam/Detector/AttackerTeamOverlapsPerTeam count.
+	uint64 SeenByTeamsMask = 0;
+	uint64 DetectedByTeamsMask = 0;
+	uint64 AttackedByTeamsMask = 0;
+	bool bCanAttack = true;
+	bool bIsFlying = false;
+	bool bIsInvisible = false;
+	// False for rows injected from an entity without FMassAgentCharacteristicsFragment; such targets are always in sight.
+	bool bHasCharacteristics = true;
+
+	bool IsSeenByTeam(const int32 Team) const { return Team >= 0 && Team < 64 && (SeenByTeamsMask & (1ULL << Team)) != 0; }
+	bool IsDetectedByTeam(const int32 Team) const { return Team >= 0 && Team < 64 && (DetectedByTeamsMask & (1ULL << Team)) != 0; }
+	bool IsAttackedByTeam(const int32 Team) const { return Team >= 0 && Team < 64 && (AttackedByTeamsMask & (1ULL << Team)) != 0; }
+};
+
+/**
+ * Per-frame list of the units detection may pick as targets (alive, no FMassStopUnitDetectionTag).
+ * Detection reads it directly instead of receiving every unit through UMassSignalSubsystem each frame.
+ *
+ * Double buffered: UUnitPresenceProcessor fills the back buffer and Publish() swaps it to the front, so the
+ * published rows stay untouched until the next publish. Time-sliced detection runs in frames without a
+ * publish keep reading the last snapshot.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitPresenceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Clears the back buffer (keeping its allocations) for a new snapshot.
+	void BeginWrite(int32 ExpectedNum = 0);
+
+	void AddEntry(const FUnitPresenceEntry& Entry);
+
+	// Makes the back buffer the published snapshot.
+	void Publish();
+
+	const TArray<FUnitPresenceEntry>& GetEntries() const { return Buffers[FrontIndex].Entries; }
+
+	// Row of Entity in the published snapshot, or INDEX_NONE.
+	int32 FindEntryIndex(const FMassEntityHandle Entity) const
+	{
+		const FBuffer& Front = Buffers[FrontIndex];
+		if (!Front.EntryIndexByEntityIndex.IsValidIndex(Entity.Index))
+		{
+			return INDEX_NONE;
+		}
+		// Slots are never cleared: a stale index points at another entity's row (or past the end) and fails here.
+		const int32 EntryIndex = Front.EntryIndexByEntityIndex[Entity.Index];
+		return Front.Entries.IsValidIndex(EntryIndex) && Front.Entries[EntryIndex].Entity == Entity ? EntryIndex : INDEX_NONE;
+	}
+
+	// GFrameCounter of the last Publish, MAX_uint64 before the first one.
+	uint64 GetPublishFrame() const { return LastPublishFrame; }
+
+private:
+	struct FBuffer
+	{
+		TArray<FUnitPresenceEntry> Entries;
+		// Entry row per FMassEntityHandle::Index. Grows with the highest index seen, see FindEntryIndex.
+		TArray<int32> EntryIndexByEntityIndex;
+	};
+
+	FBuffer Buffers[2];
+	int32 FrontIndex = 0;
+	uint64 LastPublishFrame = MAX_uint64;
+};
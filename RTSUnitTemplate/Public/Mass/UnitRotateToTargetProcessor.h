@@ -6,6 +6,11 @@
 #include "MassEntityQuery.h"
 #include "UnitRotateToTargetProcessor.generated.h"
 
+/**
+ * Turns yaw-follow units (FMassUnitYawFollowTag) towards their enemy target.
+ * Runs off the game thread: gathers fragment data, solves the rotations in a ParallelFor and writes them back;
+ * skeletal units get their actor rotation in one batched game-thread task.
+ */
 UCLASS()
 class RTSUNITTEMPLATE_API UUnitRotateToTargetProcessor : public UMassProcessor
 {
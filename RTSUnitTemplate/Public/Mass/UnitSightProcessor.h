@@ -29,6 +29,9 @@ protected:
 	UFUNCTION()
 	void HandleSightSignals(FName SignalName, TArray<FMassEntityHandle>& Entities);
 
+	// Applies one enter/exit sight change to the target actor (game thread).
+	void ApplySightSignal(FName SignalName, FMassEntityHandle TargetEntity, FMassEntityHandle DetectorEntity);
+
 private:
 	// Split execute paths for server and client
 	void ExecuteServer(FMassEntityManager& EntityManager, FMassExecutionContext& Context);
@@ -46,9 +49,12 @@ private:
 	// Query for Projectiles
 	FMassEntityQuery ProjectileQuery;
 	
+	// Not time-sliced with FMassTimeSlice: the per-team overlap counters are rebuilt from all detectors in one pass.
 	float TimeSinceLastRun = 0.0f;
 	const float ExecutionInterval = 0.2f; // Intervall für die Detektion (z.B. 5x pro Sekunde)
 
+	float TimeSinceFullSightResync = 0.0f;
+
 	UPROPERTY(Transient)
 	TObjectPtr<UMassSignalSubsystem> SignalSubsystem;
 
@@ -0,0 +1,34 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "UnitSpatialGridProcessor.generated.h"
+
+class UUnitSpatialGridSubsystem;
+
+/**
+ * Rebuilds UUnitSpatialGridSubsystem once per Mass frame from FTransformFragment.
+ * Runs before UDetectionProcessor, UUnitSightProcessor and the Behavior group (combat states)
+ * so all of them query the same fresh grid and target snapshot.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitSpatialGridProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UUnitSpatialGridProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UUnitSpatialGridSubsystem> GridSubsystem;
+};
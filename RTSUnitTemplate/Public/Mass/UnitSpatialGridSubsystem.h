@@ -0,0 +1,100 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreGlobals.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "Mass/UnitCellGrid.h"
+#include "UnitSpatialGridSubsystem.generated.h"
+
+/**
+ * One unit as gathered at the start of the frame. Besides feeding the grid this is the per-frame
+ * target snapshot: combat states and detection read their target's position, radius, health and team
+ * from here instead of looking up three fragments on a random archetype per check.
+ */
+struct FUnitSpatialGridEntry
+{
+	FMassEntityHandle Entity;
+	FVector Location = FVector::ZeroVector;
+	float Radius = 0.f;
+	int32 TeamId = INDEX_NONE;
+	float Health = 0.f;
+	// FMassAgentCharacteristicsFragment::LastGroundLocation (ground Z under the unit).
+	float GroundZ = 0.f;
+	bool bIsFlying = false;
+	// Box-shaped units (buildings) need the full characteristics fragment for their directional radius.
+	bool bUseBoxComponent = false;
+	bool bCanAttack = true;
+};
+
+/**
+ * Uniform 2D spatial hash (world XY) over all live unit entities.
+ * Rebuilt once per Mass frame by UUnitSpatialGridProcessor from FTransformFragment, then queried
+ * by UDetectionProcessor and UUnitSightProcessor so they only visit cells inside their radii
+ * instead of comparing every detector against every target.
+ * FindEntry() gives O(1) access to the same rows by entity handle.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitSpatialGridSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Starts a new build: clears entries and cells but keeps allocations.
+	void BeginRebuild(float InCellSize, int32 ExpectedNum = 0);
+
+	void AddEntry(const FUnitSpatialGridEntry& Entry);
+
+	// Buckets all added entries into cells and stamps the build with the current frame.
+	void FinishRebuild();
+
+	// True if the grid was rebuilt during the current engine frame. Consumers fall back to a full scan otherwise.
+	bool IsBuiltThisFrame() const { return LastBuildFrame == GFrameCounter; }
+
+	float GetCellSize() const { return Grid.GetCellSize(); }
+
+	// Largest entry radius of the last build. Add it to query radii when the test includes the target's radius.
+	float GetMaxEntryRadius() const { return MaxEntryRadius; }
+
+	const TArray<FUnitSpatialGridEntry>& GetEntries() const { return Entries; }
+
+	// Row of Entity from this frame's build, or nullptr if the grid is stale or the entity was not gathered.
+	const FUnitSpatialGridEntry* FindEntry(const FMassEntityHandle Entity) const
+	{
+		if (!IsBuiltThisFrame() || !EntryIndexByEntityIndex.IsValidIndex(Entity.Index))
+		{
+			return nullptr;
+		}
+		// Slots are never cleared: a stale index points at another entity's row (or past the end) and fails here.
+		const int32 EntryIndex = EntryIndexByEntityIndex[Entity.Index];
+		return Entries.IsValidIndex(EntryIndex) && Entries[EntryIndex].Entity == Entity ? &Entries[EntryIndex] : nullptr;
+	}
+
+	/**
+	 * Calls Func(const FUnitSpatialGridEntry&) for every entry in a cell overlapped by the 2D circle.
+	 * This is a broad phase: entries slightly outside the radius are returned too, callers keep their exact checks.
+	 */
+	template<typename FuncType>
+	void ForEachEntryInRadius2D(const FVector& Center, float Radius, FuncType&& Func) const
+	{
+		Grid.ForEachInRadius(Center, Radius, [this, &Func](const int32 EntryIndex)
+		{
+			Func(Entries[EntryIndex]);
+		});
+	}
+
+	// Convenience wrapper collecting the entity handles of ForEachEntryInRadius2D.
+	void QueryEntitiesInRadius2D(const FVector& Center, float Radius, TArray<FMassEntityHandle>& OutEntities) const;
+
+private:
+	TArray<FUnitSpatialGridEntry> Entries;
+	// Entry row per FMassEntityHandle::Index. Grows with the highest index seen, see FindEntry.
+	TArray<int32> EntryIndexByEntityIndex;
+	FUnitCellGrid2D Grid;
+
+	float MaxEntryRadius = 0.f;
+	uint64 LastBuildFrame = MAX_uint64;
+};
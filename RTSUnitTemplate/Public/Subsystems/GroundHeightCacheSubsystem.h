@@ -0,0 +1,84 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreGlobals.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/UniquePtr.h"
+#include "GroundHeightCacheSubsystem.generated.h"
+
+/**
+ * Lazily filled 2D heightfield of the static ground (landscape + static WorldStatic meshes).
+ *
+ * The world is split into tiles of TileSize x TileSize samples, spaced RTS.GroundCache.Spacing apart.
+ * Tiles are allocated on first access and each sample is traced once, the first time a lookup needs it.
+ * Lookups interpolate the four surrounding samples bilinearly and derive the normal from the height gradient.
+ *
+ * A sample is only cached when the vertical ray finds exactly one static, non-building surface.
+ * Bridges/overhangs (multiple layers), buildings, movable geometry and empty columns are flagged as
+ * NeedsTrace, so callers fall back to their own physics trace there. Buildings and energy walls
+ * invalidate the samples under their bounds when they are placed or removed.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UGroundHeightCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 TileSize = 32;
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Resolves the ground height under Location. Game thread only (may trace missing samples).
+	 * @return false on a cache miss / multi-layer area / exhausted fill budget - the caller must trace itself.
+	 */
+	bool GetGroundHeight(const FVector& Location, float& OutZ, FVector& OutNormal);
+
+	// Marks every sample inside Bounds (XY, padded by one sample) as unknown so it is traced again on next use.
+	void InvalidateBounds(const FBox& Bounds);
+
+	// Convenience for actors that change the static ground: invalidates the actor's component bounds in its world.
+	static void InvalidateActorBounds(const AActor* Actor);
+
+	// Drops all tiles.
+	void InvalidateAll();
+
+private:
+	enum class ESampleState : uint8
+	{
+		Unknown,
+		Ground,
+		NeedsTrace,
+	};
+
+	struct FTile
+	{
+		float Heights[TileSize * TileSize];
+		ESampleState States[TileSize * TileSize];
+
+		FTile()
+		{
+			FMemory::Memzero(Heights);
+			FMemory::Memset(States, static_cast<uint8>(ESampleState::Unknown));
+		}
+	};
+
+	// Returns the sample state, tracing it first if it is unknown and the frame budget allows it.
+	ESampleState ResolveSample(int32 SampleX, int32 SampleY, float& OutZ);
+
+	// Single vertical multi-trace through the whole column at the sample position.
+	ESampleState TraceSample(int32 SampleX, int32 SampleY, float& OutZ) const;
+
+	FTile& FindOrAddTile(const FIntPoint& TileCoord);
+
+	static FIntPoint GetTileCoord(int32 SampleX, int32 SampleY);
+
+	TMap<FIntPoint, TUniquePtr<FTile>> Tiles;
+
+	// Spacing the current tiles were sampled with; a CVar change drops the cache.
+	float Spacing = 0.f;
+
+	uint64 BudgetFrame = MAX_uint64;
+	int32 SampleFillsThisFrame = 0;
+};
@@ -0,0 +1,56 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HudEventSubsystem.generated.h"
+
+class AControllerBase;
+class ALevelUnit;
+class AWinLoseConfigActor;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHudSelectionChanged, AControllerBase* /*Controller*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnHudAbilityCooldownChanged, int32 /*AbilityIndex*/, float /*RemainingTime*/);
+DECLARE_MULTICAST_DELEGATE(FOnHudResourcesChanged);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHudWinConditionChanged, AWinLoseConfigActor* /*Config*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHudUnitProgressChanged, ALevelUnit* /*Unit*/);
+
+/**
+ * Change notifications for the HUD widgets, so they redraw when their data changes instead of rebuilding
+ * everything on repeating timers.
+ *
+ * Producers notify where the data changes: replicated state from its OnRep, server-side writes directly, so
+ * listen servers and standalone games get the same events as clients. The selection has too many writers
+ * (HUD drag select, control groups, Blueprints) and is compared once per frame in AControllerBase::Tick.
+ *
+ * Events are local to this machine. Not created on dedicated servers, which have no HUD.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UHudEventSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// Selected units, focused unit (CurrentUnitWidgetIndex) or ability page of a local controller changed.
+	void NotifySelectionChanged(AControllerBase* Controller) { OnSelectionChanged.Broadcast(Controller); }
+
+	// Server answer to ACustomControllerBase::Server_RequestCooldown. RemainingTime 0 = ready.
+	void NotifyAbilityCooldown(int32 AbilityIndex, float RemainingTime) { OnAbilityCooldownChanged.Broadcast(AbilityIndex, RemainingTime); }
+
+	// AResourceGameState::TeamResources changed.
+	void NotifyResourcesChanged() { OnResourcesChanged.Broadcast(); }
+
+	// A win/lose config appeared, advanced to another condition or updated its tag progress.
+	void NotifyWinConditionChanged(AWinLoseConfigActor* Config) { OnWinConditionChanged.Broadcast(Config); }
+
+	// Level, experience, talent or ability points of a unit changed.
+	void NotifyUnitProgressChanged(ALevelUnit* Unit) { OnUnitProgressChanged.Broadcast(Unit); }
+
+	FOnHudSelectionChanged OnSelectionChanged;
+	FOnHudAbilityCooldownChanged OnAbilityCooldownChanged;
+	FOnHudResourcesChanged OnResourcesChanged;
+	FOnHudWinConditionChanged OnWinConditionChanged;
+	FOnHudUnitProgressChanged OnUnitProgressChanged;
+};
@@ -0,0 +1,86 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineTypes.h"
+#include "Components/SceneComponent.h"
+#include "PlacementIndexSubsystem.generated.h"
+
+class AActor;
+
+enum class EPlacementIndexFilter : uint8
+{
+	WorkAreas = 1 << 0,
+	Buildings = 1 << 1,
+	All = WorkAreas | Buildings
+};
+ENUM_CLASS_FLAGS(EPlacementIndexFilter);
+
+/**
+ * 2D grid over the placeable structures of a world (AWorkArea and ABuildingBase), used by building placement,
+ * snapping and overlap checks so a drag only looks at structures near the cursor.
+ *
+ * Structures register in BeginPlay and unregister in EndPlay. Moves are picked up from the root component's
+ * TransformUpdated event and re-filed on the next query.
+ *
+ * Every structure is filed with its reach: a square of the footprint's larger XY half-extent (GetStructureBounds)
+ * around both the footprint center and the actor location. QueryNearby(P, Radius) therefore returns every
+ * structure whose footprint center or actor location is closer to P than Radius plus that half-extent, which
+ * covers the "distance < own extent + other extent + gap" tests of the placement code. Callers still apply
+ * their exact test to the returned candidates.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UPlacementIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterStructure(AActor* Structure);
+	void UnregisterStructure(AActor* Structure);
+
+	// Appends the structures whose reach overlaps the XY square Center +- Radius.
+	void QueryNearby(const FVector& Center, float Radius, TArray<AActor*>& OutStructures, EPlacementIndexFilter Filter = EPlacementIndexFilter::All);
+
+	// Appends every registered work area, e.g. to ignore them in a mouse trace.
+	void GetAllWorkAreas(TArray<AActor*>& OutWorkAreas) const;
+
+	// Snap footprint of a structure: the mesh bounds of a work area, the capsule (plus AdditionalCapsuleRadius)
+	// of a building, otherwise the component bounds.
+	static bool GetStructureBounds(AActor* Actor, FVector& OutCenter, FVector& OutExtent);
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<USceneComponent> Root;
+		FBox2D Reach = FBox2D(ForceInit);
+		FIntRect Cells;
+		uint32 QueryStamp = 0;
+		bool bWorkArea = false;
+		bool bOversized = false;
+		bool bDirty = false;
+		bool bUsed = false;
+	};
+
+	void OnStructureTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	void FileEntry(int32 EntryIndex);
+	void UnfileEntry(int32 EntryIndex);
+	void RefileDirtyEntries();
+
+	static FIntPoint ToCell(const FVector2D& Location);
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TMap<TObjectKey<AActor>, int32> EntryByActor;
+	TMap<TObjectKey<USceneComponent>, int32> EntryByRoot;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	// Structures spanning too many cells to file (huge no-build zones); every query tests them directly.
+	TArray<int32> OversizedEntries;
+	TArray<int32> DirtyEntries;
+	uint32 QueryStamp = 0;
+};
@@ -0,0 +1,53 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ProjectilePoolSubsystem.generated.h"
+
+class AProjectile;
+
+/**
+ * Recycles actor projectiles (bUseMass = false) per projectile class, so sustained ranged combat stops spawning
+ * and destroying an actor per shot.
+ *
+ * AcquireProjectile replaces BeginDeferredActorSpawnFromClass: it hands out a parked projectile reset to its
+ * class defaults (AProjectile::ResetProjectileState) or defers a new spawn. The caller configures it as before
+ * (Init, InitForAbility, InitForLocationPosition, pierce/bounce settings) and then calls FinishProjectile instead
+ * of FinishSpawningActor. AProjectile::DestroyProjectile hands it back through ReleaseProjectile.
+ *
+ * The first acquire of a class parks RTS.ProjectilePool.PrewarmCount extra projectiles of it. Reused actors stay
+ * replicated; clients reset their local flight state from AProjectile::LaunchSerial.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Server only. Parked or newly deferred projectile placed at Transform; nullptr if the class cannot be spawned.
+	AProjectile* AcquireProjectile(TSubclassOf<AProjectile> ProjectileClass, const FTransform& Transform);
+
+	// Finishes the spawn of a new projectile or relaunches a recycled one.
+	void FinishProjectile(AProjectile* Projectile, const FTransform& Transform);
+
+	// Parks the projectile for reuse, or destroys it if pooling is off or the class pool is full.
+	void ReleaseProjectile(AProjectile* Projectile);
+
+	// Parks projectiles of ProjectileClass until Count of them are parked.
+	void PreWarm(TSubclassOf<AProjectile> ProjectileClass, int32 Count);
+
+	int32 GetNumSpawned() const { return NumSpawned; }
+	int32 GetNumReused() const { return NumReused; }
+	int32 GetNumParked(TSubclassOf<AProjectile> ProjectileClass) const;
+
+private:
+	AProjectile* SpawnDeferred(TSubclassOf<AProjectile> ProjectileClass, const FTransform& Transform);
+
+	TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<AProjectile>>> Parked;
+	int32 NumSpawned = 0;
+	int32 NumReused = 0;
+};
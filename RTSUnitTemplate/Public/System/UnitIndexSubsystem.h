@@ -0,0 +1,98 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Core/UnitRoster.h"
+#include "UnitIndexSubsystem.generated.h"
+
+class AUnitBase;
+
+/**
+ * Live AUnitBase actors of a world, filed by team, squad and UnitIndex.
+ * Units register in BeginPlay and unregister in EndPlay, so team and squad lookups only visit their
+ * members instead of iterating every actor of the world.
+ *
+ * TeamId and SquadId are plain replicated fields that are written in many places, so the first query
+ * of each frame re-files every unit whose key changed since the last frame. NotifyUnitChanged re-files
+ * a unit immediately. Dead units stay registered until they are destroyed; callers filter them.
+ *
+ * The ForEach callbacks may destroy or re-file units; units removed during the walk are skipped.
+ */
+UCLASS()
+class RTSUNITTEMPLATE_API UUnitIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void RegisterUnit(AUnitBase* Unit);
+	void UnregisterUnit(AUnitBase* Unit);
+
+	// Re-files Unit after its TeamId, SquadId or UnitIndex changed.
+	void NotifyUnitChanged(AUnitBase* Unit);
+
+	template<typename FuncT>
+	void ForEachUnit(FuncT&& Func)
+	{
+		SyncKeys();
+		for (int32 Handle = 0, NumHandles = Units.Num(); Handle < NumHandles; ++Handle)
+		{
+			if (AUnitBase* Unit = GetUnit(Handle))
+			{
+				Func(Unit);
+			}
+		}
+	}
+
+	template<typename FuncT>
+	void ForEachTeamUnit(int32 TeamId, FuncT&& Func)
+	{
+		SyncKeys();
+		ForEachHandle(Roster.GetTeam(TeamId), Func);
+	}
+
+	// No members for SquadId <= 0.
+	template<typename FuncT>
+	void ForEachSquadMember(int32 TeamId, int32 SquadId, FuncT&& Func)
+	{
+		SyncKeys();
+		ForEachHandle(Roster.GetSquad(TeamId, SquadId), Func);
+	}
+
+	AUnitBase* FindByUnitIndex(int32 UnitIndex);
+
+	// Alive squad member with the smallest UnitIndex (invalid indices last); it shows the squad health bar.
+	AUnitBase* FindSquadHealthbarOwner(int32 TeamId, int32 SquadId);
+
+	int32 Num() const { return Roster.Num(); }
+
+private:
+	FUnitRosterKey MakeKey(const AUnitBase* Unit) const;
+	AUnitBase* GetUnit(int32 Handle) const;
+
+	// Re-files units whose key changed since the last sync. Runs at most once per frame.
+	void SyncKeys();
+
+	template<typename FuncT>
+	void ForEachHandle(TConstArrayView<int32> Handles, FuncT& Func)
+	{
+		// Copy first: the bucket may change while the callback runs.
+		TArray<int32, TInlineAllocator<64>> Snapshot(Handles);
+		for (const int32 Handle : Snapshot)
+		{
+			if (AUnitBase* Unit = GetUnit(Handle))
+			{
+				Func(Unit);
+			}
+		}
+	}
+
+	FUnitRoster Roster;
+	TArray<TWeakObjectPtr<AUnitBase>> Units;
+	TArray<int32> FreeHandles;
+	TMap<TObjectKey<AUnitBase>, int32> HandleByUnit;
+	uint64 LastSyncFrame = MAX_uint64;
+};
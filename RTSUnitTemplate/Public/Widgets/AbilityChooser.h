@@ -19,12 +19,15 @@ protected:
 	AAbilityUnit* OwnerAbilityUnit;
 
 private:
-	
-	const float UpdateInterval = 1.0f;
+	// Redraws on the next tick when the owner's level data changed, once per frame
+	void OnUnitProgressChanged(ALevelUnit* Unit);
 
 	FTimerHandle UpdateTimerHandle;
 
+	FDelegateHandle UnitProgressHandle;
+
 public:
+	// Shows the owner now and redraws whenever its level data changes (UHudEventSubsystem); name kept for Blueprints
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void StartUpdateTimer();
 
@@ -32,6 +35,7 @@ public:
 	void StopTimer();
 	
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	void InitWidget(ACustomControllerBase* InController);
 	//virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
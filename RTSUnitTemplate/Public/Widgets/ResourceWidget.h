@@ -23,6 +23,7 @@ public:
 	UResourceWidget(const FObjectInitializer& ObjectInitializer);
 
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
     
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void SetTeamId(int32 Id);
@@ -30,6 +31,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void UpdateTeamIdText();
 	
+	// Starts listening for resource changes (UHudEventSubsystem); the name is kept for existing Blueprints
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void StartUpdateTimer();
 
@@ -54,9 +56,13 @@ protected:
 	TSubclassOf<UResourceEntryWidget> ResourceEntryWidgetClass;
 
 private:
+	// Several resource changes in one frame cause a single update on the next tick
+	void OnResourcesChanged();
+	void RefreshResources();
+
 	FTimerHandle UpdateTimerHandle;
-	
-	const float UpdateInterval = 1.0f;
+
+	FDelegateHandle ResourcesChangedHandle;
 
 public:
 	// Optional per-resource icon overrides editable in the ResourceWidget
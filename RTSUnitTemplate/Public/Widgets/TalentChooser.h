@@ -14,12 +14,23 @@ class RTSUNITTEMPLATE_API UTalentChooser : public UUserWidget
 	GENERATED_BODY()
 
 private:
-	// Interval in seconds for how often to update the resource display
-	const float UpdateInterval = 0.5f;
+	// Level data and talent attributes replicate separately; both schedule one UpdateWidget on the next tick
+	void OnUnitProgressChanged(ALevelUnit* Unit);
+	void OnTalentAttributeChanged(const FOnAttributeChangeData& Data);
+	void RequestUpdate();
+
+	void WatchTalentAttributes();
+	void UnwatchTalentAttributes();
 
 	FTimerHandle UpdateTimerHandle;
 
+	FDelegateHandle UnitProgressHandle;
+
+	TWeakObjectPtr<UAbilitySystemComponent> WatchedAbilitySystem;
+	TArray<TPair<FGameplayAttribute, FDelegateHandle>> WatchedAttributes;
+
 public:
+	// Shows the owner now and redraws whenever its level data or talents change (UHudEventSubsystem); name kept for Blueprints
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void StartUpdateTimer();
 
@@ -99,10 +110,9 @@ public:
 	
 public:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
-	void SetOwnerActor(ALevelUnit* Unit) {
-		OwnerUnitBase = Unit;
-	}
+	void SetOwnerActor(ALevelUnit* Unit);
 
 	// Additional helper functions as needed
 	// ...
@@ -9,6 +9,7 @@
 #include "Components/Image.h"
 #include "Components/ProgressBar.h"
 #include "Controller/PlayerController/CustomControllerBase.h"
+#include "GameplayTagContainer.h"
 
 #include "UnitWidgetSelector.generated.h"
 
@@ -22,16 +23,38 @@ class RTSUNITTEMPLATE_API UUnitWidgetSelector : public UUserWidget
 
 	
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	//void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 private:
-	// Interval in seconds for how often to update the resource display
+	// Interval in seconds for the cast bar, the ability queue and the local cooldown countdown while units are selected
 	const float UpdateInterval = 0.25f;
 
 	FTimerHandle UpdateTimerHandle;
 
+	FDelegateHandle SelectionChangedHandle;
+	FDelegateHandle AbilityCooldownHandle;
+
+	// World time at which the cooldown of each ability button ends, filled from the server answers
+	TArray<float> CooldownEndTimes;
+	// Last whole second written to each cooldown text, so the countdown only touches texts that change
+	TArray<int32> ShownCooldownSeconds;
+
+	// Cooldown tags of the focused unit's abilities, watched on its ASC to re-request a cooldown when it starts or ends
+	TWeakObjectPtr<UAbilitySystemComponent> WatchedAbilitySystem;
+	TMap<FGameplayTag, FDelegateHandle> WatchedCooldownTags;
+	TMultiMap<FGameplayTag, int32> CooldownTagAbilityIndices;
+
 	void StartUpdateTimer();
+	void StopUpdateTimer();
+	void UpdateCurrentUnit();
+	void UpdateCooldownCountdown();
+	void RequestAbilityCooldown(int32 AbilityIndex);
+	void WatchCooldownTags(AUnitBase* Unit);
+	void UnwatchCooldownTags();
+	void OnHudSelectionChanged(AControllerBase* Controller);
+	void OnCooldownTagChanged(const FGameplayTag CooldownTag, int32 NewCount);
 public:
 
 	void InitWidget(ACustomControllerBase* InController);
@@ -115,6 +115,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (BindWidgetOptional), Category = RTSUnitTemplate)
 	UTextBlock* ResourceAmountLegendary;
 
+	// Listens for win condition changes (UHudEventSubsystem); the name is kept for existing Blueprints
 	UFUNCTION(BlueprintCallable, Category = RTSUnitTemplate)
 	void StartUpdateTimer();
 
@@ -123,9 +124,9 @@ public:
 
 protected:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
-	FTimerHandle UpdateTimerHandle;
-	const float UpdateInterval = 1.0f;
+	FDelegateHandle WinConditionChangedHandle;
 
 	UFUNCTION()
 	void UpdateConditionText();
@@ -133,11 +134,10 @@ protected:
 	UFUNCTION()
 	void OnTeamIdChanged(int32 NewTeamId);
 
-	UFUNCTION()
-	void OnWinConditionChanged(AWinLoseConfigActor* Config, EWinLoseCondition NewCondition);
+	// A config appeared, advanced or updated its tag progress
+	void OnHudWinConditionChanged(AWinLoseConfigActor* Config);
 
-	UFUNCTION()
-	void OnTagProgressUpdated(AWinLoseConfigActor* Config);
+	void BindConfigActor(AWinLoseConfigActor* ConfigActor);
 
 	void UpdateResourceWidgets(const FBuildingCost& Cost, bool bVisible);
 
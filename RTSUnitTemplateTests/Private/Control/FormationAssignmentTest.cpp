@@ -0,0 +1,91 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Core/FormationAssignment.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFormationAssignmentCostTest, "RTSUnitTemplate.Control.FormationAssignmentCost", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Builds seeded random formation problems the way ACustomControllerBase::BuildCostMatrix does (squared distance
+ * from a scattered group to a grid of slots, big units penalized on small slots) and checks that the auction and
+ * greedy solvers return permutations whose total cost stays close to the Hungarian reference.
+ */
+bool FFormationAssignmentCostTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Rng(0xF0A4);
+	FFormationCostMatrix Cost;
+	TArray<int32> Hungarian, Auction, Greedy;
+
+	auto IsPermutation = [](const TArray<int32>& Assignment, int32 N)
+	{
+		if (Assignment.Num() != N)
+		{
+			return false;
+		}
+		TBitArray<> Seen(false, N);
+		for (const int32 Slot : Assignment)
+		{
+			if (Slot < 0 || Slot >= N || Seen[Slot])
+			{
+				return false;
+			}
+			Seen[Slot] = true;
+		}
+		return true;
+	};
+
+	for (int32 Case = 0; Case < 120; ++Case)
+	{
+		const int32 N = Case < 20 ? Case + 1 : Rng.RandRange(2, 160);
+		const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(float(N)));
+		const float Spread = Rng.FRandRange(100.f, 8000.f);
+		const FVector Origin(Rng.FRandRange(-10000.f, 10000.f), Rng.FRandRange(-10000.f, 10000.f), 0.f);
+		const int32 NumLarge = Rng.RandRange(0, FMath::Min(GridSize, N));
+
+		Cost.Reset(N);
+		for (int32 Unit = 0; Unit < N; ++Unit)
+		{
+			const FVector UnitLoc = Origin + FVector(Rng.FRandRange(-Spread, Spread), Rng.FRandRange(-Spread, Spread), 0.f);
+			const bool bLargeUnit = Unit < NumLarge;
+			for (int32 Slot = 0; Slot < N; ++Slot)
+			{
+				const FVector SlotLoc((Slot % GridSize) * 150.f, (Slot / GridSize) * 150.f, 0.f);
+				const bool bLargeSlot = Slot < GridSize;
+				const float DistSq = FVector::DistSquared(UnitLoc, SlotLoc);
+				Cost.At(Unit, Slot) = (bLargeUnit && !bLargeSlot) ? DistSq + 1e10f : DistSq;
+			}
+		}
+
+		FFormationAssignment::SolveHungarian(Cost, Hungarian);
+		FFormationAssignment::SolveAuction(Cost, Auction);
+		FFormationAssignment::SolveGreedySwap(Cost, Greedy);
+
+		if (!IsPermutation(Hungarian, N) || !IsPermutation(Auction, N) || !IsPermutation(Greedy, N))
+		{
+			AddError(FString::Printf(TEXT("Case %d (N=%d): solver returned an invalid assignment"), Case, N));
+			return false;
+		}
+
+		const double HungarianCost = FFormationAssignment::TotalCost(Cost, Hungarian);
+		const double AuctionCost = FFormationAssignment::TotalCost(Cost, Auction);
+		const double GreedyCost = FFormationAssignment::TotalCost(Cost, Greedy);
+
+		// The Hungarian reference works in float, so allow a little slack in both directions for the auction.
+		if (AuctionCost > HungarianCost * 1.001 + 1.0)
+		{
+			AddError(FString::Printf(TEXT("Case %d (N=%d): auction cost %.1f vs Hungarian %.1f"), Case, N, AuctionCost, HungarianCost));
+		}
+		if (GreedyCost > HungarianCost * 1.10 + 1.0)
+		{
+			AddError(FString::Printf(TEXT("Case %d (N=%d): greedy cost %.1f vs Hungarian %.1f"), Case, N, GreedyCost, HungarianCost));
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif
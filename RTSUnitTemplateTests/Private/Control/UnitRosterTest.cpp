@@ -0,0 +1,320 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Core/UnitRoster.h"
+#include "Engine/World.h"
+#include "Characters/Unit/UnitBase.h"
+#include "System/UnitIndexSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitRosterConsistencyTest, "RTSUnitTemplate.Control.UnitRosterConsistency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Files several thousand squad units the way UUnitIndexSubsystem does, moves some of them between teams and
+ * squads, removes whole squads at once (an AoE wiping squads) and compares every team and squad bucket against
+ * a brute-force scan of the reference keys after each step.
+ */
+bool FUnitRosterConsistencyTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumTeams = 4;
+	constexpr int32 SquadsPerTeam = 300;
+	constexpr int32 SquadSize = 6;
+
+	FRandomStream Rng(0x5A0D);
+	FUnitRoster Roster;
+	TArray<TOptional<FUnitRosterKey>> Reference;
+
+	auto AddUnit = [&](const FUnitRosterKey& Key)
+	{
+		const int32 Handle = Reference.Add(Key);
+		Roster.Add(Handle, Key);
+	};
+
+	auto CheckBucket = [&](const TCHAR* What, TConstArrayView<int32> Bucket, TFunctionRef<bool(const FUnitRosterKey&)> Belongs)
+	{
+		int32 Expected = 0;
+		for (const TOptional<FUnitRosterKey>& Key : Reference)
+		{
+			Expected += (Key.IsSet() && Belongs(Key.GetValue())) ? 1 : 0;
+		}
+		if (Bucket.Num() != Expected)
+		{
+			AddError(FString::Printf(TEXT("%s: %d members, expected %d"), What, Bucket.Num(), Expected));
+			return;
+		}
+		TSet<int32> Seen;
+		for (const int32 Handle : Bucket)
+		{
+			const bool bDuplicate = Seen.Contains(Handle);
+			Seen.Add(Handle);
+			if (bDuplicate || !Reference.IsValidIndex(Handle) || !Reference[Handle].IsSet() || !Belongs(Reference[Handle].GetValue()))
+			{
+				AddError(FString::Printf(TEXT("%s: handle %d does not belong here"), What, Handle));
+				return;
+			}
+		}
+	};
+
+	auto Verify = [&](const TCHAR* Step)
+	{
+		int32 Live = 0;
+		for (const TOptional<FUnitRosterKey>& Key : Reference)
+		{
+			Live += Key.IsSet() ? 1 : 0;
+		}
+		TestEqual(FString::Printf(TEXT("%s: unit count"), Step), Roster.Num(), Live);
+
+		for (int32 Team = 0; Team < NumTeams + 1; ++Team)
+		{
+			CheckBucket(*FString::Printf(TEXT("%s: team %d"), Step, Team), Roster.GetTeam(Team),
+				[Team](const FUnitRosterKey& Key) { return Key.TeamId == Team; });
+			for (int32 Squad = 1; Squad <= SquadsPerTeam; Squad += 37)
+			{
+				CheckBucket(*FString::Printf(TEXT("%s: squad %d/%d"), Step, Team, Squad), Roster.GetSquad(Team, Squad),
+					[Team, Squad](const FUnitRosterKey& Key) { return Key.TeamId == Team && Key.SquadId == Squad; });
+			}
+		}
+
+		for (int32 Handle = 0; Handle < Reference.Num(); Handle += 53)
+		{
+			if (Reference[Handle].IsSet())
+			{
+				TestEqual(FString::Printf(TEXT("%s: UnitIndex lookup"), Step), Roster.FindByUnitIndex(Reference[Handle]->UnitIndex), Handle);
+			}
+		}
+	};
+
+	// Spawn: every team gets its squads plus a few loose units (SquadId 0) that must not form a squad bucket.
+	int32 NextUnitIndex = 0;
+	for (int32 Team = 0; Team < NumTeams; ++Team)
+	{
+		for (int32 Squad = 1; Squad <= SquadsPerTeam; ++Squad)
+		{
+			for (int32 Member = 0; Member < SquadSize; ++Member)
+			{
+				AddUnit({ Team, Squad, NextUnitIndex++ });
+			}
+		}
+		for (int32 Loose = 0; Loose < 50; ++Loose)
+		{
+			AddUnit({ Team, 0, NextUnitIndex++ });
+		}
+	}
+	TestEqual(TEXT("Squad buckets after spawn"), Roster.NumSquads(), NumTeams * SquadsPerTeam);
+	TestTrue(TEXT("Loose units are not a squad"), Roster.GetSquad(0, 0).IsEmpty());
+	Verify(TEXT("Spawn"));
+
+	// Team and squad changes (capture, respawn into another squad).
+	for (int32 Change = 0; Change < 2000; ++Change)
+	{
+		const int32 Handle = Rng.RandRange(0, Reference.Num() - 1);
+		FUnitRosterKey Key = Reference[Handle].GetValue();
+		Key.TeamId = Rng.RandRange(0, NumTeams);
+		Key.SquadId = Rng.RandRange(0, SquadsPerTeam);
+		Reference[Handle] = Key;
+		Roster.Update(Handle, Key);
+	}
+	Verify(TEXT("Reassign"));
+
+	// Bulk squad removal: wipe a third of the squads of team 1 in one go.
+	for (int32 Handle = 0; Handle < Reference.Num(); ++Handle)
+	{
+		const TOptional<FUnitRosterKey>& Key = Reference[Handle];
+		if (Key.IsSet() && Key->TeamId == 1 && Key->SquadId > 0 && Key->SquadId % 3 == 0)
+		{
+			Roster.Remove(Handle);
+			Reference[Handle].Reset();
+		}
+	}
+	Verify(TEXT("Bulk removal"));
+	for (int32 Squad = 3; Squad <= SquadsPerTeam; Squad += 3)
+	{
+		if (!Roster.GetSquad(1, Squad).IsEmpty())
+		{
+			AddError(FString::Printf(TEXT("Wiped squad 1/%d still has members"), Squad));
+			break;
+		}
+	}
+
+	// Respawn into freed handles, like the subsystem reusing slots.
+	for (int32 Handle = 0; Handle < Reference.Num(); ++Handle)
+	{
+		if (!Reference[Handle].IsSet())
+		{
+			const FUnitRosterKey Key{ 2, Rng.RandRange(1, SquadsPerTeam), NextUnitIndex++ };
+			Reference[Handle] = Key;
+			Roster.Add(Handle, Key);
+		}
+	}
+	Verify(TEXT("Respawn"));
+
+	// Removing everything leaves no empty buckets behind.
+	for (int32 Handle = 0; Handle < Reference.Num(); ++Handle)
+	{
+		Roster.Remove(Handle);
+	}
+	TestEqual(TEXT("Units after clear"), Roster.Num(), 0);
+	TestEqual(TEXT("Team buckets after clear"), Roster.NumTeams(), 0);
+	TestEqual(TEXT("Squad buckets after clear"), Roster.NumSquads(), 0);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitIndexSquadLifecycleTest, "RTSUnitTemplate.Control.UnitIndexSquadLifecycle", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Spawns two actor squads and a loose unit into a game world, files them with the world's UUnitIndexSubsystem
+ * the way AUnitBase::BeginPlay does, then kills and destroys squad members one by one. After every step the team
+ * and squad buckets, the UnitIndex lookup and the squad health bar owner are compared against the live actors.
+ */
+bool FUnitIndexSquadLifecycleTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 SquadSize = 4;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World) return false;
+
+	UUnitIndexSubsystem* Index = World->GetSubsystem<UUnitIndexSubsystem>();
+	if (!Index)
+	{
+		AddError(TEXT("No UUnitIndexSubsystem in the game world"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	TArray<AUnitBase*> Units;
+	int32 NextUnitIndex = 0;
+	auto SpawnUnit = [&](int32 TeamId, int32 SquadId) -> AUnitBase*
+	{
+		AUnitBase* Unit = World->SpawnActor<AUnitBase>(AUnitBase::StaticClass(), FVector(100.f * Units.Num(), 0.f, 0.f), FRotator::ZeroRotator, Params);
+		if (!Unit)
+		{
+			return nullptr;
+		}
+		Unit->TeamId = TeamId;
+		Unit->SquadId = SquadId;
+		Unit->UnitIndex = NextUnitIndex++;
+		// The test world never begins play, so file the unit like AUnitBase::BeginPlay does.
+		Index->RegisterUnit(Unit);
+		Units.Add(Unit);
+		return Unit;
+	};
+
+	TArray<AUnitBase*> SquadA;
+	TArray<AUnitBase*> SquadB;
+	for (int32 Member = 0; Member < SquadSize; ++Member)
+	{
+		SquadA.Add(SpawnUnit(1, 1));
+		SquadB.Add(SpawnUnit(2, 1));
+	}
+	AUnitBase* Loose = SpawnUnit(1, 0);
+	if (Units.Contains(nullptr))
+	{
+		AddError(TEXT("Spawning the squads failed"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	// DestroyedButRegistered: destroyed units whose EndPlay has not unregistered them yet.
+	auto Verify = [&](const TCHAR* Step, int32 DestroyedButRegistered = 0)
+	{
+		TArray<AUnitBase*> Alive = Units.FilterByPredicate([](AUnitBase* Unit) { return IsValid(Unit); });
+		TestEqual(FString::Printf(TEXT("%s: registered units"), Step), Index->Num(), Alive.Num() + DestroyedButRegistered);
+
+		for (int32 Team = 1; Team <= 2; ++Team)
+		{
+			TSet<AUnitBase*> Expected;
+			TSet<AUnitBase*> ExpectedSquad;
+			for (AUnitBase* Unit : Alive)
+			{
+				if (Unit->TeamId == Team)
+				{
+					Expected.Add(Unit);
+					if (Unit->SquadId == 1)
+					{
+						ExpectedSquad.Add(Unit);
+					}
+				}
+			}
+
+			TSet<AUnitBase*> TeamUnits;
+			TSet<AUnitBase*> SquadUnits;
+			Index->ForEachTeamUnit(Team, [&TeamUnits](AUnitBase* Unit) { TeamUnits.Add(Unit); });
+			Index->ForEachSquadMember(Team, 1, [&SquadUnits](AUnitBase* Unit) { SquadUnits.Add(Unit); });
+			TestTrue(FString::Printf(TEXT("%s: team %d bucket"), Step, Team), TeamUnits.Num() == Expected.Num() && TeamUnits.Includes(Expected));
+			TestTrue(FString::Printf(TEXT("%s: squad %d/1 bucket"), Step, Team), SquadUnits.Num() == ExpectedSquad.Num() && SquadUnits.Includes(ExpectedSquad));
+		}
+
+		int32 LooseSquadMembers = 0;
+		Index->ForEachSquadMember(1, 0, [&LooseSquadMembers](AUnitBase*) { ++LooseSquadMembers; });
+		TestEqual(FString::Printf(TEXT("%s: loose units are not a squad"), Step), LooseSquadMembers, 0);
+
+		for (int32 UnitIndex = 0; UnitIndex < NextUnitIndex; ++UnitIndex)
+		{
+			AUnitBase* const* Expected = Alive.FindByPredicate([UnitIndex](AUnitBase* Unit) { return Unit->UnitIndex == UnitIndex; });
+			TestTrue(FString::Printf(TEXT("%s: UnitIndex %d lookup"), Step, UnitIndex), Index->FindByUnitIndex(UnitIndex) == (Expected ? *Expected : nullptr));
+		}
+	};
+
+	Verify(TEXT("Spawn"));
+	TestTrue(TEXT("Spawn: squad A health bar owner"), Index->FindSquadHealthbarOwner(1, 1) == SquadA[0]);
+
+	// Kill the health bar owner: it stays filed until destroyed, but hands the squad health bar on.
+	SquadA[0]->SetUnitState(UnitData::Dead);
+	Verify(TEXT("Kill"));
+	TestTrue(TEXT("Kill: squad A health bar owner"), Index->FindSquadHealthbarOwner(1, 1) == SquadA[1]);
+
+	// Destroy the dead member. Lookups must skip it even before EndPlay unregisters it.
+	// The test world never begins play, so Destroy() does not route EndPlay and the unit stays filed.
+	SquadA[0]->Destroy();
+	Verify(TEXT("Destroy"), 1);
+	Index->UnregisterUnit(SquadA[0]);
+	Verify(TEXT("Unregister"));
+
+	// Wipe squad B: kill and destroy every member, the squad and its team bucket must empty out.
+	for (AUnitBase* Unit : SquadB)
+	{
+		Unit->SetUnitState(UnitData::Dead);
+	}
+	TestNull(TEXT("Wipe: dead squad has no health bar owner"), Index->FindSquadHealthbarOwner(2, 1));
+	for (AUnitBase* Unit : SquadB)
+	{
+		Unit->Destroy();
+		Index->UnregisterUnit(Unit);
+	}
+	Verify(TEXT("Wipe"));
+
+	// A respawned unit reuses a freed handle and joins squad A.
+	const AUnitBase* Respawned = SpawnUnit(1, 1);
+	const int32 RespawnedUnitIndex = Respawned ? Respawned->UnitIndex : INDEX_NONE;
+	TestNotNull(TEXT("Respawn: unit spawned"), Respawned);
+	Verify(TEXT("Respawn"));
+	TestTrue(TEXT("Respawn: squad A health bar owner"), Index->FindSquadHealthbarOwner(1, 1) == SquadA[1]);
+
+	// Moving the loose unit into squad A is picked up after NotifyUnitChanged.
+	Loose->SquadId = 1;
+	Index->NotifyUnitChanged(Loose);
+	Verify(TEXT("Join squad"));
+
+	for (AUnitBase* Unit : Units)
+	{
+		if (IsValid(Unit))
+		{
+			Unit->Destroy();
+			Index->UnregisterUnit(Unit);
+		}
+	}
+	TestEqual(TEXT("Units after clear"), Index->Num(), 0);
+	TestNull(TEXT("Respawned unit is gone after clear"), Index->FindByUnitIndex(RespawnedUnitIndex));
+
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+#endif
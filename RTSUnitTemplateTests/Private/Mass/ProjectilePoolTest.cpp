@@ -0,0 +1,199 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Actors/Projectile.h"
+#include "NiagaraComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/IConsoleManager.h"
+#include "System/ProjectilePoolSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolSteadyStateTest, "RTSUnitTemplate.Mass.ProjectilePoolSteadyState", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Feuert ueber einen langen Zeitraum Projektile mit einer festen Anzahl gleichzeitig im Flug. Nach dem Vorwaermen
+ * darf der Pool keine neuen Actors mehr spawnen, und jedes wiederverwendete Projektil muss ohne Pierce-, Impact-
+ * und Ziel-Zustand des vorherigen Schusses ausgegeben werden. Die beim Einschlag versteckten und beim Parken
+ * deaktivierten Niagara-Komponenten muessen nach dem Relaunch wieder laufen und sichtbar sein.
+ */
+bool FProjectilePoolSteadyStateTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 PrewarmCount = 8;
+	constexpr int32 InFlight = 6;
+	constexpr int32 Shots = 2000;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World) return false;
+
+	UProjectilePoolSubsystem* Pool = World->GetSubsystem<UProjectilePoolSubsystem>();
+	if (!Pool)
+	{
+		AddError(TEXT("UProjectilePoolSubsystem fehlt"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	Pool->PreWarm(AProjectile::StaticClass(), PrewarmCount);
+	TestEqual(TEXT("Vorgewaermte Projektile"), Pool->GetNumParked(AProjectile::StaticClass()), PrewarmCount);
+	const int32 SpawnedAfterWarmup = Pool->GetNumSpawned();
+
+	const AProjectile* Defaults = GetDefault<AProjectile>();
+	AActor* DummyTarget = World->SpawnActor<AActor>();
+
+	TArray<AProjectile*> Flying;
+	for (int32 Shot = 0; Shot < Shots && !HasAnyErrors(); ++Shot)
+	{
+		const FTransform Transform(FVector(Shot * 10.f, 0.f, 100.f));
+		AProjectile* Projectile = Pool->AcquireProjectile(AProjectile::StaticClass(), Transform);
+		if (!Projectile)
+		{
+			AddError(FString::Printf(TEXT("Schuss %d: kein Projektil"), Shot));
+			break;
+		}
+
+		// Nichts vom vorherigen Flug darf uebrig sein.
+		if (Projectile->PiercedTargets != Defaults->PiercedTargets || Projectile->bImpacted
+			|| Projectile->Target != nullptr || Projectile->PiercedActors.Num() != 0 || Projectile->IsInPool())
+		{
+			AddError(FString::Printf(TEXT("Schuss %d: Projektil nicht zurueckgesetzt"), Shot));
+		}
+		TestTrue(TEXT("Projektil steht am Abschussort"), Projectile->GetActorLocation().Equals(Transform.GetLocation()));
+
+		// Zustand eines Fluges, der Ziele durchschlagen hat und eingeschlagen ist.
+		Projectile->Target = DummyTarget;
+		Projectile->PiercedTargets = 3;
+		Projectile->PiercedActors.Add(DummyTarget);
+		Projectile->bImpacted = true;
+		Pool->FinishProjectile(Projectile, Transform);
+		TestFalse(TEXT("Projektil im Flug ist sichtbar"), Projectile->IsHidden());
+		for (const UNiagaraComponent* Niagara : { Projectile->Niagara_A, Projectile->Niagara_B })
+		{
+			if (!Niagara)
+			{
+				continue;
+			}
+			if (!Niagara->IsVisible())
+			{
+				AddError(FString::Printf(TEXT("Schuss %d: %s nach dem Relaunch unsichtbar"), Shot, *Niagara->GetName()));
+			}
+			// Ohne Asset bricht Niagara die Aktivierung ab; das Test-Projektil hat keins zugewiesen.
+			if (Niagara->GetAsset() && !Niagara->IsActive())
+			{
+				AddError(FString::Printf(TEXT("Schuss %d: %s nach dem Relaunch nicht aktiv"), Shot, *Niagara->GetName()));
+			}
+		}
+
+		Flying.Add(Projectile);
+		if (Flying.Num() > InFlight)
+		{
+			AProjectile* Oldest = Flying[0];
+			Flying.RemoveAt(0);
+			// Einschlag wie in OnRep_bImpacted: Instanz und Niagara-Komponenten werden versteckt.
+			Oldest->SetVisibility(false);
+			Oldest->DestroyProjectile();
+			TestTrue(TEXT("Abgegebenes Projektil ist geparkt"), Oldest->IsInPool() && Oldest->IsHidden());
+		}
+	}
+
+	TestEqual(TEXT("Keine Spawns nach dem Vorwaermen"), Pool->GetNumSpawned(), SpawnedAfterWarmup);
+	TestEqual(TEXT("Jeder Schuss kam aus dem Pool"), Pool->GetNumReused(), Shots);
+
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FProjectilePoolRelaunchFlightTest, "RTSUnitTemplate.Mass.ProjectilePoolRelaunchFlight", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Ein wiederverwendetes Projektil muss nach dem Relaunch eine Flug-Instanz mit der Skalierung des
+ * Abschuss-Transforms haben und beim Ticken tatsaechlich fliegen, mit und ohne Client-Simulation
+ * (RTS.Projectile.ClientSimulation). EnterPool entfernt die Instanz, OnConstruction laeuft nicht erneut.
+ */
+bool FProjectilePoolRelaunchFlightTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 ShotsPerMode = 20;
+	constexpr float DeltaTime = 0.1f;
+	const FVector LaunchScale(2.f, 2.f, 2.f);
+
+	IConsoleVariable* ClientSimulation = IConsoleManager::Get().FindConsoleVariable(TEXT("RTS.Projectile.ClientSimulation"));
+	UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!ClientSimulation || !Mesh)
+	{
+		AddError(TEXT("RTS.Projectile.ClientSimulation oder das Test-Mesh fehlt"));
+		return false;
+	}
+	const int32 PreviousClientSimulation = ClientSimulation->GetInt();
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World) return false;
+
+	UProjectilePoolSubsystem* Pool = World->GetSubsystem<UProjectilePoolSubsystem>();
+	if (!Pool)
+	{
+		AddError(TEXT("UProjectilePoolSubsystem fehlt"));
+		World->DestroyWorld(false);
+		return false;
+	}
+	Pool->PreWarm(AProjectile::StaticClass(), 2);
+
+	for (const int32 Mode : { 0, 1 })
+	{
+		ClientSimulation->Set(Mode, ECVF_SetByCode);
+
+		for (int32 Shot = 0; Shot < ShotsPerMode && !HasAnyErrors(); ++Shot)
+		{
+			const FTransform Transform(FQuat::Identity, FVector(Shot * 10.f, 0.f, 100.f), LaunchScale);
+			AProjectile* Projectile = Pool->AcquireProjectile(AProjectile::StaticClass(), Transform);
+			if (!Projectile)
+			{
+				AddError(FString::Printf(TEXT("Modus %d, Schuss %d: kein Projektil"), Mode, Shot));
+				break;
+			}
+
+			// Minimaler Init-Zustand eines Bodenschusses ohne Ziel-Actor.
+			Projectile->ISMComponent->SetStaticMesh(Mesh);
+			Projectile->TargetLocation = Transform.GetLocation() + FVector(100000.f, 0.f, 0.f);
+			Projectile->bIsInitialized = true;
+			Pool->FinishProjectile(Projectile, Transform);
+
+			if (!Projectile->ISMComponent->IsValidInstance(Projectile->InstanceIndex))
+			{
+				AddError(FString::Printf(TEXT("Modus %d, Schuss %d: keine Flug-Instanz nach dem Relaunch"), Mode, Shot));
+				break;
+			}
+
+			FTransform Start;
+			Projectile->ISMComponent->GetInstanceTransform(Projectile->InstanceIndex, Start, true);
+			if (!Start.GetScale3D().Equals(LaunchScale))
+			{
+				AddError(FString::Printf(TEXT("Modus %d, Schuss %d: Instanz-Skalierung %s statt %s"), Mode, Shot, *Start.GetScale3D().ToString(), *LaunchScale.ToString()));
+			}
+
+			Projectile->Tick(DeltaTime);
+
+			FTransform After;
+			Projectile->ISMComponent->GetInstanceTransform(Projectile->InstanceIndex, After, true);
+			if (After.GetLocation().X <= Start.GetLocation().X + 1.f)
+			{
+				AddError(FString::Printf(TEXT("Modus %d, Schuss %d: Projektil fliegt nicht"), Mode, Shot));
+			}
+
+			// Einschlag wie in DestroyProjectileWithDelay, dann parken.
+			Projectile->SetVisibility(false);
+			Projectile->DestroyProjectile();
+			TestTrue(TEXT("Projektil ist wieder geparkt"), Projectile->IsInPool());
+		}
+	}
+
+	TestTrue(TEXT("Alle Schuesse aus dem Pool"), Pool->GetNumReused() >= 2 * ShotsPerMode);
+
+	ClientSimulation->Set(PreviousClientSimulation, ECVF_SetByCode);
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,224 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+#include "Mass/UnitPickingSubsystem.h"
+#include "Mass/UnitPickingProcessor.h"
+#include "Mass/UnitMassTag.h"
+#include "Mass/MassUnitVisualFragments.h"
+#include "MassCommonFragments.h"
+#include "MassEntityManager.h"
+#include "MassExecutor.h"
+#include "MassProcessingTypes.h"
+#include "Camera/CameraTypes.h"
+#include "Kismet/GameplayStatics.h"
+#include "SceneView.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitPickingBroadPhaseTest, "RTSUnitTemplate.Mass.UnitPickingBroadPhase", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Verteilt viele Pick-Zylinder auf einer grossen Karte und vergleicht Ray- und Radius-Abfragen mit einem
+ * Brute-Force-Test: jeder Zylinder, den der exakte Test trifft, muss unter den Kandidaten sein, und die
+ * Kandidatenliste muss deutlich kleiner als die Armee bleiben.
+ */
+bool FUnitPickingBroadPhaseTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumEntries = 5000;
+	constexpr float MapSize = 50000.f;
+	constexpr int32 NumQueries = 200;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World) return false;
+
+	UUnitPickingSubsystem* Picking = World->GetSubsystem<UUnitPickingSubsystem>();
+	if (!Picking)
+	{
+		AddError(TEXT("UUnitPickingSubsystem fehlt"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	FRandomStream Rng(1234);
+	Picking->BeginRebuild(500.f, NumEntries);
+	for (int32 i = 0; i < NumEntries; ++i)
+	{
+		FUnitPickEntry Entry;
+		Entry.Entity = FMassEntityHandle(i + 1, 1);
+		Entry.Base = FVector(Rng.FRandRange(0.f, MapSize), Rng.FRandRange(0.f, MapSize), Rng.FRandRange(-200.f, 200.f));
+		Entry.Height = Rng.FRandRange(100.f, 400.f);
+		Entry.Radius = Rng.FRandRange(30.f, 600.f);
+		Picking->AddEntry(Entry);
+	}
+	Picking->FinishRebuild();
+	TestTrue(TEXT("Snapshot vorhanden"), Picking->HasSnapshot());
+
+	const TArray<FUnitPickEntry>& Entries = Picking->GetEntries();
+	TArray<int32> Candidates;
+	int32 MaxCandidates = 0;
+
+	for (int32 Query = 0; Query < NumQueries && !HasAnyErrors(); ++Query)
+	{
+		// Schraeger RTS-Kamerastrahl von oben.
+		const FVector Target(Rng.FRandRange(0.f, MapSize), Rng.FRandRange(0.f, MapSize), 0.f);
+		const FVector Origin = Target + FVector(Rng.FRandRange(-3000.f, 3000.f), Rng.FRandRange(-3000.f, 3000.f), 4000.f);
+		const FVector Direction = (Target - Origin).GetSafeNormal();
+		const FVector End = Origin + Direction * 100000.f;
+
+		Picking->QueryRay(Origin, Direction, 100000.f, Candidates);
+		MaxCandidates = FMath::Max(MaxCandidates, Candidates.Num());
+		const TSet<int32> CandidateSet(Candidates);
+
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			const FUnitPickEntry& Entry = Entries[i];
+			FVector P1, P2;
+			FMath::SegmentDistToSegmentSafe(Origin, End, Entry.Base, Entry.Base + FVector(0.f, 0.f, Entry.Height), P1, P2);
+			if (FVector::DistSquared(P1, P2) <= FMath::Square(Entry.Radius) && !CandidateSet.Contains(i))
+			{
+				AddError(FString::Printf(TEXT("Ray %d: getroffener Eintrag %d fehlt in den Kandidaten"), Query, i));
+				break;
+			}
+		}
+
+		const FVector Center(Rng.FRandRange(0.f, MapSize), Rng.FRandRange(0.f, MapSize), 0.f);
+		const float Radius = Rng.FRandRange(50.f, 2000.f);
+		Picking->QueryRadius2D(Center, Radius, Candidates);
+		const TSet<int32> RadiusSet(Candidates);
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			if (FVector::DistSquared2D(Entries[i].Base, Center) <= FMath::Square(Radius + Entries[i].Radius) && !RadiusSet.Contains(i))
+			{
+				AddError(FString::Printf(TEXT("Radius %d: ueberlappender Eintrag %d fehlt in den Kandidaten"), Query, i));
+				break;
+			}
+		}
+	}
+
+	// Der Strahl darf nur einen schmalen Streifen der Karte besuchen.
+	TestTrue(FString::Printf(TEXT("Ray-Kandidaten (%d) bleiben weit unter der Armeegroesse"), MaxCandidates), MaxCandidates < NumEntries / 10);
+
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitPickingVisualOffsetTest, "RTSUnitTemplate.Mass.UnitPickingVisualOffset", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Die Marquee-Auswahl prueft die gerenderten ISM-Instanzen, nicht den Pick-Zylinder. Eine Einheit, deren
+ * Instanz per BaseOffset weit neben und ueber dem Zylinder sitzt, muss Kandidat sein, wenn das Rechteck nur
+ * die Instanz einschliesst. Die Eintraege baut der echte UUnitPickingProcessor.
+ */
+bool FUnitPickingVisualOffsetTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World) return false;
+
+	UUnitPickingSubsystem* Picking = World->GetSubsystem<UUnitPickingSubsystem>();
+	if (!Picking)
+	{
+		AddError(TEXT("UUnitPickingSubsystem fehlt"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	TSharedRef<FMassEntityManager> EntityManager = MakeShareable(new FMassEntityManager(World));
+	EntityManager->Initialize();
+
+	const FMassArchetypeHandle Archetype = EntityManager->CreateArchetype({
+		FTransformFragment::StaticStruct(),
+		FMassAgentCharacteristicsFragment::StaticStruct(),
+		FMassHoverFragment::StaticStruct(),
+		FMassUnitVisualFragment::StaticStruct(),
+		FUnitMassTag::StaticStruct() });
+
+	auto SpawnUnit = [&EntityManager, &Archetype](const FVector& Location, const FVector& VisualOffset)
+	{
+		const FMassEntityHandle Entity = EntityManager->CreateEntity(Archetype);
+		EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).GetMutableTransform().SetLocation(Location);
+		FMassAgentCharacteristicsFragment& Char = EntityManager->GetFragmentDataChecked<FMassAgentCharacteristicsFragment>(Entity);
+		Char.LastGroundLocation = Location.Z;
+		Char.CapsuleRadius = 50.f;
+		Char.CapsuleHeight = 90.f;
+		Char.PositionedTransform = FTransform(FRotator(0.f, 30.f, 0.f), Location + FVector(0.f, 0.f, Char.CapsuleHeight));
+		FMassUnitVisualInstance& Instance = EntityManager->GetFragmentDataChecked<FMassUnitVisualFragment>(Entity).VisualInstances.AddDefaulted_GetRef();
+		Instance.BaseOffset = FTransform(VisualOffset);
+		Instance.CurrentRelativeTransform = Instance.BaseOffset;
+		return Entity;
+	};
+
+	const FMassEntityHandle OffsetUnit = SpawnUnit(FVector::ZeroVector, FVector(1200.f, 800.f, 300.f));
+	const FMassEntityHandle FarUnit = SpawnUnit(FVector(30000.f, 30000.f, 0.f), FVector::ZeroVector);
+
+	UUnitPickingProcessor* Processor = NewObject<UUnitPickingProcessor>();
+	Processor->CallInitialize(World, EntityManager);
+	FMassProcessingContext ProcessingContext(EntityManager, 0.f);
+	UE::Mass::Executor::Run(*Processor, ProcessingContext);
+
+	int32 OffsetEntry = INDEX_NONE;
+	int32 FarEntry = INDEX_NONE;
+	const TArray<FUnitPickEntry>& Entries = Picking->GetEntries();
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		OffsetEntry = Entries[i].Entity == OffsetUnit ? i : OffsetEntry;
+		FarEntry = Entries[i].Entity == FarUnit ? i : FarEntry;
+	}
+	if (OffsetEntry == INDEX_NONE || FarEntry == INDEX_NONE)
+	{
+		AddError(TEXT("Der Prozessor hat nicht beide Einheiten eingetragen"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	// Schraege RTS-Kamera; die Instanz liegt innerhalb des Bildes.
+	FMinimalViewInfo View;
+	View.Location = FVector(-2500.f, 0.f, 3500.f);
+	View.Rotation = FRotator(-50.f, 10.f, 0.f);
+	View.FOV = 90.f;
+	View.AspectRatio = 16.f / 9.f;
+	const FIntRect ViewRect(0, 0, 1920, 1080);
+	FMatrix ViewMatrix, ProjectionMatrix, ViewProjection;
+	UGameplayStatics::GetViewProjectionMatrix(View, ViewMatrix, ProjectionMatrix, ViewProjection);
+
+	// Gerenderte Instanz wie in UMassUnitPlacementProcessor: CurrentRelativeTransform * PositionedTransform.
+	const FMassAgentCharacteristicsFragment& Char = EntityManager->GetFragmentDataChecked<FMassAgentCharacteristicsFragment>(OffsetUnit);
+	const FMassUnitVisualInstance& Instance = EntityManager->GetFragmentDataChecked<FMassUnitVisualFragment>(OffsetUnit).VisualInstances[0];
+	const FVector InstanceLocation = (Instance.CurrentRelativeTransform * Char.PositionedTransform).GetLocation();
+
+	FVector2D InstanceScreen;
+	if (!FSceneView::ProjectWorldToScreen(InstanceLocation, ViewRect, ViewProjection, InstanceScreen))
+	{
+		AddError(TEXT("Instanz liegt nicht vor der Kamera"));
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	// Kleines Rechteck nur um die Instanz; die Zylinderachse der Einheit projiziert weit daneben.
+	const FVector2D RectA = InstanceScreen - FVector2D(8.f);
+	const FVector2D RectB = InstanceScreen + FVector2D(8.f);
+	const FVector2D Corners[4] = { RectA, FVector2D(RectB.X, RectA.Y), RectB, FVector2D(RectA.X, RectB.Y) };
+	const FMatrix InvViewProjection = ViewProjection.Inverse();
+	FVector Origins[4];
+	FVector Directions[4];
+	for (int32 c = 0; c < 4; ++c)
+	{
+		FSceneView::DeprojectScreenToWorld(Corners[c], ViewRect, InvViewProjection, Origins[c], Directions[c]);
+	}
+
+	FVector2D BaseScreen;
+	FSceneView::ProjectWorldToScreen(Entries[OffsetEntry].Base, ViewRect, ViewProjection, BaseScreen);
+	TestTrue(TEXT("Zylinderfuss liegt ausserhalb des Rechtecks"), FVector2D::Distance(BaseScreen, InstanceScreen) > 50.f);
+
+	TArray<int32> Candidates;
+	Picking->QueryCornerRays(Origins, Directions, Candidates);
+	TestTrue(TEXT("Einheit mit versetzter Instanz ist Kandidat"), Candidates.Contains(OffsetEntry));
+	TestFalse(TEXT("Weit entfernte Einheit ist kein Kandidat"), Candidates.Contains(FarEntry));
+
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
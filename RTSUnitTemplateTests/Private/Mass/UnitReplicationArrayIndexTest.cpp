@@ -0,0 +1,129 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Mass/Replication/UnitReplicationPayload.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitReplicationArrayIndexTest, "RTSUnitTemplate.Mass.ReplicationArrayNetIDIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Drives FUnitReplicationArray through random adds, swap-removes and simulated client receives and checks
+ * after every step that the NetID -> index side map agrees with a plain reference set.
+ */
+bool FUnitReplicationArrayIndexTest::RunTest(const FString& Parameters)
+{
+	FUnitReplicationArray Array;
+	TSet<uint32> Reference;
+	FRandomStream Rng(0x5EED);
+	uint32 NextNetID = 1;
+
+	auto MakeItem = [](uint32 Id)
+	{
+		FUnitReplicationItem Item;
+		Item.NetID = FMassNetworkID(Id);
+		Item.Location = FVector(Id, 0.f, 0.f);
+		return Item;
+	};
+
+	auto Verify = [&](int32 Step) -> bool
+	{
+		if (Array.Items.Num() != Reference.Num())
+		{
+			AddError(FString::Printf(TEXT("Step %d: Items=%d Reference=%d"), Step, Array.Items.Num(), Reference.Num()));
+			return false;
+		}
+
+		for (const uint32 Id : Reference)
+		{
+			const FUnitReplicationItem* Item = Array.FindItemByNetID(FMassNetworkID(Id));
+			if (!Item || Item->NetID.GetValue() != Id || Item->Location.X != float(Id))
+			{
+				AddError(FString::Printf(TEXT("Step %d: NetID %u not found or wrong item"), Step, Id));
+				return false;
+			}
+		}
+
+		// A few IDs that were removed or never added must miss.
+		for (int32 k = 0; k < 4; ++k)
+		{
+			const uint32 Id = uint32(Rng.RandRange(1, int32(NextNetID) + 8));
+			if (!Reference.Contains(Id) && Array.FindItemByNetID(FMassNetworkID(Id)))
+			{
+				AddError(FString::Printf(TEXT("Step %d: stale NetID %u still found"), Step, Id));
+				return false;
+			}
+		}
+
+		if (!Array.bNetIDIndexDirty && Array.IndexByNetID.Num() != Array.Items.Num())
+		{
+			AddError(FString::Printf(TEXT("Step %d: index has %d entries for %d items"), Step, Array.IndexByNetID.Num(), Array.Items.Num()));
+			return false;
+		}
+		return true;
+	};
+
+	for (int32 Step = 0; Step < 5000; ++Step)
+	{
+		const int32 Op = Rng.RandRange(0, 9);
+		if (Op < 5 || Reference.Num() == 0)
+		{
+			// Server add
+			const uint32 Id = NextNetID++;
+			Array.AddItem(MakeItem(Id));
+			Reference.Add(Id);
+		}
+		else if (Op < 8)
+		{
+			// Server remove of a live item (swap-remove moves the last item into the hole)
+			const TArray<uint32> Live = Reference.Array();
+			const uint32 Id = Live[Rng.RandRange(0, Live.Num() - 1)];
+			TestTrue(TEXT("RemoveItemByNetID removes a live item"), Array.RemoveItemByNetID(FMassNetworkID(Id)));
+			Reference.Remove(Id);
+		}
+		else if (Op == 8)
+		{
+			// Remove of an unknown id must be a no-op
+			TestFalse(TEXT("RemoveItemByNetID ignores unknown ids"), Array.RemoveItemByNetID(FMassNetworkID(NextNetID + 100)));
+		}
+		else
+		{
+			// Client receive: the serializer edits Items directly (adds + swap-removes), the item callbacks
+			// mark the index dirty, lookups in between must still be correct, then the receive rebuilds it.
+			const int32 NumAdds = Rng.RandRange(0, 3);
+			for (int32 a = 0; a < NumAdds; ++a)
+			{
+				const uint32 Id = NextNetID++;
+				Array.Items.Add(MakeItem(Id));
+				Array.Items.Last().PostReplicatedAdd(Array);
+				Reference.Add(Id);
+			}
+
+			const int32 NumRemoves = FMath::Min(Rng.RandRange(0, 3), Array.Items.Num());
+			for (int32 r = 0; r < NumRemoves; ++r)
+			{
+				const int32 Index = Rng.RandRange(0, Array.Items.Num() - 1);
+				Array.Items[Index].PreReplicatedRemove(Array);
+				Reference.Remove(Array.Items[Index].NetID.GetValue());
+				Array.Items.RemoveAtSwap(Index);
+			}
+
+			if (!Verify(Step))
+			{
+				return false;
+			}
+			Array.RebuildNetIDIndex();
+		}
+
+		if (!Verify(Step))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+#endif
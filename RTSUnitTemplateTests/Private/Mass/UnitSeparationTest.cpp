@@ -0,0 +1,97 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "MassEntityManager.h"
+#include "MassExecutor.h"
+#include "MassProcessingTypes.h"
+#include "MassCommonFragments.h"
+#include "MassMovementFragments.h"
+#include "MassNavigationFragments.h"
+#include "Mass/UnitMassTag.h"
+#include "Mass/Avoidance/UnitSeparationProcessor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUnitSeparationHeadOnTest, "RTSUnitTemplate.Mass.UnitSeparationHeadOn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Zwei Einheiten laufen frontal aufeinander zu (Querkomponente exakt 0). Der Tie-Break muss beide entlang
+ * ihres eigenen Rechts-Vektors in entgegengesetzte Richtungen schieben, sodass sie seitlich aneinander
+ * vorbeikommen, statt gemeinsam auf dieselbe Seite zu driften.
+ */
+bool FUnitSeparationHeadOnTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaTime = 0.1f; // = ExecutionInterval, der Prozessor laeuft jeden Tick
+	constexpr int32 Ticks = 10;
+	constexpr float ForceToOffset = 0.001f;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World) return false;
+
+	TSharedRef<FMassEntityManager> EntityManager = MakeShareable(new FMassEntityManager(World));
+	EntityManager->Initialize();
+
+	const FMassArchetypeHandle Archetype = EntityManager->CreateArchetype({
+		FTransformFragment::StaticStruct(),
+		FMassForceFragment::StaticStruct(),
+		FMassAITargetFragment::StaticStruct(),
+		FMassCombatStatsFragment::StaticStruct(),
+		FMassAgentCharacteristicsFragment::StaticStruct(),
+		FMassMoveTargetFragment::StaticStruct(),
+		FUnitMassTag::StaticStruct() });
+
+	// Fliegende Einheiten ueberspringen die Navmesh-Projektion; die Testwelt hat kein Navmesh.
+	auto SpawnUnit = [&EntityManager, &Archetype](const FVector& Location, const FVector& MoveGoal)
+	{
+		const FMassEntityHandle Entity = EntityManager->CreateEntity(Archetype);
+		EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).GetMutableTransform().SetLocation(Location);
+		EntityManager->GetFragmentDataChecked<FMassMoveTargetFragment>(Entity).Center = MoveGoal;
+		EntityManager->GetFragmentDataChecked<FMassAgentCharacteristicsFragment>(Entity).bIsFlying = true;
+		EntityManager->GetFragmentDataChecked<FMassCombatStatsFragment>(Entity).TeamId = 1;
+		return Entity;
+	};
+
+	const FMassEntityHandle UnitA = SpawnUnit(FVector(0.f, 0.f, 0.f), FVector(5000.f, 0.f, 0.f));
+	const FMassEntityHandle UnitB = SpawnUnit(FVector(50.f, 0.f, 0.f), FVector(-5000.f, 0.f, 0.f));
+
+	UUnitSeparationProcessor* Processor = NewObject<UUnitSeparationProcessor>();
+	Processor->CallInitialize(World, EntityManager);
+
+	for (int32 Tick = 0; Tick < Ticks && !HasAnyErrors(); ++Tick)
+	{
+		EntityManager->GetFragmentDataChecked<FMassForceFragment>(UnitA).Value = FVector::ZeroVector;
+		EntityManager->GetFragmentDataChecked<FMassForceFragment>(UnitB).Value = FVector::ZeroVector;
+
+		FMassProcessingContext ProcessingContext(EntityManager, DeltaTime);
+		UE::Mass::Executor::Run(*Processor, ProcessingContext);
+
+		const FVector ForceA = EntityManager->GetFragmentDataChecked<FMassForceFragment>(UnitA).Value;
+		const FVector ForceB = EntityManager->GetFragmentDataChecked<FMassForceFragment>(UnitB).Value;
+
+		if (Tick == 0)
+		{
+			TestTrue(TEXT("Frontal: beide Einheiten werden seitlich geschoben"), FMath::Abs(ForceA.Y) > 1.f && FMath::Abs(ForceB.Y) > 1.f);
+			TestTrue(TEXT("Frontal: entgegengesetzte Seiten"), ForceA.Y * ForceB.Y < 0.f);
+			TestTrue(TEXT("Frontal: gleich grosse Gegenkraefte"), FMath::IsNearlyEqual(ForceA.Y, -ForceB.Y, 0.01f));
+		}
+
+		FTransform& TransformA = EntityManager->GetFragmentDataChecked<FTransformFragment>(UnitA).GetMutableTransform();
+		FTransform& TransformB = EntityManager->GetFragmentDataChecked<FTransformFragment>(UnitB).GetMutableTransform();
+		const float GapBefore = FMath::Abs(TransformB.GetLocation().Y - TransformA.GetLocation().Y);
+		TransformA.AddToTranslation(ForceA * ForceToOffset);
+		TransformB.AddToTranslation(ForceB * ForceToOffset);
+		const float GapAfter = FMath::Abs(TransformB.GetLocation().Y - TransformA.GetLocation().Y);
+
+		if (GapAfter <= GapBefore)
+		{
+			AddError(FString::Printf(TEXT("Tick %d: seitlicher Abstand waechst nicht (%.2f -> %.2f)"), Tick, GapBefore, GapAfter));
+		}
+	}
+
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
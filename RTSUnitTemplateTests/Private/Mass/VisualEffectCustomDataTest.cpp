@@ -0,0 +1,202 @@
+// Copyright 2026 Silvan Teufel / Teufel-Engineering.com All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "MassCommonFragments.h"
+#include "MassActorSubsystem.h"
+#include "MassEntityManager.h"
+#include "MassExecutor.h"
+#include "MassProcessingTypes.h"
+#include "Mass/UnitMassTag.h"
+#include "Mass/MassUnitVisualFragments.h"
+#include "Mass/MassUnitVisualTweenProcessor.h"
+#include "Mass/MassVisualEffectCustomData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVisualEffectCustomDataTest, "RTSUnitTemplate.Mass.VisualEffectGpuCustomData", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Laesst Pulsieren und Dauerrotation ueber viele Frames durch den UMassUnitVisualTweenProcessor laufen, mit
+ * RTS.VisualEffects.GpuPeriodic=1. Die Custom Data der Instanz darf nur beim Start und beim Stoppen der Rotation
+ * geschrieben werden, und nur in diesen Frames darf der Prozessor bTransformDirty setzen; dazwischen bleiben
+ * Custom Data, CurrentRelativeTransform und Instanz-Transform unveraendert. Gegenprobe: auf dem CPU-Pfad ist
+ * die Einheit jeden Frame dirty.
+ */
+bool FVisualEffectCustomDataTest::RunTest(const FString& Parameters)
+{
+	using namespace VisualEffectCustomData;
+
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr int32 Frames = 600;
+	constexpr int32 StopRotationFrame = 300;
+	constexpr int32 CpuFrames = 10;
+
+	IConsoleVariable* GpuPeriodic = IConsoleManager::Get().FindConsoleVariable(TEXT("RTS.VisualEffects.GpuPeriodic"));
+	if (!GpuPeriodic)
+	{
+		AddError(TEXT("RTS.VisualEffects.GpuPeriodic fehlt"));
+		return false;
+	}
+	const int32 PreviousGpuPeriodic = GpuPeriodic->GetInt();
+	GpuPeriodic->Set(1, ECVF_SetByCode);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!World)
+	{
+		GpuPeriodic->Set(PreviousGpuPeriodic, ECVF_SetByCode);
+		return false;
+	}
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(Owner);
+	ISM->SetNumCustomDataFloats(NumFloats);
+	const FTransform InstanceTransform(FQuat::Identity, FVector(100.f, 0.f, 0.f), FVector(2.f, 1.f, 4.f));
+	const int32 InstanceIndex = ISM->AddInstance(InstanceTransform);
+
+	UInstancedStaticMeshComponent* SmallISM = NewObject<UInstancedStaticMeshComponent>(Owner);
+	SmallISM->SetNumCustomDataFloats(13);
+
+	TSharedRef<FMassEntityManager> EntityManager = MakeShareable(new FMassEntityManager(World));
+	EntityManager->Initialize();
+
+	const FMassArchetypeHandle Archetype = EntityManager->CreateArchetype({
+		FTransformFragment::StaticStruct(),
+		FMassActorFragment::StaticStruct(),
+		FMassUnitVisualFragment::StaticStruct(),
+		FMassVisualTweenFragment::StaticStruct(),
+		FMassVisualEffectFragment::StaticStruct(),
+		FMassAgentCharacteristicsFragment::StaticStruct() });
+	const FMassEntityHandle Entity = EntityManager->CreateEntity(Archetype);
+
+	// Nicht-uniforme Skalierung: der Rotationsblock muss sie fuer die Reihenfolge Skalieren -> Drehen mitliefern.
+	const FTransform BaseOffset(FQuat::Identity, FVector::ZeroVector, FVector(2.f, 1.f, 4.f));
+	FMassUnitVisualFragment& Visual = EntityManager->GetFragmentDataChecked<FMassUnitVisualFragment>(Entity);
+	FMassUnitVisualInstance& Instance = Visual.VisualInstances.AddDefaulted_GetRef();
+	Instance.TemplateISM = ISM;
+	Instance.TargetISM = SmallISM;
+	Instance.InstanceIndex = 0;
+	TestFalse(TEXT("ISM mit 13 Floats hat keinen Platz fuer den Effektblock"), CanUseCustomData(Visual));
+	Instance.TargetISM = ISM;
+	Instance.InstanceIndex = InstanceIndex;
+	Instance.BaseOffset = BaseOffset;
+	Instance.CurrentRelativeTransform = BaseOffset;
+	TestTrue(TEXT("ISM mit Effektblock ist nutzbar"), CanUseCustomData(Visual));
+
+	FMassVisualEffectFragment& Effect = EntityManager->GetFragmentDataChecked<FMassVisualEffectFragment>(Entity);
+	Effect.bPulsateEnabled = true;
+	Effect.PulsateMinScale = FVector(1.6f, 0.8f, 3.2f);
+	Effect.PulsateMaxScale = FVector(2.4f, 1.2f, 4.8f);
+	Effect.PulsateHalfPeriod = 0.5f;
+	Effect.bRotationEnabled = true;
+	Effect.RotationAxis = FVector::UpVector;
+	Effect.RotationDegreesPerSecond = 90.f;
+
+	UMassUnitVisualTweenProcessor* Processor = NewObject<UMassUnitVisualTweenProcessor>();
+	Processor->CallInitialize(World, EntityManager);
+
+	auto CustomData = [ISM, InstanceIndex](const int32 Slot)
+	{
+		return ISM->PerInstanceSMCustomData[InstanceIndex * ISM->NumCustomDataFloats + Slot];
+	};
+
+	// Ein Frame wie in der Pipeline: der Placement-Prozessor hat das Dirty-Flag des Vorframes verbraucht.
+	auto RunFrame = [&EntityManager, Processor, Entity, DeltaTime]()
+	{
+		EntityManager->GetFragmentDataChecked<FMassAgentCharacteristicsFragment>(Entity).bTransformDirty = false;
+		FMassProcessingContext ProcessingContext(EntityManager, DeltaTime);
+		UE::Mass::Executor::Run(*Processor, ProcessingContext);
+		return EntityManager->GetFragmentDataChecked<FMassAgentCharacteristicsFragment>(Entity).bTransformDirty;
+	};
+
+	TArray<int32> DirtyFrames;
+	TArray<float> DataAfterStart;
+	for (int32 Frame = 0; Frame < Frames && !HasAnyErrors(); ++Frame)
+	{
+		if (Frame == StopRotationFrame)
+		{
+			EntityManager->GetFragmentDataChecked<FMassVisualEffectFragment>(Entity).bRotationEnabled = false;
+		}
+
+		if (RunFrame())
+		{
+			DirtyFrames.Add(Frame);
+		}
+
+		const FMassUnitVisualInstance& Current = EntityManager->GetFragmentDataChecked<FMassUnitVisualFragment>(Entity).VisualInstances[0];
+		if (!Current.CurrentRelativeTransform.Equals(BaseOffset))
+		{
+			AddError(FString::Printf(TEXT("Frame %d: Effekte wurden in CurrentRelativeTransform eingerechnet"), Frame));
+		}
+
+		if (Frame == 0)
+		{
+			DataAfterStart = TArray<float>(&ISM->PerInstanceSMCustomData[InstanceIndex * NumFloats], NumFloats);
+		}
+		else if (Frame < StopRotationFrame)
+		{
+			for (int32 Slot = 0; Slot < NumFloats; ++Slot)
+			{
+				if (CustomData(Slot) != DataAfterStart[Slot])
+				{
+					AddError(FString::Printf(TEXT("Frame %d: Custom Data %d waehrend des laufenden Effekts geaendert"), Frame, Slot));
+					break;
+				}
+			}
+		}
+	}
+
+	TestEqual(TEXT("Dirty-Frames (Start und Rotationsstopp)"), DirtyFrames.Num(), 2);
+	if (DirtyFrames.Num() == 2)
+	{
+		TestEqual(TEXT("Erster Schreibvorgang beim Start"), DirtyFrames[0], 0);
+		TestEqual(TEXT("Zweiter Schreibvorgang beim Rotationsstopp"), DirtyFrames[1], StopRotationFrame);
+	}
+
+	// Der Start-Block: Pulsier-Faktoren relativ zur Instanzskalierung, Rotation mit Instanzskalierung.
+	if (DataAfterStart.Num() == NumFloats)
+	{
+		TestEqual(TEXT("Pulsieren: halbe Periode"), DataAfterStart[PulsateHalfPeriod], 0.5f);
+		TestTrue(TEXT("Pulsieren: Faktoren relativ zur Instanzskalierung"),
+			FMath::IsNearlyEqual(DataAfterStart[PulsateMinFactor + 0], 0.8f) && FMath::IsNearlyEqual(DataAfterStart[PulsateMinFactor + 1], 0.8f)
+			&& FMath::IsNearlyEqual(DataAfterStart[PulsateMinFactor + 2], 0.8f) && FMath::IsNearlyEqual(DataAfterStart[PulsateMaxFactor + 2], 1.2f));
+		TestTrue(TEXT("Rotation: Instanzskalierung im Block"),
+			FMath::IsNearlyEqual(DataAfterStart[RotationScale + 0], 2.f) && FMath::IsNearlyEqual(DataAfterStart[RotationScale + 1], 1.f)
+			&& FMath::IsNearlyEqual(DataAfterStart[RotationScale + 2], 4.f));
+		TestEqual(TEXT("Rotation: Grad pro Sekunde"), DataAfterStart[RotationDegreesPerSecond], 90.f);
+		// Elapsed wird vor dem Schreiben hochgezaehlt, die Startzeit liegt also einen Frame vor WorldTime 0.
+		TestTrue(TEXT("Rotation: Startzeit aus dem ersten Frame"), FMath::IsNearlyEqual(DataAfterStart[RotationStartTime], -DeltaTime));
+	}
+
+	// Pulsieren laeuft mit unveraenderter Startzeit weiter, der Rotationsblock ist leer.
+	TestEqual(TEXT("Pulsieren: Startzeit"), CustomData(PulsateStartTime), DataAfterStart.IsValidIndex(PulsateStartTime) ? DataAfterStart[PulsateStartTime] : -1.f);
+	TestEqual(TEXT("Rotation gestoppt"), CustomData(RotationDegreesPerSecond), 0.f);
+	TestEqual(TEXT("Rotation gestoppt: Skalierung geleert"), CustomData(RotationScale), 0.f);
+
+	// Gegenprobe CPU-Pfad: der erste Frame raeumt den Block, danach ist die Einheit jeden Frame dirty.
+	GpuPeriodic->Set(0, ECVF_SetByCode);
+	int32 CpuDirtyFrames = 0;
+	for (int32 Frame = 0; Frame < CpuFrames; ++Frame)
+	{
+		CpuDirtyFrames += RunFrame() ? 1 : 0;
+	}
+	TestEqual(TEXT("CPU-Pfad: jeder Frame dirty"), CpuDirtyFrames, CpuFrames);
+	TestEqual(TEXT("CPU-Pfad: Pulsieren im Block aus"), CustomData(PulsateHalfPeriod), 0.f);
+	TestFalse(TEXT("CPU-Pfad: Pulsieren im Transform"),
+		EntityManager->GetFragmentDataChecked<FMassUnitVisualFragment>(Entity).VisualInstances[0].CurrentRelativeTransform.GetScale3D().Equals(BaseOffset.GetScale3D()));
+
+	// Der Prozessor fasst den ISM-Transform nie an, das macht nur der Placement-Prozessor.
+	FTransform After;
+	ISM->GetInstanceTransform(InstanceIndex, After, false);
+	TestTrue(TEXT("Instanz-Transform unveraendert"), After.Equals(InstanceTransform));
+
+	GpuPeriodic->Set(PreviousGpuPeriodic, ECVF_SetByCode);
+	World->DestroyWorld(false);
+	return !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
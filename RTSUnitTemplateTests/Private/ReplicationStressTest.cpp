@@ -13,6 +13,9 @@
 #include "Engine/NetDriver.h"
 #include "Engine/NetConnection.h"
 #include "Mass/Replication/UnitClientBubbleInfo.h"
+#include "Controller/PlayerController/ControllerBase.h"
+#include "HAL/IConsoleManager.h"
+#include "Actors/Projectile.h"
 
 AReplicationStressTest::AReplicationStressTest()
 {
@@ -53,7 +56,7 @@ void AReplicationStressTest::PrepareTest()
 	Super::PrepareTest();
 
 	// 1. Zeitlimit gro�z�gig setzen
-	TimeLimit = TestTimeout + 20.0f;
+	TimeLimit = TestTimeout + 20.0f + GetMeasurementTime();
 
 	if (HasAuthority())
 	{
@@ -78,6 +81,12 @@ void AReplicationStressTest::GetLifetimeReplicatedProps(TArray<FLifetimeProperty
 	DOREPLIFETIME(AReplicationStressTest, BurstLoadUnitCount);
 	DOREPLIFETIME(AReplicationStressTest, BurstDelay);
 	DOREPLIFETIME(AReplicationStressTest, TestTimeout);
+	DOREPLIFETIME(AReplicationStressTest, SpawnTeamCount);
+	DOREPLIFETIME(AReplicationStressTest, bMeasureRelevancy);
+	DOREPLIFETIME(AReplicationStressTest, RelevancyPhaseDuration);
+	DOREPLIFETIME(AReplicationStressTest, bMeasureProjectiles);
+	DOREPLIFETIME(AReplicationStressTest, ProjectilesPerSecond);
+	DOREPLIFETIME(AReplicationStressTest, ProjectilePhaseDuration);
 }
 
 void AReplicationStressTest::Tick(float DeltaSeconds)
@@ -191,7 +200,22 @@ void AReplicationStressTest::Tick(float DeltaSeconds)
 					}
 				}
 
-				if (ValidHandles > 0 || (StaticLoadUnitCount + BurstLoadUnitCount == 0))
+				if ((ValidHandles > 0 || (StaticLoadUnitCount + BurstLoadUnitCount == 0)) && bMeasureRelevancy && HasAuthority())
+				{
+					UE_LOG(LogTemp, Display, TEXT("RELEVANCY: Phase 1/2 - alle Bubbles replizieren alle Einheiten (%.0fs)"), RelevancyPhaseDuration);
+					PreviousRelevancyEnable = 0;
+					if (IConsoleVariable* Var = IConsoleManager::Get().FindConsoleVariable(TEXT("net.RTS.Relevancy.Enable")))
+					{
+						PreviousRelevancyEnable = Var->GetInt();
+					}
+					SetRelevancyPhase(false);
+					CurrentState = ETestState::MeasuringRelevancy;
+				}
+				else if ((ValidHandles > 0 || (StaticLoadUnitCount + BurstLoadUnitCount == 0)) && bMeasureProjectiles && HasAuthority())
+				{
+					StartProjectileMeasurement();
+				}
+				else if (ValidHandles > 0 || (StaticLoadUnitCount + BurstLoadUnitCount == 0))
 				{
 					FinishTest(EFunctionalTestResult::Succeeded, TEXT("Stress-Test erfolgreich abgeschlossen!"));
 					CurrentState = ETestState::Finished;
@@ -199,6 +223,29 @@ void AReplicationStressTest::Tick(float DeltaSeconds)
 				}
 			}
 			break;
+
+		case ETestState::MeasuringRelevancy:
+			if (TickRelevancyMeasurement(DeltaSeconds))
+			{
+				if (bMeasureProjectiles)
+				{
+					StartProjectileMeasurement();
+					break;
+				}
+				FinishTest(EFunctionalTestResult::Succeeded, TEXT("Stress-Test inkl. Relevancy-Messung abgeschlossen!"));
+				CurrentState = ETestState::Finished;
+				return;
+			}
+			break;
+
+		case ETestState::MeasuringProjectiles:
+			if (TickProjectileMeasurement(DeltaSeconds))
+			{
+				FinishTest(EFunctionalTestResult::Succeeded, TEXT("Stress-Test inkl. Projektil-Messung abgeschlossen!"));
+				CurrentState = ETestState::Finished;
+				return;
+			}
+			break;
 		default: ;
 		}
 	}
@@ -214,9 +261,17 @@ void AReplicationStressTest::Tick(float DeltaSeconds)
 		}
 	}
 
-	// 4. Timeout Check am Ende
-	if (TimeSinceStart > TestTimeout)
+	// 4. Timeout Check am Ende (die Relevancy-Messung verlängert das Budget)
+	if (TimeSinceStart > TestTimeout + GetMeasurementTime())
 	{
+		if (CurrentState == ETestState::MeasuringRelevancy)
+		{
+			SetRelevancyPhase(PreviousRelevancyEnable != 0);
+		}
+		if (CurrentState == ETestState::MeasuringProjectiles)
+		{
+			SetProjectilePhase(PreviousClientSimulation != 0);
+		}
 		RunDetailedClientCheck();
 		int32 RegCount = 0, TotCount = 0;
 		if (Reg) Reg->GetRegistrationCounts(RegCount, TotCount);
@@ -246,8 +301,17 @@ void AReplicationStressTest::SpawnUnits(int32 Count)
 	for (int32 i = 0; i < Count; ++i)
 	{
 		FVector Loc = StartLoc + FVector((i / Side) * 200.0f, (i % Side) * 200.0f, 0.0f);
-		if (AUnitBase* NewUnit = World->SpawnActor<AUnitBase>(UnitClass, Loc, FRotator::ZeroRotator, SpawnParams))
+		const FTransform SpawnXf(FRotator::ZeroRotator, Loc);
+		// Deferred, damit das Team vor BeginPlay (Mass-Registrierung) gesetzt ist
+		if (AUnitBase* NewUnit = World->SpawnActorDeferred<AUnitBase>(UnitClass, SpawnXf, nullptr, nullptr, SpawnParams.SpawnCollisionHandlingOverride))
 		{
+			if (SpawnTeamCount > 0)
+			{
+				// Reihen statt einzelne Einheiten wechseln das Team, damit sich die Teams gegenseitig teilweise sehen
+				NewUnit->TeamId = 1 + (i / Side) % SpawnTeamCount;
+			}
+			NewUnit->FinishSpawning(SpawnXf);
+
 			// WICHTIG: Index manuell setzen, da wir am GameMode vorbeigehen
 			// Nutze einen hohen Bereich f�r Test-Einheiten
 			static int32 TestUnitCounter = 10000; 
@@ -256,6 +320,202 @@ void AReplicationStressTest::SpawnUnits(int32 Count)
 	}
 }
 
+void AReplicationStressTest::SetRelevancyPhase(bool bEnableRelevancy)
+{
+	if (IConsoleVariable* Var = IConsoleManager::Get().FindConsoleVariable(TEXT("net.RTS.Relevancy.Enable")))
+	{
+		Var->Set(bEnableRelevancy ? 1 : 0, ECVF_SetByCode);
+	}
+
+	if (bEnableRelevancy && SpawnTeamCount > 0)
+	{
+		// Ohne Team ist eine Bubble ungefiltert; für die Messung bekommt jeder Spieler reihum ein Team
+		int32 NextTeam = 0;
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			AControllerBase* PC = Cast<AControllerBase>(It->Get());
+			if (PC && PC->SelectableTeamId <= 0)
+			{
+				PreviousControllerTeams.Add(PC, PC->SelectableTeamId);
+				PC->SelectableTeamId = 1 + (NextTeam++ % SpawnTeamCount);
+			}
+		}
+	}
+	else
+	{
+		for (const TPair<TWeakObjectPtr<AControllerBase>, int32>& Pair : PreviousControllerTeams)
+		{
+			if (AControllerBase* PC = Pair.Key.Get())
+			{
+				PC->SelectableTeamId = Pair.Value;
+			}
+		}
+		PreviousControllerTeams.Reset();
+	}
+}
+
+bool AReplicationStressTest::TickRelevancyMeasurement(float DeltaSeconds)
+{
+	RelevancyPhaseTime += DeltaSeconds;
+
+	// Die erste Sekunde jeder Phase verwerfen: Bubbles bauen sich in der Zeit um
+	if (RelevancyPhaseTime >= 1.0f)
+	{
+		FRelevancyPhaseStats& Stats = RelevancyStats[RelevancyPhase];
+		if (UNetDriver* NetDriver = GetWorld()->GetNetDriver())
+		{
+			Stats.OutKBSum += NetDriver->OutBytesPerSecond / 1024.0;
+		}
+		for (TActorIterator<AUnitClientBubbleInfo> It(GetWorld()); It; ++It)
+		{
+			Stats.BubbleItemSum += It->Agents.Items.Num();
+		}
+		++Stats.Samples;
+	}
+
+	if (RelevancyPhaseTime < FMath::Max(2.0f, RelevancyPhaseDuration))
+	{
+		return false;
+	}
+
+	RelevancyPhaseTime = 0.0f;
+	if (RelevancyPhase == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("RELEVANCY: Phase 2/2 - Team-Bubbles (net.RTS.Relevancy.Enable=1) (%.0fs)"), RelevancyPhaseDuration);
+		RelevancyPhase = 1;
+		SetRelevancyPhase(true);
+		return false;
+	}
+
+	SetRelevancyPhase(PreviousRelevancyEnable != 0);
+
+	auto AvgKB = [](const FRelevancyPhaseStats& S) { return S.Samples > 0 ? S.OutKBSum / S.Samples : 0.0; };
+	auto AvgItems = [](const FRelevancyPhaseStats& S) { return S.Samples > 0 ? double(S.BubbleItemSum) / S.Samples : 0.0; };
+	const double OffKB = AvgKB(RelevancyStats[0]);
+	const double OnKB = AvgKB(RelevancyStats[1]);
+	UE_LOG(LogTemp, Display, TEXT("RELEVANCY: Net-Out aus=%.2f KB/s an=%.2f KB/s (%.0f%%), Bubble-Items aus=%.0f an=%.0f"),
+		OffKB, OnKB, OffKB > 0.0 ? 100.0 * OnKB / OffKB : 100.0,
+		AvgItems(RelevancyStats[0]), AvgItems(RelevancyStats[1]));
+	return true;
+}
+
+float AReplicationStressTest::GetMeasurementTime() const
+{
+	return (bMeasureRelevancy ? 2.0f * RelevancyPhaseDuration : 0.0f)
+		+ (bMeasureProjectiles ? 2.0f * FMath::Max(3.0f, ProjectilePhaseDuration) : 0.0f);
+}
+
+void AReplicationStressTest::StartProjectileMeasurement()
+{
+	// Schützen und Ziele sind die gespawnten Einheiten
+	ProjectileUnits.Reset();
+	for (TActorIterator<AUnitBase> It(GetWorld()); It; ++It)
+	{
+		ProjectileUnits.Add(*It);
+	}
+
+	PreviousClientSimulation = 1;
+	if (IConsoleVariable* Var = IConsoleManager::Get().FindConsoleVariable(TEXT("RTS.Projectile.ClientSimulation")))
+	{
+		PreviousClientSimulation = Var->GetInt();
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("PROJEKTILE: Phase 1/2 - Transform-Multicast pro Tick, %d Projektile/s (%.0fs)"), ProjectilesPerSecond, ProjectilePhaseDuration);
+	ProjectilePhase = 0;
+	ProjectilePhaseTime = 0.0f;
+	ProjectileSpawnBudget = 0.0f;
+	SetProjectilePhase(false);
+	CurrentState = ETestState::MeasuringProjectiles;
+}
+
+void AReplicationStressTest::SetProjectilePhase(bool bClientSimulation)
+{
+	// Wird beim Launch gelesen: Projektile der vorigen Phase fliegen im alten Modus zu Ende
+	if (IConsoleVariable* Var = IConsoleManager::Get().FindConsoleVariable(TEXT("RTS.Projectile.ClientSimulation")))
+	{
+		Var->Set(bClientSimulation ? 1 : 0, ECVF_SetByCode);
+	}
+}
+
+void AReplicationStressTest::SpawnProjectiles(int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!World || !ProjectileClassToSpawn || ProjectileUnits.Num() < 2) return;
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		AUnitBase* Shooter = ProjectileUnits[FMath::RandRange(0, ProjectileUnits.Num() - 1)].Get();
+		AUnitBase* Target = ProjectileUnits[FMath::RandRange(0, ProjectileUnits.Num() - 1)].Get();
+		if (!Shooter || !Target || Shooter == Target) continue;
+
+		const FVector Start = Shooter->GetActorLocation() + FVector(0.0f, 0.0f, 100.0f);
+		const FTransform SpawnXf((Target->GetActorLocation() - Start).Rotation(), Start);
+		AProjectile* Projectile = World->SpawnActorDeferred<AProjectile>(ProjectileClassToSpawn, SpawnXf, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!Projectile) continue;
+
+		Projectile->bUseMass = false;
+		Projectile->HomingMissleCount = (ProjectileCounter++ % 4 == 0) ? 1 : 0;
+		Projectile->Init(Target, Shooter);
+		// Messung, kein Kampf: Treffer sollen die Einheiten nicht dezimieren
+		Projectile->UseAttributeDamage = false;
+		Projectile->Damage = 0.0f;
+		Projectile->FinishSpawning(SpawnXf);
+		// Im Multicast-Modus bewegt der Server nur eine vorhandene Flug-Instanz (die Client-Simulation legt sie selbst an)
+		Projectile->InitISMComponent(SpawnXf);
+		++ProjectileStats[ProjectilePhase].Spawned;
+	}
+}
+
+bool AReplicationStressTest::TickProjectileMeasurement(float DeltaSeconds)
+{
+	ProjectilePhaseTime += DeltaSeconds;
+
+	ProjectileSpawnBudget += DeltaSeconds * ProjectilesPerSecond;
+	const int32 ToSpawn = FMath::FloorToInt(ProjectileSpawnBudget);
+	ProjectileSpawnBudget -= ToSpawn;
+	SpawnProjectiles(ToSpawn);
+
+	// Die ersten zwei Sekunden jeder Phase verwerfen: Projektile der vorigen Phase sind noch in der Luft
+	if (ProjectilePhaseTime >= 2.0f)
+	{
+		FProjectilePhaseStats& Stats = ProjectileStats[ProjectilePhase];
+		if (UNetDriver* NetDriver = GetWorld()->GetNetDriver())
+		{
+			Stats.OutBytesSum += NetDriver->OutBytesPerSecond;
+		}
+		++Stats.Samples;
+	}
+
+	if (ProjectilePhaseTime < FMath::Max(3.0f, ProjectilePhaseDuration))
+	{
+		return false;
+	}
+
+	ProjectilePhaseTime = 0.0f;
+	if (ProjectilePhase == 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("PROJEKTILE: Phase 2/2 - Client-Simulation (RTS.Projectile.ClientSimulation=1) (%.0fs)"), ProjectilePhaseDuration);
+		ProjectilePhase = 1;
+		SetProjectilePhase(true);
+		return false;
+	}
+
+	SetProjectilePhase(PreviousClientSimulation != 0);
+
+	auto AvgBytes = [](const FProjectilePhaseStats& S) { return S.Samples > 0 ? S.OutBytesSum / S.Samples : 0.0; };
+	const double MulticastBytes = AvgBytes(ProjectileStats[0]);
+	const double SimulatedBytes = AvgBytes(ProjectileStats[1]);
+	UE_LOG(LogTemp, Display, TEXT("PROJEKTILE: Net-Out Multicast=%.0f B/s Client-Simulation=%.0f B/s (%.0f%%), Projektile %d / %d"),
+		MulticastBytes, SimulatedBytes, MulticastBytes > 0.0 ? 100.0 * SimulatedBytes / MulticastBytes : 100.0,
+		ProjectileStats[0].Spawned, ProjectileStats[1].Spawned);
+
+	if (ProjectileStats[0].Spawned == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PROJEKTILE: keine Projektile gespawnt - ProjectileClassToSpawn gesetzt und mindestens zwei Einheiten?"));
+	}
+	return true;
+}
+
 void AReplicationStressTest::RunDetailedClientCheck()
 {
 	int32 UnitsWithIndex = 0;
@@ -37,6 +37,40 @@ public:
 	UPROPERTY(EditAnywhere, Category = "RTS Test")
 	bool bAutoStartInPIE = false;
 
+	/** Verteilt gespawnte Einheiten reihum auf TeamId 1..N. 0 = Team des Blueprints behalten */
+	UPROPERTY(EditAnywhere, Replicated, Category = "RTS Test")
+	int32 SpawnTeamCount = 0;
+
+	/**
+	 * Misst nach der Validierung den Server Net-Out zweimal: ohne und mit net.RTS.Relevancy.Enable (Team-Bubbles).
+	 * Controller ohne Team bekommen für die zweite Phase reihum ein Team aus SpawnTeamCount.
+	 */
+	UPROPERTY(EditAnywhere, Replicated, Category = "RTS Test")
+	bool bMeasureRelevancy = false;
+
+	/** Dauer (s) jeder Messphase */
+	UPROPERTY(EditAnywhere, Replicated, Category = "RTS Test")
+	float RelevancyPhaseDuration = 10.0f;
+
+	/**
+	 * Misst danach den Server Net-Out mit vielen Actor-Projektilen (bUseMass = false) zweimal: Transform-Multicast
+	 * pro Tick und Client-Simulation (RTS.Projectile.ClientSimulation). Jedes vierte Projektil ist zielsuchend.
+	 */
+	UPROPERTY(EditAnywhere, Replicated, Category = "RTS Test")
+	bool bMeasureProjectiles = false;
+
+	/** Projektil-Blueprint mit Mesh; ohne Mesh gibt es keine Flug-Instanz und nichts zu replizieren */
+	UPROPERTY(EditAnywhere, Category = "RTS Test")
+	TSubclassOf<class AProjectile> ProjectileClassToSpawn;
+
+	/** Neue Projektile pro Sekunde während der Projektil-Messung */
+	UPROPERTY(EditAnywhere, Replicated, Category = "RTS Test")
+	int32 ProjectilesPerSecond = 200;
+
+	/** Dauer (s) jeder Projektil-Messphase */
+	UPROPERTY(EditAnywhere, Replicated, Category = "RTS Test")
+	float ProjectilePhaseDuration = 10.0f;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void PostInitializeComponents() override;
@@ -49,6 +83,19 @@ private:
 	void SpawnUnits(int32 Count);
 	void RunDetailedClientCheck();
 
+	// Server only. Returns true once both phases are measured and logged.
+	bool TickRelevancyMeasurement(float DeltaSeconds);
+	void SetRelevancyPhase(bool bEnableRelevancy);
+
+	// Server only. Returns true once both projectile phases are measured and logged.
+	bool TickProjectileMeasurement(float DeltaSeconds);
+	void StartProjectileMeasurement();
+	void SetProjectilePhase(bool bClientSimulation);
+	void SpawnProjectiles(int32 Count);
+
+	// Extra time the optional measurement phases add to the timeout.
+	float GetMeasurementTime() const;
+
 	UPROPERTY(Replicated)
 	bool bBurstSpawned = false;
 	float TimeSinceStart = 0.0f;
@@ -59,8 +106,38 @@ private:
 		WaitingForStaticLoad,
 		WaitingForBurstLoad,
 		ValidatingSelection,
+		MeasuringRelevancy,
+		MeasuringProjectiles,
 		Finished
 	};
 
 	ETestState CurrentState = ETestState::WaitingForStaticLoad;
+
+	struct FRelevancyPhaseStats
+	{
+		double OutKBSum = 0.0;
+		int64 BubbleItemSum = 0;
+		int32 Samples = 0;
+	};
+
+	FRelevancyPhaseStats RelevancyStats[2];
+	int32 RelevancyPhase = 0;
+	float RelevancyPhaseTime = 0.0f;
+	int32 PreviousRelevancyEnable = 0;
+	TMap<TWeakObjectPtr<class AControllerBase>, int32> PreviousControllerTeams;
+
+	struct FProjectilePhaseStats
+	{
+		double OutBytesSum = 0.0;
+		int32 Samples = 0;
+		int32 Spawned = 0;
+	};
+
+	FProjectilePhaseStats ProjectileStats[2];
+	int32 ProjectilePhase = 0;
+	float ProjectilePhaseTime = 0.0f;
+	float ProjectileSpawnBudget = 0.0f;
+	int32 ProjectileCounter = 0;
+	int32 PreviousClientSimulation = 1;
+	TArray<TWeakObjectPtr<class AUnitBase>> ProjectileUnits;
 };
\ No newline at end of file